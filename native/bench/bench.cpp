@@ -0,0 +1,138 @@
+#include "bench.h"
+#include <ArduinoJson.h>
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+
+// Count every heap request while enabled. String, the STL and ArduinoJson
+// all end up in malloc on glibc, so interposing it covers operator new too.
+static bool countingAllocs = false;
+static uint64_t allocCount = 0;
+static uint64_t allocBytes = 0;
+
+#ifdef __GLIBC__
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+
+void* malloc(size_t size) {
+  if (countingAllocs) {
+    allocCount++;
+    allocBytes += size;
+  }
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+  if (countingAllocs) {
+    allocCount++;
+    allocBytes += count * size;
+  }
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+  if (countingAllocs) {
+    allocCount++;
+    allocBytes += size;
+  }
+  return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+static volatile size_t sink = 0;
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t timeBatch(const BenchOp& op, uint32_t iterations) {
+  uint64_t start = nowNs();
+  for (uint32_t i = 0; i < iterations; i++) {
+    sink = sink + op();
+  }
+  return nowNs() - start;
+}
+
+void BenchRunner::beginSuite(const char* name) {
+  suite = name;
+}
+
+void BenchRunner::run(const char* name, BenchOp op) {
+  BenchResult result;
+  result.suite = suite;
+  result.name = name;
+  result.outputBytes = op();
+
+  // Grow the batch until it is long enough to time reliably
+  uint32_t iterations = 1;
+  while (timeBatch(op, iterations) < (uint64_t)BENCH_BATCH_MS * 1000000ULL && iterations < (1u << 30)) {
+    iterations *= 2;
+  }
+  result.iterations = iterations;
+
+  std::vector<double> samples;
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    samples.push_back((double)timeBatch(op, iterations) / iterations);
+  }
+  std::sort(samples.begin(), samples.end());
+  result.nsPerOp = samples[samples.size() / 2];
+
+  allocCount = 0;
+  allocBytes = 0;
+  countingAllocs = true;
+  for (uint32_t i = 0; i < iterations; i++) {
+    sink = sink + op();
+  }
+  countingAllocs = false;
+  result.allocsPerOp = (double)allocCount / iterations;
+  result.bytesPerOp = (double)allocBytes / iterations;
+
+  results.push_back(result);
+  Serial.printf("  %-30s %10.0f ns/op %8.1f allocs/op %10.0f B/op\n",
+                name, result.nsPerOp, result.allocsPerOp, result.bytesPerOp);
+}
+
+void BenchRunner::print() const {
+  Serial.printf("%-14s %-32s %12s %10s %12s %10s\n", "suite", "case", "ns/op", "allocs/op", "bytes/op", "output");
+  for (const BenchResult& result : results) {
+    Serial.printf("%-14s %-32s %12.0f %10.1f %12.0f %10u\n", result.suite.c_str(), result.name.c_str(), result.nsPerOp,
+                  result.allocsPerOp, result.bytesPerOp, (unsigned)result.outputBytes);
+  }
+}
+
+bool BenchRunner::writeJson(const char* path) const {
+  JsonDocument doc;
+  doc["schema"] = 2;
+  doc["compiler"] = __VERSION__;
+  doc["batch_ms"] = BENCH_BATCH_MS;
+  doc["repeats"] = BENCH_REPEATS;
+  JsonArray cases = doc["cases"].to<JsonArray>();
+  for (const BenchResult& result : results) {
+    JsonObject entry = cases.add<JsonObject>();
+    entry["suite"] = result.suite;
+    entry["name"] = result.name;
+    entry["iterations"] = result.iterations;
+    entry["ns_per_op"] = serialized(String(result.nsPerOp, 1));
+    entry["allocs_per_op"] = serialized(String(result.allocsPerOp, 2));
+    entry["bytes_per_op"] = serialized(String(result.bytesPerOp, 1));
+    entry["output_bytes"] = result.outputBytes;
+  }
+
+  String json;
+  serializeJsonPretty(doc, json);
+  FILE* fp = fopen(path, "w");
+  if (!fp) {
+    Serial.printf("✗ Cannot write %s\n", path);
+    return false;
+  }
+  bool ok = fwrite(json.c_str(), 1, json.length(), fp) == json.length();
+  fclose(fp);
+  if (ok) {
+    Serial.printf("✓ Results written to %s\n", path);
+  }
+  return ok;
+}
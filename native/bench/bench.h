@@ -0,0 +1,63 @@
+#pragma once
+
+// Minimal benchmark harness for the native environment. Each case runs in
+// timed batches of at least BENCH_BATCH_MS; ns/op is the median over
+// BENCH_REPEATS batches. Allocation counts and bytes come from one extra
+// batch with the malloc hooks in bench.cpp counting.
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+#ifndef BENCH_BATCH_MS
+#define BENCH_BATCH_MS 50
+#endif
+#ifndef BENCH_REPEATS
+#define BENCH_REPEATS 5
+#endif
+#ifndef BENCH_RESULTS_PATH
+#define BENCH_RESULTS_PATH "bench_results.json"
+#endif
+
+// The op returns the size of what it produced, which also keeps the
+// compiler from discarding the work
+typedef std::function<size_t()> BenchOp;
+
+struct BenchResult {
+  String suite;
+  String name;
+  uint32_t iterations;       // Per timed batch
+  double nsPerOp;
+  double allocsPerOp;
+  double bytesPerOp;         // Bytes requested from malloc/realloc per op
+  size_t outputBytes;
+};
+
+class BenchRunner {
+private:
+  std::vector<BenchResult> results;
+  String suite;
+
+public:
+  // Cases run after this are reported under `name`
+  void beginSuite(const char* name);
+  void run(const char* name, BenchOp op);
+  void print() const;
+
+  // Machine-readable results; see native/README.md for the format
+  bool writeJson(const char* path) const;
+};
+
+// Print sink that only counts, so output buffering stays out of timings
+class CountingPrint : public Print {
+public:
+  size_t count = 0;
+  size_t write(uint8_t) override { count++; return 1; }
+  size_t write(const uint8_t*, size_t size) override { count += size; return size; }
+};
+
+// One function per suite, in <suite>_bench.cpp; main.cpp lists them
+void runSerializationBenchmarks(BenchRunner& runner);
+void runStorageBenchmarks(BenchRunner& runner);
+void runPipelineBenchmarks(BenchRunner& runner);
+void runRingBenchmarks(BenchRunner& runner);
@@ -0,0 +1,59 @@
+// Host benchmark runner: program [suite...] [results.json]
+
+#include "bench.h"
+#include <LittleFS.h>
+
+struct Suite {
+  const char* name;
+  void (*run)(BenchRunner& runner);
+};
+
+static const Suite suites[] = {
+  {"serialization", runSerializationBenchmarks},
+  {"storage", runStorageBenchmarks},
+  {"pipeline", runPipelineBenchmarks},
+  {"ring", runRingBenchmarks},
+};
+
+static bool isResultsPath(const char* arg) {
+  size_t length = strlen(arg);
+  return length > 5 && strcmp(arg + length - 5, ".json") == 0;
+}
+
+int main(int argc, char** argv) {
+  LittleFS.begin(true);
+
+  const char* resultsPath = BENCH_RESULTS_PATH;
+  bool filtered = false;
+  for (int i = 1; i < argc; i++) {
+    if (isResultsPath(argv[i])) {
+      resultsPath = argv[i];
+    } else {
+      filtered = true;
+    }
+  }
+
+  BenchRunner runner;
+  int ran = 0;
+  for (const Suite& suite : suites) {
+    bool selected = !filtered;
+    for (int i = 1; i < argc; i++) {
+      selected |= strcmp(argv[i], suite.name) == 0;
+    }
+    if (!selected) {
+      continue;
+    }
+    Serial.printf("\n=== %s ===\n", suite.name);
+    runner.beginSuite(suite.name);
+    suite.run(runner);
+    ran++;
+  }
+
+  if (ran == 0) {
+    Serial.println("✗ No suite matched");
+    return 2;
+  }
+  Serial.println();
+  runner.print();
+  return runner.writeJson(resultsPath) ? 0 : 1;
+}
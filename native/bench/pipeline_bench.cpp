@@ -0,0 +1,106 @@
+// Sensor pipeline hop cost with its tasks on host threads. Each sample waits
+// for a token from the op, so the sampler never runs ahead and nothing is
+// dropped; every conditioned sample is reported, and the op takes payloads
+// off the last queue the way the loop task does. Allocation counts include
+// the pipeline threads.
+
+#include "bench.h"
+#include "../../src/Pipeline/sensor_pipeline.h"
+
+// Samples in flight in the throughput case: no more than the report queue
+// holds, so the conditioner never has to drop a report
+#define BENCH_PIPELINE_IN_FLIGHT PIPELINE_REPORT_QUEUE
+
+static QueueHandle_t sampleTokens = nullptr;
+
+static SensorSample benchSample() {
+  uint8_t token;
+  xQueueReceive(sampleTokens, &token, portMAX_DELAY);
+
+  SensorSample sample = {};
+  sample.record.timestampMs = millis();
+  sample.record.tof = 412.5f;
+  sample.record.weight = 3.245f;
+  sample.record.turbidity = 812.4f;
+  sample.record.ultrasonic = 38.6f;
+  sample.record.batteryVoltage = 3.94f;
+  sample.weightReady = true;
+  return sample;
+}
+
+static void releaseSample() {
+  uint8_t token = 1;
+  xQueueSend(sampleTokens, &token, portMAX_DELAY);
+}
+
+static size_t takePayload() {
+  PipelinePayload payload;
+  if (!sensorPipeline.receive(payload, portMAX_DELAY)) {
+    return 0;
+  }
+  size_t length = payload.length;
+  sensorPipeline.release(payload, 0);
+  return length;
+}
+
+static void benchCondition(const SensorSample&) {
+}
+
+// Payload of about the size of a compact frame, without the JSON library in the way
+static String benchEncode(const PipelineReport& report) {
+  char json[160];
+  const SampleRecord& r = report.sample.record;
+  snprintf(json, sizeof(json),
+           "{\"timestamp\":%lu,\"tof\":%.1f,\"weight\":%.3f,\"turbidity\":%.1f,\"ultrasonic\":%.1f,"
+           "\"battery_voltage\":%.2f,\"window_samples\":%u}",
+           (unsigned long)r.timestampMs, r.tof, r.weight, r.turbidity, r.ultrasonic, r.batteryVoltage,
+           (unsigned)report.windowSamples);
+  return String(json);
+}
+
+void runPipelineBenchmarks(BenchRunner& runner) {
+  sampleTokens = xQueueCreate(BENCH_PIPELINE_IN_FLIGHT, sizeof(uint8_t));
+  PipelineHooks hooks = {
+    benchSample,
+    benchCondition,
+    benchEncode,
+    []() { return 0UL; },
+    []() { return 0UL; },
+    nullptr,
+  };
+  if (!sampleTokens || !sensorPipeline.begin(hooks)) {
+    Serial.println("✗ Pipeline did not start");
+    return;
+  }
+
+  // One sample at a time: the hand-offs from sampler to loop task
+  runner.run("pipeline_latency", []() {
+    releaseSample();
+    return takePayload();
+  });
+
+  // Stages overlapped, as when the uploader keeps up
+  uint32_t startMs = millis();
+  uint32_t startItems = sensorPipeline.getStats(PIPELINE_UPLOAD).items;
+  for (int i = 0; i < BENCH_PIPELINE_IN_FLIGHT; i++) {
+    releaseSample();
+  }
+  runner.run("pipeline_throughput", []() {
+    size_t length = takePayload();
+    releaseSample();
+    return length;
+  });
+  for (int i = 0; i < BENCH_PIPELINE_IN_FLIGHT; i++) {
+    takePayload();
+  }
+  uint32_t elapsedMs = millis() - startMs;
+
+  // The sampler now waits for a token that never comes
+  for (int i = 0; i < PIPELINE_STAGE_COUNT; i++) {
+    const PipelineStageStats& stats = sensorPipeline.getStats((PipelineStage)i);
+    Serial.printf("  %-10s %10lu items %6lu drops, depth max %lu\n", pipelineStageName((PipelineStage)i),
+                  (unsigned long)stats.items, (unsigned long)stats.dropped, (unsigned long)stats.depthMax);
+  }
+  Serial.printf("  %.0f payloads/s overlapped\n",
+                (sensorPipeline.getStats(PIPELINE_UPLOAD).items - startItems) * 1000.0 / elapsedMs);
+}
@@ -0,0 +1,155 @@
+// SpscRing and MpscRing against a FreeRTOS queue carrying the pipeline's
+// SensorSample. The host queue is a mutex and condition variable, which is
+// roughly what xQueueSend/xQueueReceive cost on target with their critical
+// sections; the rings are the same lock-free code on both.
+
+#include "bench.h"
+#include "../../src/Pipeline/sensor_pipeline.h"
+#include "../../src/Utils/ring_buffer.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define RING_BENCH_PRODUCERS 3
+
+static SpscRing<SensorSample, PIPELINE_SAMPLE_QUEUE> handOffRing;
+static QueueHandle_t handOffQueue = nullptr;
+static TaskHandle_t ringConsumer = nullptr;
+static TaskHandle_t queueConsumer = nullptr;
+static std::atomic<bool> stopConsumers(false);
+static std::atomic<uint32_t> ringReceived(0);
+static std::atomic<uint32_t> queueReceived(0);
+static MpscRing<SensorSample, PIPELINE_SAMPLE_QUEUE> sharedRing;
+static QueueHandle_t sharedQueue = nullptr;
+static std::atomic<bool> stopProducers(false);
+
+static SensorSample benchSample() {
+  SensorSample sample = {};
+  sample.record.tof = 412.5f;
+  sample.record.weight = 3.245f;
+  sample.record.turbidity = 812.4f;
+  sample.weightReady = true;
+  return sample;
+}
+
+// Same wait as the conditioner: drain, then sleep on the notification
+static void ringConsumerTask(void*) {
+  while (!stopConsumers) {
+    SensorSample sample;
+    if (!handOffRing.pop(sample)) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    ringReceived++;
+  }
+  vTaskDelete(nullptr);
+}
+
+static void queueConsumerTask(void*) {
+  while (!stopConsumers) {
+    SensorSample sample;
+    if (xQueueReceive(handOffQueue, &sample, portMAX_DELAY) == pdTRUE) {
+      queueReceived++;
+    }
+  }
+  vTaskDelete(nullptr);
+}
+
+void runRingBenchmarks(BenchRunner& runner) {
+  const SensorSample sample = benchSample();
+
+  // Same task on both ends: the cost of the calls themselves
+  static SpscRing<SensorSample, PIPELINE_SAMPLE_QUEUE> localRing;
+  runner.run("ring_push_pop", [&]() {
+    SensorSample out;
+    localRing.push(sample);
+    return localRing.pop(out) ? sizeof(out) : 0;
+  });
+
+  QueueHandle_t localQueue = xQueueCreate(PIPELINE_SAMPLE_QUEUE, sizeof(SensorSample));
+  runner.run("queue_send_receive", [&]() {
+    SensorSample out;
+    xQueueSend(localQueue, &sample, 0);
+    return xQueueReceive(localQueue, &out, 0) == pdTRUE ? sizeof(out) : 0;
+  });
+  vQueueDelete(localQueue);
+
+  // Producer here, consumer on its own task, nothing dropped: a full ring
+  // yields where the sampler would drop, a full queue blocks in xQueueSend
+  handOffQueue = xQueueCreate(PIPELINE_SAMPLE_QUEUE, sizeof(SensorSample));
+  xTaskCreatePinnedToCore(ringConsumerTask, "ring_consumer", 4096, nullptr, 2, &ringConsumer, 1);
+  xTaskCreatePinnedToCore(queueConsumerTask, "queue_consumer", 4096, nullptr, 2, &queueConsumer, 1);
+
+  uint32_t ringPushed = 0;
+  runner.run("ring_handoff", [&]() {
+    while (!handOffRing.push(sample)) {
+      std::this_thread::yield();
+    }
+    xTaskNotifyGive(ringConsumer);
+    ringPushed++;
+    return sizeof(sample);
+  });
+
+  uint32_t queueSent = 0;
+  runner.run("queue_handoff", [&]() {
+    xQueueSend(handOffQueue, &sample, portMAX_DELAY);
+    queueSent++;
+    return sizeof(sample);
+  });
+
+  // Let both consumers drain, then wake them to see the stop flag
+  unsigned long start = millis();
+  while ((ringReceived < ringPushed || queueReceived < queueSent) && millis() - start < 1000) {
+    delay(1);
+  }
+  Serial.printf("  %lu/%lu ring and %lu/%lu queue items received\n", (unsigned long)ringReceived.load(),
+                (unsigned long)ringPushed, (unsigned long)queueReceived.load(), (unsigned long)queueSent);
+  stopConsumers = true;
+  xTaskNotifyGive(ringConsumer);
+  xQueueSend(handOffQueue, &sample, portMAX_DELAY);
+
+  // RING_BENCH_PRODUCERS threads keep the container full while this thread
+  // drains it, so each op is one item taken with every producer contending
+  // for the ring's tail or the queue's lock
+  std::vector<std::thread> producers;
+  for (int i = 0; i < RING_BENCH_PRODUCERS; i++) {
+    producers.emplace_back([&sample]() {
+      while (!stopProducers) {
+        if (!sharedRing.push(sample)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  runner.run("mpsc_ring_pop", [&]() {
+    SensorSample out;
+    while (!sharedRing.pop(out)) {
+      std::this_thread::yield();
+    }
+    return sizeof(out);
+  });
+  stopProducers = true;
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  producers.clear();
+
+  sharedQueue = xQueueCreate(PIPELINE_SAMPLE_QUEUE, sizeof(SensorSample));
+  stopProducers = false;
+  for (int i = 0; i < RING_BENCH_PRODUCERS; i++) {
+    producers.emplace_back([&sample]() {
+      while (!stopProducers) {
+        xQueueSend(sharedQueue, &sample, pdMS_TO_TICKS(10));
+      }
+    });
+  }
+  runner.run("mpsc_queue_receive", [&]() {
+    SensorSample out;
+    return xQueueReceive(sharedQueue, &out, portMAX_DELAY) == pdTRUE ? sizeof(out) : 0;
+  });
+  stopProducers = true;
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  vQueueDelete(sharedQueue);
+}
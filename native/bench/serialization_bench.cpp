@@ -0,0 +1,161 @@
+// Serialization and parsing microbenchmarks over fixtures shaped like the
+// production payloads
+
+#include "bench.h"
+#include "../../src/configs.h"
+#include "../../src/Database/address.h"
+#include "../../src/Database/device.h"
+#include "../../src/Database/profile.h"
+#include <ArduinoJson.h>
+
+// Extra module_other_data entries in the "large" frame, to track how cost
+// scales as the payload grows
+#define BENCH_LARGE_EXTRA_FIELDS 32
+
+static AddressLocation addressFixture() {
+  return createAddress("PH", "Philippines",
+                       "130000000", "National Capital Region (NCR)",
+                       "137400000", "NCR, Second District",
+                       "137404000", "Quezon City",
+                       "137404001", "Alicia",
+                       "1105", "Blk 12 Lot 4, Mabini Street");
+}
+
+// Same fields buildDeviceData() fills on target
+static DeviceData deviceDataFixture(int extraFields) {
+  DeviceData data;
+  data.uuid = "5b0e6d0c-2f1e-4c55-9a7b-3f0c9d1e8a42";
+  data.deviceId = "c1d2e3f4-a5b6-4789-8abc-def012345678";
+  data.cpuTemperature = 48.3;
+  data.cpuFrequency = 80;
+  data.ramUsage = 37.5;
+  data.storageUsage = 41.2;
+  data.signalStrength = -71;
+  data.batteryVoltage = 3.94;
+  data.batteryPercentage = 67.5;
+  data.solarWattage = 1.21;
+  data.uptimeMs = 86400123;
+  data.batteryStatus = "medium";
+  data.isOnline = true;
+  data.tof = 412.5;
+  data.force0 = 0.62;
+  data.force1 = 0.58;
+  data.weight = 3.245;
+  data.turbidity = 812.4;
+  data.ultrasonic = 38.6;
+  data.deviceStatus["modem"] = "connected";
+  data.deviceStatus["sensors"] = "active";
+  data.deviceStatus["power"] = "normal";
+  data.moduleStatus["tof"] = "online";
+  data.moduleStatus["weight"] = "online";
+  data.moduleStatus["force"] = "online";
+  data.moduleStatus["turbidity"] = "online";
+  data.moduleStatus["ultrasonic"] = "online";
+  data.deviceOtherData["free_heap"] = "184320";
+  data.deviceOtherData["chip_revision"] = "3";
+  data.deviceOtherData["sdk_version"] = "v4.4.7-dirty";
+  data.moduleOtherData["force0_raw"] = "1843";
+  data.moduleOtherData["force1_raw"] = "1790";
+  data.moduleOtherData["turbidity_raw"] = "3412";
+  data.moduleOtherData["weight_raw"] = "-84213";
+  data.moduleOtherData["tof_status"] = "0";
+  for (int i = 0; i < extraFields; i++) {
+    data.moduleOtherData["extra_" + String(i)] = String(i * 37.25f, 2);
+  }
+  return data;
+}
+
+static Device deviceFixture() {
+  Device device = createDevice("c1d2e3f4-a5b6-4789-8abc-def012345678", "Mabini St. Drain 3",
+                               "9f8e7d6c-5b4a-4392-8170-6f5e4d3c2b1a", addressFixture(), true);
+  device.config["sample_interval_ms"] = "60000";
+  device.config["upload_interval_ms"] = "300000";
+  device.config["tare_offset"] = "-84213";
+  return device;
+}
+
+// One /api/profiles/public/all page with the fields the server sends
+static String profilePageFixture(int profiles) {
+  JsonDocument doc;
+  doc["success"] = true;
+  doc["has_more"] = true;
+  JsonArray list = doc["profiles"].to<JsonArray>();
+  for (int i = 0; i < profiles; i++) {
+    JsonObject profile = list.add<JsonObject>();
+    profile["uuid"] = "0000" + String(10000 + i) + "-1e2d-4c3b-8a79-68574f3e2d1c";
+    profile["email"] = "user" + String(i) + "@smartecodrain.ph";
+    profile["full_name"] = "Juan Dela Cruz " + String(i);
+    profile["avatar_url"] = "https://cdn.smartecodrain.ph/avatars/" + String(i) + ".png";
+    profile["created_at"] = "2025-06-14T08:21:45.123Z";
+    profile["updated_at"] = "2025-09-02T17:03:11.456Z";
+  }
+  String json;
+  serializeJson(doc, json);
+  return json;
+}
+
+// Same filter ProfileDB::fetchProfilePage() applies to the socket stream
+static JsonDocument profileFilter() {
+  JsonDocument filter;
+  filter["success"] = true;
+  filter["has_more"] = true;
+  filter["profiles"][0]["uuid"] = true;
+  filter["profiles"][0]["email"] = true;
+  filter["profiles"][0]["full_name"] = true;
+  return filter;
+}
+
+void runSerializationBenchmarks(BenchRunner& runner) {
+  AddressDB addressDB(nullptr, nullptr);
+
+  DeviceData frame = deviceDataFixture(0);
+  DeviceData largeFrame = deviceDataFixture(BENCH_LARGE_EXTRA_FIELDS);
+  String frameJson = createDeviceDataJSON(frame);
+  String largeFrameJson = createDeviceDataJSON(largeFrame);
+  Device device = deviceFixture();
+  String deviceJson = createDeviceJSON(device);
+  AddressLocation address = addressFixture();
+  String addressJson = addressDB.createAddressJSON(address);
+  String profilePage = profilePageFixture(PROFILE_PAGE_SIZE);
+  JsonDocument filter = profileFilter();
+  JsonDocument parsedPage;
+  deserializeJson(parsedPage, profilePage, DeserializationOption::Filter(filter));
+
+  runner.run("device_data_serialize", [&]() { return (size_t)createDeviceDataJSON(frame).length(); });
+  runner.run("device_data_serialize_large", [&]() { return (size_t)createDeviceDataJSON(largeFrame).length(); });
+  runner.run("device_data_parse", [&]() {
+    JsonDocument doc;
+    deserializeJson(doc, frameJson);
+    return (size_t)parseDeviceDataJSON(doc).moduleOtherData.size();
+  });
+  runner.run("device_data_parse_large", [&]() {
+    JsonDocument doc;
+    deserializeJson(doc, largeFrameJson);
+    return (size_t)parseDeviceDataJSON(doc).moduleOtherData.size();
+  });
+
+  runner.run("device_serialize", [&]() { return (size_t)createDeviceJSON(device).length(); });
+  runner.run("device_parse", [&]() {
+    JsonDocument doc;
+    deserializeJson(doc, deviceJson);
+    return (size_t)parseDeviceJSON(doc).name.length();
+  });
+
+  runner.run("address_serialize", [&]() { return (size_t)addressDB.createAddressJSON(address).length(); });
+  runner.run("address_parse", [&]() { return (size_t)addressDB.parseAddressFromJSON(addressJson).street.length(); });
+
+  runner.run("profile_page_parse", [&]() {
+    JsonDocument doc;
+    deserializeJson(doc, profilePage, DeserializationOption::Filter(filter));
+    return (size_t)doc["profiles"].size();
+  });
+  runner.run("profile_transform", [&]() {
+    CountingPrint out;
+    ProfileDB::writeOwners(parsedPage["profiles"].as<JsonArrayConst>(), out, 0);
+    return out.count;
+  });
+
+  Serial.printf("  payloads: device_data %u B, large %u B, device %u B, address %u B, profile page %u B\n",
+                frameJson.length(), largeFrameJson.length(), deviceJson.length(), addressJson.length(),
+                profilePage.length());
+}
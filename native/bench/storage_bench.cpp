@@ -0,0 +1,74 @@
+// Telemetry log append and range-read throughput on the host LittleFS.
+// Host files sit in the page cache, so these time the log's own work and
+// the calls it makes into the filesystem, not flash latency.
+
+#include "bench.h"
+#include "../../src/configs.h"
+#include "../../src/Storage/telemetry_log.h"
+#include <LittleFS.h>
+#include <vector>
+
+#define BENCH_SAMPLE_PERIOD_MS 1000  // Log time between appended records
+#define BENCH_WINDOW_MS 600000       // Recent window read by the narrow scan
+
+static SampleRecord recordFixture(uint32_t timestampMs) {
+  SampleRecord record;
+  record.timestampMs = timestampMs;
+  record.tof = 412.5f;
+  record.force0 = 0.62f;
+  record.force1 = 0.58f;
+  record.weight = 3.245f;
+  record.turbidity = 812.4f;
+  record.ultrasonic = 38.6f;
+  record.batteryVoltage = 3.94f;
+  record.solarWattage = 1.21f;
+  return record;
+}
+
+void runStorageBenchmarks(BenchRunner& runner) {
+  // Start from an empty log under HOST_FS_ROOT
+  LittleFS.format();
+  TelemetryLog log;
+  log.begin();
+
+  // Fill to the segment cap so appends run with sealing and retention in play
+  const size_t capacity = TELEMETRY_MAX_SEGMENTS * TELEMETRY_SEGMENT_RECORDS;
+  uint32_t nowMs = 0;
+  for (size_t i = 0; i < capacity; i++) {
+    nowMs += BENCH_SAMPLE_PERIOD_MS;
+    log.append(recordFixture(nowMs));
+  }
+
+  std::map<String, String> before;
+  log.appendCounters(before);
+  runner.run("tlog_append", [&]() {
+    nowMs += BENCH_SAMPLE_PERIOD_MS;
+    return log.append(recordFixture(nowMs)) ? sizeof(SampleRecord) : 0;
+  });
+  log.flush();
+
+  std::map<String, String> after;
+  log.appendCounters(after);
+  uint32_t appends = after["tlog_appends"].toInt() - before["tlog_appends"].toInt();
+  uint32_t flushes = after["tlog_flushes"].toInt() - before["tlog_flushes"].toInt();
+  uint32_t bytes = after["tlog_bytes_written"].toInt() - before["tlog_bytes_written"].toInt();
+  Serial.printf("  %u appends, %.3f flushes and %.1f B written per record, %u segments\n",
+                (unsigned)appends, (double)flushes / appends, (double)bytes / appends, (unsigned)log.getSegmentCount());
+
+  std::vector<SampleRecord> out(capacity + TELEMETRY_WRITE_BATCH);
+  runner.run("tlog_scan_all", [&]() {
+    return log.readRange(0, UINT32_MAX, out.data(), out.size()) * sizeof(SampleRecord);
+  });
+  runner.run("tlog_scan_recent", [&]() {
+    uint32_t lastMs = log.getLastLoggedMs();
+    return log.readRange(lastMs - BENCH_WINDOW_MS, lastMs, out.data(), out.size()) * sizeof(SampleRecord);
+  });
+  runner.run("tlog_scan_miss", [&]() {
+    // Older than anything retained: answered from the index alone
+    return log.readRange(0, 1, out.data(), out.size()) * sizeof(SampleRecord);
+  });
+
+  // Boot-time recovery of the full log, timed by begin() itself
+  TelemetryLog recovered;
+  recovered.begin();
+}
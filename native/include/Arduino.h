@@ -0,0 +1,90 @@
+#pragma once
+
+// Host build of the Arduino core subset used by the portable modules
+// (Database, Storage, Utils, Power). Time comes from the monotonic clock,
+// Serial writes to stdout, and GPIO calls are accepted and ignored.
+
+#include "Stream.h"
+#include "WString.h"
+#include <algorithm>
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARDUINO_HOST 1
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define SERIAL_8N1 0x800001c
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef unsigned int word;
+
+using std::max;
+using std::min;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// Manual clock for tests: millis() stops following the host clock and only
+// moves on delay(), delayMicroseconds() and hostAdvanceClock(), so timeouts
+// of minutes run in no time. Single-threaded tests only.
+void hostUseManualClock(bool manual);
+void hostAdvanceClock(unsigned long ms);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+inline uint16_t analogRead(uint8_t) { return 0; }
+
+bool setCpuFrequencyMhz(uint32_t mhz);
+uint32_t getCpuFrequencyMhz();
+
+// Serial console on stdout
+class HostSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  void begin(unsigned long, uint32_t, int8_t, int8_t) {}
+  void end() {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override;
+  operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
+extern HostSerial Serial1;   // Modem UART; nothing is attached on the host
+
+// Chip queries answered from the host process
+class HostEsp {
+public:
+  uint32_t getFreeHeap() { return 200 * 1024; }
+  uint32_t getHeapSize() { return 320 * 1024; }
+  uint32_t getMaxAllocHeap() { return 110 * 1024; }
+  uint8_t getChipRevision() { return 0; }
+  const char* getSdkVersion() { return "host"; }
+  uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+  uint32_t getSketchSize() { return 0; }
+  [[noreturn]] void restart();
+};
+
+extern HostEsp ESP;
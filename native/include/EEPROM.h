@@ -0,0 +1,45 @@
+#pragma once
+
+// Host stand-in for the ESP32 EEPROM emulation, kept in
+// $HOST_FS_ROOT/eeprom.bin. Like the real one, writes land in a RAM copy
+// and reach "flash" on commit() or end().
+
+#include <Arduino.h>
+#include <vector>
+
+class EEPROMClass {
+private:
+  std::vector<uint8_t> data;
+  bool dirty;
+
+public:
+  EEPROMClass() : dirty(false) {}
+
+  bool begin(size_t size);
+  void end();
+  bool commit();
+
+  uint8_t read(int address) const;
+  void write(int address, uint8_t value);
+  size_t length() const { return data.size(); }
+  uint8_t* getDataPtr() { dirty = true; return data.data(); }
+
+  template <typename T>
+  T& get(int address, T& value) const {
+    if (address >= 0 && address + sizeof(T) <= data.size()) {
+      memcpy(&value, data.data() + address, sizeof(T));
+    }
+    return value;
+  }
+
+  template <typename T>
+  const T& put(int address, const T& value) {
+    if (address >= 0 && address + sizeof(T) <= data.size()) {
+      memcpy(data.data() + address, &value, sizeof(T));
+      dirty = true;
+    }
+    return value;
+  }
+};
+
+extern EEPROMClass EEPROM;
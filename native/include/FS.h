@@ -0,0 +1,70 @@
+#pragma once
+
+// Host stand-in for the ESP32 FS layer: files live under a directory on the
+// host ($HOST_FS_ROOT, default ".hostfs"), one per flash file.
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+struct HostFileImpl;
+
+// Host directory behind all stand-ins that persist to "flash"
+std::string hostFsRoot();
+bool hostMakeDirs(const std::string& path);
+
+class File : public Stream {
+private:
+  std::shared_ptr<HostFileImpl> impl;
+
+public:
+  File() {}
+  explicit File(std::shared_ptr<HostFileImpl> impl_ref) : impl(impl_ref) {}
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  size_t read(uint8_t* buffer, size_t size);
+  size_t readBytes(char* buffer, size_t length) override { return read(reinterpret_cast<uint8_t*>(buffer), length); }
+  int peek() override;
+  void flush() override;
+  bool seek(uint32_t pos);
+  size_t position() const;
+  size_t size() const;
+  void close();
+  operator bool() const { return impl != nullptr; }
+  const char* path() const;
+  const char* name() const;
+  bool isDirectory() const;
+  File openNextFile(const char* mode = FILE_READ);
+  void rewindDirectory();
+};
+
+class HostFS {
+private:
+  std::string subdir;  // Under hostFsRoot(), resolved per call so main() can still set it
+
+public:
+  explicit HostFS(const char* subdir);
+
+  std::string hostPath(const char* path) const;
+
+  File open(const char* path, const char* mode = FILE_READ, bool create = false);
+  File open(const String& path, const char* mode = FILE_READ, bool create = false) { return open(path.c_str(), mode, create); }
+  bool exists(const char* path);
+  bool exists(const String& path) { return exists(path.c_str()); }
+  bool remove(const char* path);
+  bool remove(const String& path) { return remove(path.c_str()); }
+  bool rename(const char* from, const char* to);
+  bool rename(const String& from, const String& to) { return rename(from.c_str(), to.c_str()); }
+  bool mkdir(const char* path);
+  bool mkdir(const String& path) { return mkdir(path.c_str()); }
+  bool rmdir(const char* path);
+  bool rmdir(const String& path) { return rmdir(path.c_str()); }
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Printable.h"
+#include "WString.h"
+#include <stdint.h>
+
+class IPAddress : public Printable {
+private:
+  uint8_t octets[4];
+
+public:
+  IPAddress() : octets{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets{a, b, c, d} {}
+  IPAddress(uint32_t address) {
+    for (int i = 0; i < 4; i++) octets[i] = (address >> (8 * i)) & 0xFF;
+  }
+
+  bool fromString(const char* address);
+  bool fromString(const String& address) { return fromString(address.c_str()); }
+  String toString() const;
+
+  operator uint32_t() const {
+    return octets[0] | (octets[1] << 8) | (octets[2] << 16) | ((uint32_t)octets[3] << 24);
+  }
+  bool operator==(const IPAddress& other) const { return (uint32_t)*this == (uint32_t)other; }
+  uint8_t operator[](int index) const { return octets[index]; }
+  uint8_t& operator[](int index) { return octets[index]; }
+  uint8_t* raw_address() { return octets; }
+
+  size_t printTo(Print& p) const override;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "FS.h"
+
+#define HOST_LITTLEFS_BYTES 0x110000  // spiffs partition in partitions.csv
+
+class LittleFSFS : public HostFS {
+public:
+  LittleFSFS() : HostFS("littlefs") {}
+
+  bool begin(bool formatOnFail = false, const char* basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+             const char* partitionLabel = "spiffs");
+  void end() {}
+  bool format();
+  size_t totalBytes() { return HOST_LITTLEFS_BYTES; }
+  size_t usedBytes();
+};
+
+extern LittleFSFS LittleFS;
@@ -0,0 +1,56 @@
+#pragma once
+
+// Host stand-in for the ESP32 NVS Preferences API. Each key is a file under
+// $HOST_FS_ROOT/nvs/<namespace>/, holding the raw bytes that were put.
+
+#include <Arduino.h>
+#include <string>
+
+class Preferences {
+private:
+  std::string directory;
+  bool readOnly;
+  bool started;
+
+  std::string keyPath(const char* key) const;
+  size_t putRaw(const char* key, const void* value, size_t length);
+  size_t getRaw(const char* key, void* buffer, size_t maxLength) const;
+
+  template <typename T>
+  T getValue(const char* key, T defaultValue) const {
+    T value;
+    return getRaw(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue;
+  }
+
+public:
+  Preferences() : readOnly(false), started(false) {}
+
+  bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+  void end() { started = false; }
+
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key) const;
+
+  size_t putBytes(const char* key, const void* value, size_t length) { return putRaw(key, value, length); }
+  size_t getBytesLength(const char* key) const;
+  size_t getBytes(const char* key, void* buffer, size_t maxLength) const { return getRaw(key, buffer, maxLength); }
+
+  size_t putUChar(const char* key, uint8_t value) { return putRaw(key, &value, sizeof(value)); }
+  size_t putUShort(const char* key, uint16_t value) { return putRaw(key, &value, sizeof(value)); }
+  size_t putInt(const char* key, int32_t value) { return putRaw(key, &value, sizeof(value)); }
+  size_t putUInt(const char* key, uint32_t value) { return putRaw(key, &value, sizeof(value)); }
+  size_t putULong64(const char* key, uint64_t value) { return putRaw(key, &value, sizeof(value)); }
+  size_t putFloat(const char* key, float value) { return putRaw(key, &value, sizeof(value)); }
+  size_t putBool(const char* key, bool value) { return putUChar(key, value ? 1 : 0); }
+  size_t putString(const char* key, const String& value) { return putRaw(key, value.c_str(), value.length()); }
+
+  uint8_t getUChar(const char* key, uint8_t defaultValue = 0) const { return getValue(key, defaultValue); }
+  uint16_t getUShort(const char* key, uint16_t defaultValue = 0) const { return getValue(key, defaultValue); }
+  int32_t getInt(const char* key, int32_t defaultValue = 0) const { return getValue(key, defaultValue); }
+  uint32_t getUInt(const char* key, uint32_t defaultValue = 0) const { return getValue(key, defaultValue); }
+  uint64_t getULong64(const char* key, uint64_t defaultValue = 0) const { return getValue(key, defaultValue); }
+  float getFloat(const char* key, float defaultValue = 0) const { return getValue(key, defaultValue); }
+  bool getBool(const char* key, bool defaultValue = false) const { return getUChar(key, defaultValue ? 1 : 0) != 0; }
+  String getString(const char* key, const String& defaultValue = String()) const;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Print.h"
+
+class Stream : public Print {
+protected:
+  unsigned long _timeout;
+  int timedRead();
+  int timedPeek();
+
+public:
+  Stream() : _timeout(1000) {}
+
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  unsigned long getTimeout() const { return _timeout; }
+
+  bool find(const char* target);
+  bool find(const char* target, size_t length);
+  bool findUntil(const char* target, const char* terminator);
+
+  virtual size_t readBytes(char* buffer, size_t length);
+  size_t readBytes(uint8_t* buffer, size_t length) { return readBytes(reinterpret_cast<char*>(buffer), length); }
+  size_t readBytesUntil(char terminator, char* buffer, size_t length);
+  long parseInt();
+
+  virtual String readString();
+  String readStringUntil(char terminator);
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+// Host stand-in for TinyGSM. Client connections do not go through the modem:
+// each one either opens a plain TCP socket to a local endpoint (TLS is not
+// emulated, so point it at a plain HTTP server or tools/ proxy) or plays back
+// scripted responses and records the request bytes, for runs that need no
+// network at all.
+//
+// The endpoint defaults to $HOST_NET_ENDPOINT ("host:port") when set;
+// otherwise connections are scripted.
+//
+// The modem API (testAT, SIM, registration, data attach) does speak AT over
+// the stream passed in, with the A76XX commands TinyGSM sends. Nothing
+// answers on Serial, so there every call times out; tests put an
+// AtResponder (at_responder.h) on the other end instead.
+
+#include <Arduino.h>
+#include <Client.h>
+#include <deque>
+#include <string>
+
+enum SimStatus { SIM_ERROR = 0, SIM_READY = 1, SIM_LOCKED = 2, SIM_ANTITHEFT_LOCKED = 3 };
+enum RegStatus { REG_NO_RESULT = -1, REG_UNREGISTERED = 0, REG_SEARCHING = 2, REG_DENIED = 3, REG_OK_HOME = 1, REG_OK_ROAMING = 5, REG_UNKNOWN = 4 };
+
+#define MODEM_NETWORK_AUTO 2
+
+class TinyGsm {
+private:
+  std::string endpointHost;
+  uint16_t endpointPort;
+  std::deque<std::string> responses;
+  std::string sentBytes;
+  uint32_t connects;
+  uint64_t bytesSent;
+  uint64_t bytesReceived;
+
+  friend class TinyGsmClient;
+
+public:
+  explicit TinyGsm(Stream& modemStream);
+  Stream& stream;
+
+  // Send every connection to host:port over plain TCP
+  void redirect(const char* host, uint16_t port);
+
+  // Queue a raw response (status line, headers, body) for the next request
+  // on a scripted connection; switches back from redirect()
+  void script(const String& response);
+  size_t scriptedPending() const { return responses.size(); }
+
+  // Request bytes written on scripted connections since the last clear
+  const std::string& sent() const { return sentBytes; }
+  void clearSent() { sentBytes.clear(); }
+  uint32_t getConnects() const { return connects; }
+
+  // Application bytes over all connections, scripted or not
+  uint64_t getBytesSent() const { return bytesSent; }
+  uint64_t getBytesReceived() const { return bytesReceived; }
+
+  // Send "AT<command>" and wait up to timeoutMs for OK or ERROR; the lines
+  // in between are appended to data. 1 = OK, 2 = ERROR, 0 = timeout.
+  int8_t sendAT(const String& command, uint32_t timeoutMs = 1000, String* data = nullptr);
+
+  bool testAT(uint32_t timeoutMs = 10000);
+  SimStatus getSimStatus(uint32_t timeoutMs = 10000);
+  RegStatus getRegistrationStatus();
+  bool isNetworkConnected();
+  bool setNetworkMode(uint8_t mode);
+  bool gprsConnect(const char* apn, const char* user = nullptr, const char* pwd = nullptr);
+  bool isGprsConnected();
+  int16_t getSignalQuality();
+  String getLocalIP();
+  bool poweroff();
+};
+
+class TinyGsmClient : public Client {
+private:
+  TinyGsm* modem;
+  int socketFd;
+  bool scriptOpen;
+  bool requestPending;     // Scripted: bytes written since the last response was loaded
+  std::string rx;
+  size_t rxPos;
+
+  bool fill();
+
+public:
+  TinyGsmClient();
+  explicit TinyGsmClient(TinyGsm& modem, uint8_t mux = 0);
+  ~TinyGsmClient();
+
+  bool init(TinyGsm* modem, uint8_t mux = 0);
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char* host, uint16_t port) override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int read(uint8_t* buffer, size_t size) override;
+  int peek() override;
+  void flush() override {}
+  void stop() override;
+  uint8_t connected() override;
+  operator bool() override { return connected(); }
+};
+
+// No TLS on the host: the secure client is the plain one
+class TinyGsmClientSecure : public TinyGsmClient {
+public:
+  TinyGsmClientSecure() {}
+  explicit TinyGsmClientSecure(TinyGsm& modem, uint8_t mux = 0) : TinyGsmClient(modem, mux) {}
+};
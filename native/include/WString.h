@@ -0,0 +1,128 @@
+#pragma once
+
+// Host stand-in for the Arduino String class, backed by std::string. Covers
+// the subset used by src/, ArduinoJson and ArduinoHttpClient.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+class String {
+private:
+  std::string buffer;
+
+public:
+  String() {}
+  String(const char* cstr) : buffer(cstr ? cstr : "") {}
+  String(const char* cstr, size_t length) : buffer(cstr ? cstr : "", cstr ? length : 0) {}
+  String(const __FlashStringHelper* fstr) : String(reinterpret_cast<const char*>(fstr)) {}
+  explicit String(const std::string& str) : buffer(str) {}
+  explicit String(char c) : buffer(1, c) {}
+  explicit String(unsigned char value, unsigned char base = 10);
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(long long value, unsigned char base = 10);
+  explicit String(unsigned long long value, unsigned char base = 10);
+  explicit String(float value, unsigned int decimalPlaces = 2);
+  explicit String(double value, unsigned int decimalPlaces = 2);
+
+  bool reserve(unsigned int size) { buffer.reserve(size); return true; }
+  unsigned int length() const { return buffer.length(); }
+  bool isEmpty() const { return buffer.empty(); }
+  const char* c_str() const { return buffer.c_str(); }
+  char* begin() { return &buffer[0]; }
+  char* end() { return &buffer[0] + buffer.length(); }
+  const std::string& str() const { return buffer; }
+
+  bool concat(const String& s) { buffer += s.buffer; return true; }
+  bool concat(const char* cstr) { if (!cstr) return false; buffer += cstr; return true; }
+  bool concat(const char* cstr, unsigned int length) { if (!cstr) return false; buffer.append(cstr, length); return true; }
+  bool concat(char c) { buffer += c; return true; }
+  bool concat(unsigned char value) { return concat(String(value)); }
+  bool concat(int value) { return concat(String(value)); }
+  bool concat(unsigned int value) { return concat(String(value)); }
+  bool concat(long value) { return concat(String(value)); }
+  bool concat(unsigned long value) { return concat(String(value)); }
+  bool concat(long long value) { return concat(String(value)); }
+  bool concat(unsigned long long value) { return concat(String(value)); }
+  bool concat(float value) { return concat(String(value)); }
+  bool concat(double value) { return concat(String(value)); }
+  bool concat(const __FlashStringHelper* fstr) { return concat(reinterpret_cast<const char*>(fstr)); }
+
+  template <typename T>
+  String& operator+=(const T& value) { concat(value); return *this; }
+
+  int compareTo(const String& s) const { return buffer.compare(s.buffer); }
+  bool equals(const String& s) const { return buffer == s.buffer; }
+  bool equals(const char* cstr) const { return buffer == (cstr ? cstr : ""); }
+  bool equalsIgnoreCase(const String& s) const;
+  bool operator==(const String& s) const { return equals(s); }
+  bool operator==(const char* cstr) const { return equals(cstr); }
+  bool operator!=(const String& s) const { return !equals(s); }
+  bool operator!=(const char* cstr) const { return !equals(cstr); }
+  bool operator<(const String& s) const { return buffer < s.buffer; }
+  bool operator>(const String& s) const { return buffer > s.buffer; }
+  bool operator<=(const String& s) const { return buffer <= s.buffer; }
+  bool operator>=(const String& s) const { return buffer >= s.buffer; }
+  bool startsWith(const String& prefix) const { return buffer.compare(0, prefix.buffer.length(), prefix.buffer) == 0; }
+  bool startsWith(const String& prefix, unsigned int offset) const;
+  bool endsWith(const String& suffix) const;
+
+  char charAt(unsigned int index) const { return index < buffer.length() ? buffer[index] : 0; }
+  void setCharAt(unsigned int index, char c) { if (index < buffer.length()) buffer[index] = c; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char& operator[](unsigned int index) { return buffer[index]; }
+  void getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index = 0) const;
+  void toCharArray(char* buf, unsigned int bufsize, unsigned int index = 0) const {
+    getBytes(reinterpret_cast<unsigned char*>(buf), bufsize, index);
+  }
+
+  int indexOf(char c, unsigned int fromIndex = 0) const;
+  int indexOf(const String& s, unsigned int fromIndex = 0) const;
+  int lastIndexOf(char c) const;
+  int lastIndexOf(char c, unsigned int fromIndex) const;
+  int lastIndexOf(const String& s) const;
+  int lastIndexOf(const String& s, unsigned int fromIndex) const;
+  String substring(unsigned int beginIndex) const { return substring(beginIndex, buffer.length()); }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+  void replace(char find, char replacement);
+  void replace(const String& find, const String& replacement);
+  void remove(unsigned int index) { remove(index, (unsigned int)-1); }
+  void remove(unsigned int index, unsigned int count);
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+
+  long toInt() const;
+  float toFloat() const;
+  double toDouble() const;
+};
+
+// Concatenation always yields a new String, like the Arduino StringSumHelper
+template <typename T>
+inline String operator+(const String& lhs, const T& rhs) {
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+inline String operator+(const char* lhs, const String& rhs) {
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+inline String operator+(char lhs, const String& rhs) {
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+inline bool operator==(const char* lhs, const String& rhs) { return rhs.equals(lhs); }
+inline bool operator!=(const char* lhs, const String& rhs) { return !rhs.equals(lhs); }
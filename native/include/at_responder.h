@@ -0,0 +1,83 @@
+#pragma once
+
+// Scripted modem end of an AT link, for driving TinyGsm (and ModemManager on
+// top of it) without hardware. Give it to TinyGsm as its stream. Each
+// command line written to it is matched against the script and the reply
+// becomes readable once its latency has passed on millis(), so runs under
+// hostUseManualClock() take no real time.
+//
+// One rule per script line, matched in order on the exact command:
+//
+//     <command> [xN] [+Nms] => <reply line>|<reply line>...
+//
+//     AT => OK
+//     AT+CPIN? +40ms => +CPIN: READY|OK
+//     AT+CGREG? x3 => +CGREG: 0,2|OK       first three polls only
+//     AT+CGREG? => +CGREG: 0,1|OK
+//     AT+CGACT=1,1 =>                      never answers
+//
+// A rule with xN is used up after N matches; later rules take over. A
+// command no rule matches gets ERROR. Until powerKey() has been pressed and
+// the boot time has passed the modem is off and ignores everything.
+
+#include <Arduino.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+class AtResponder : public Stream {
+public:
+  struct Command {
+    unsigned long atMs;
+    std::string line;
+  };
+
+private:
+  struct Rule {
+    std::string command;
+    std::string reply;         // CRLF-terminated lines; empty = no answer
+    uint32_t remaining;        // 0 = unlimited
+    unsigned long latencyMs;
+  };
+
+  struct Pending {
+    unsigned long readyAtMs;
+    std::string bytes;
+  };
+
+  std::vector<Rule> rules;
+  std::deque<Pending> replies;
+  std::string line;
+  std::vector<Command> received;
+  unsigned long bootMs;
+  unsigned long onAtMs;
+  bool powered;
+  uint32_t powerKeyPresses;
+
+  void handle(const std::string& command);
+
+public:
+  explicit AtResponder(unsigned long bootMs = 3000);
+
+  // Append rules; returns false (and keeps the valid lines) on a bad line
+  bool script(const char* text);
+  void clearScript();
+
+  // Board side: the power key starts a boot of bootMs, power loss stops it
+  void powerKey();
+  void powerOff();
+  void setBootMs(unsigned long ms) { bootMs = ms; }
+  bool isAnswering() const;
+  uint32_t getPowerKeyPresses() const { return powerKeyPresses; }
+
+  // Every command line received while powered, with its arrival time
+  const std::vector<Command>& commands() const { return received; }
+  size_t count(const char* command) const;
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+};
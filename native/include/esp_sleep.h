@@ -0,0 +1,7 @@
+#pragma once
+
+#include <esp_partition.h>
+#include <stdint.h>
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t timeUs);
+esp_err_t esp_light_sleep_start();
@@ -0,0 +1,35 @@
+#pragma once
+
+// Host stand-in for the FreeRTOS kernel: one tick is one millisecond,
+// tasks are std::threads and mutexes are std::timed_mutex. Only the calls
+// the host-built modules make are provided.
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int32_t BaseType_t;
+typedef uint32_t UBaseType_t;
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdTICKS_TO_MS(ticks) ((uint32_t)(ticks))
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+struct HostSpinlock {
+  volatile int flag;
+};
+typedef HostSpinlock portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+
+void hostSpinEnter(portMUX_TYPE* mux);
+void hostSpinExit(portMUX_TYPE* mux);
+
+#define portENTER_CRITICAL(mux) hostSpinEnter(mux)
+#define portEXIT_CRITICAL(mux) hostSpinExit(mux)
+#define portENTER_CRITICAL_ISR(mux) hostSpinEnter(mux)
+#define portEXIT_CRITICAL_ISR(mux) hostSpinExit(mux)
@@ -0,0 +1,206 @@
+// End-to-end link run: drives DeviceDB, AddressDB and ProfileDB against
+// tools/test_server.py, normally through tools/link_shaper.py, and reports
+// samples per second, bytes per sample and latency percentiles per call.
+//
+// Usage: HOST_NET_ENDPOINT=127.0.0.1:8081 program [samples] [results.json]
+
+#include "../../src/configs.h"
+#include "../../src/Database/address.h"
+#include "../../src/Database/device_db.h"
+#include "../../src/Database/profile.h"
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <TinyGsmClient.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#define LINK_DEFAULT_SAMPLES 50
+#define LINK_HEARTBEAT_EVERY 10
+#define LINK_RESULTS_PATH "link_results.json"
+
+TinyGsm modem(Serial);
+TinyGsmClientSecure client(modem);
+
+struct CallStats {
+  std::vector<unsigned long> latencyMs;
+  uint32_t failures = 0;
+};
+
+static std::map<String, CallStats> calls;
+
+// Time one API call; ok says whether its status was a success
+template <typename Call>
+static void timed(const char* name, Call call) {
+  unsigned long start = millis();
+  bool ok = call();
+  CallStats& stats = calls[name];
+  stats.latencyMs.push_back(millis() - start);
+  if (!ok) {
+    stats.failures++;
+  }
+}
+
+static unsigned long percentile(std::vector<unsigned long> values, double p) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  size_t index = (size_t)(p * (values.size() - 1) + 0.5);
+  return values[index];
+}
+
+static String firstCode(const String& body, const char* level, const char* field) {
+  JsonDocument doc;
+  if (deserializeJson(doc, body)) {
+    return String();
+  }
+  return doc["data"][level][0][field] | "";
+}
+
+static DeviceData frameFor(const String& deviceId, int sample) {
+  DeviceData data;
+  data.deviceId = deviceId;
+  data.isOnline = true;
+  data.cpuTemperature = 47.5;
+  data.cpuFrequency = 80;
+  data.ramUsage = 36.8;
+  data.storageUsage = 41.2;
+  data.signalStrength = -73;
+  data.batteryVoltage = 3.95;
+  data.batteryPercentage = 68.7;
+  data.batteryStatus = "medium";
+  data.uptimeMs = millis();
+  data.tof = 400 + sample % 20;
+  data.force0 = 0.6;
+  data.force1 = 0.58;
+  data.weight = 3.2 + sample * 0.01;
+  data.turbidity = 810;
+  data.ultrasonic = 38.5;
+  data.deviceStatus["modem"] = "connected";
+  data.deviceStatus["sensors"] = "active";
+  data.deviceStatus["power"] = "normal";
+  data.moduleStatus["tof"] = "online";
+  data.moduleStatus["weight"] = "online";
+  data.deviceOtherData["free_heap"] = "184320";
+  data.moduleOtherData["weight_raw"] = String(-84213 + sample);
+  return data;
+}
+
+int main(int argc, char** argv) {
+  int samples = argc > 1 ? atoi(argv[1]) : LINK_DEFAULT_SAMPLES;
+  const char* resultsPath = argc > 2 ? argv[2] : LINK_RESULTS_PATH;
+  if (!getenv("HOST_NET_ENDPOINT")) {
+    Serial.println("✗ Set HOST_NET_ENDPOINT=host:port (tools/test_server.py or tools/link_shaper.py)");
+    return 2;
+  }
+
+  // Start from empty caches so address and profile calls reach the server
+  LittleFS.begin(true);
+  LittleFS.format();
+
+  DeviceDB deviceDB(&modem, &client);
+  AddressDB addressDB(&modem, &client);
+  ProfileDB profileDB(&modem, &client);
+  String deviceId = "c1d2e3f4-a5b6-4789-8abc-def012345678";
+
+  AddressLocation location = createAddress("PH", "Philippines", "130000000", "NCR", "137400000",
+                                           "NCR, Second District", "137404000", "Quezon City",
+                                           "137404001", "Alicia", "1105", "Mabini Street");
+  Device device = createDevice(deviceId, "Link Test Drain", "9f8e7d6c-5b4a-4392-8170-6f5e4d3c2b1a", location, true);
+
+  ProvisionResult provision;
+  timed("provision", [&]() {
+    return deviceDB.provisionDevice("installer@smartecodrain.ph", "secret", device, provision);
+  });
+  timed("setup_status", [&]() {
+    String response;
+    return deviceDB.checkDeviceSetup(deviceId, response) == 200;
+  });
+
+  String regions, provinces, cities;
+  timed("address_regions", [&]() { regions = addressDB.getAddressDropdownData(); return !regions.isEmpty(); });
+  String regCode = firstCode(regions, "regions", "reg_code");
+  timed("address_provinces", [&]() { provinces = addressDB.getAddressDropdownData(regCode); return !provinces.isEmpty(); });
+  String provCode = firstCode(provinces, "provinces", "prov_code");
+  timed("address_cities", [&]() { cities = addressDB.getAddressDropdownData(regCode, provCode); return !cities.isEmpty(); });
+  String cityCode = firstCode(cities, "cities", "citymun_code");
+  timed("address_barangays", [&]() {
+    return !addressDB.getAddressDropdownData(regCode, provCode, cityCode).isEmpty();
+  });
+  timed("owner_list", [&]() { return profileDB.refreshOwnerList(); });
+  timed("owner_list_revalidate", [&]() { return profileDB.refreshOwnerList(); });
+
+  uint64_t sentBefore = modem.getBytesSent();
+  uint64_t receivedBefore = modem.getBytesReceived();
+  uint32_t connectsBefore = modem.getConnects();
+  unsigned long loopStart = millis();
+  for (int i = 0; i < samples; i++) {
+    DeviceData frame = frameFor(deviceId, i);
+    timed("device_data", [&]() {
+      int status = deviceDB.createDeviceData(frame);
+      return status == 200 || status == 201;
+    });
+    if ((i + 1) % LINK_HEARTBEAT_EVERY == 0) {
+      timed("heartbeat", [&]() { return deviceDB.sendHeartbeat(deviceId) == 200; });
+    }
+  }
+  unsigned long loopMs = millis() - loopStart;
+  double bytesUp = samples ? (double)(modem.getBytesSent() - sentBefore) / samples : 0;
+  double bytesDown = samples ? (double)(modem.getBytesReceived() - receivedBefore) / samples : 0;
+  double samplesPerSecond = loopMs ? samples * 1000.0 / loopMs : 0;
+
+  JsonDocument doc;
+  doc["schema"] = 1;
+  doc["suite"] = "link";
+  doc["endpoint"] = getenv("HOST_NET_ENDPOINT");
+  doc["samples"] = samples;
+  doc["sample_loop_ms"] = loopMs;
+  doc["samples_per_second"] = serialized(String(samplesPerSecond, 3));
+  doc["bytes_up_per_sample"] = serialized(String(bytesUp, 1));
+  doc["bytes_down_per_sample"] = serialized(String(bytesDown, 1));
+  doc["connections"] = modem.getConnects() - connectsBefore;
+  doc["provision_connect_ms"] = provision.connectMs;
+  doc["provision_reused_connection"] = provision.reusedConnection;
+
+  Serial.println();
+  Serial.printf("%-24s %6s %6s %8s %8s %8s %8s\n", "call", "count", "fail", "p50 ms", "p90 ms", "p99 ms", "max ms");
+  JsonObject callsOut = doc["calls"].to<JsonObject>();
+  for (const auto& entry : calls) {
+    const CallStats& stats = entry.second;
+    unsigned long p50 = percentile(stats.latencyMs, 0.50);
+    unsigned long p90 = percentile(stats.latencyMs, 0.90);
+    unsigned long p99 = percentile(stats.latencyMs, 0.99);
+    unsigned long maxMs = percentile(stats.latencyMs, 1.0);
+    Serial.printf("%-24s %6u %6u %8lu %8lu %8lu %8lu\n", entry.first.c_str(), (unsigned)stats.latencyMs.size(),
+                  stats.failures, p50, p90, p99, maxMs);
+
+    JsonObject out = callsOut[entry.first].to<JsonObject>();
+    out["count"] = stats.latencyMs.size();
+    out["failures"] = stats.failures;
+    out["p50_ms"] = p50;
+    out["p90_ms"] = p90;
+    out["p99_ms"] = p99;
+    out["max_ms"] = maxMs;
+  }
+  Serial.printf("%.3f samples/s, %.0f B up + %.0f B down per sample, %u connections\n",
+                samplesPerSecond, bytesUp, bytesDown, (unsigned)(modem.getConnects() - connectsBefore));
+
+  String json;
+  serializeJsonPretty(doc, json);
+  FILE* fp = fopen(resultsPath, "w");
+  if (!fp || fwrite(json.c_str(), 1, json.length(), fp) != json.length()) {
+    Serial.printf("✗ Cannot write %s\n", resultsPath);
+    if (fp) fclose(fp);
+    return 1;
+  }
+  fclose(fp);
+  Serial.printf("✓ Results written to %s\n", resultsPath);
+
+  uint32_t failures = 0;
+  for (const auto& entry : calls) {
+    failures += entry.second.failures;
+  }
+  return failures ? 1 : 0;
+}
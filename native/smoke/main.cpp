@@ -0,0 +1,370 @@
+// Host smoke run for the native environment: checks the clock, task, queue,
+// file and partition stand-ins, serializes a frame, posts it through
+// DeviceDB against a scripted response, persists config to the fake NVS,
+// checks the scheduler's ordering, timing and wake-ups and the stage
+// watchdog's overrun and hang handling. Exits non-zero if any step fails.
+
+#include "../../src/configs.h"
+#include "../../src/Database/device.h"
+#include "../../src/Database/device_db.h"
+#include "../../src/Sensors/conversion.h"
+#include "../../src/Storage/config_store.h"
+#include "../../src/Utils/scheduler.h"
+#include "../../src/Utils/stage_watchdog.h"
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <TinyGsmClient.h>
+#include <esp_partition.h>
+#include <freertos/queue.h>
+#include <atomic>
+#include <thread>
+
+TinyGsm modem(Serial);
+TinyGsmClientSecure client(modem);
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+  Serial.printf("%s %s\n", ok ? "✓" : "✗", what);
+  if (!ok) {
+    failures++;
+  }
+}
+
+// The stand-ins the rest of the run leans on: clock, tasks, queues, files
+static void hostClock() {
+  hostUseManualClock(true);
+  unsigned long startMs = millis();
+  TickType_t startTick = xTaskGetTickCount();
+  delay(250);
+  vTaskDelay(pdMS_TO_TICKS(50));
+  check(millis() - startMs == 300 && xTaskGetTickCount() - startTick == 300,
+        "manual clock moves only on delay(), in 1 ms ticks");
+
+  // Work shorter than the period keeps the cadence; an overrun does not sleep
+  TickType_t wake = xTaskGetTickCount();
+  hostAdvanceClock(30);
+  vTaskDelayUntil(&wake, 100);
+  bool cadence = millis() - startMs == 400;
+  hostAdvanceClock(150);
+  vTaskDelayUntil(&wake, 100);
+  check(cadence && millis() - startMs == 550, "vTaskDelayUntil keeps the period and skips the sleep when late");
+  hostUseManualClock(false);
+}
+
+static std::atomic<bool> pastDelete(false);
+
+static void selfDeletingTask(void* arg) {
+  xTaskNotifyGive(*(TaskHandle_t*)arg);
+  vTaskDelete(nullptr);
+  pastDelete = true;
+}
+
+static QueueHandle_t senderQueue = nullptr;
+
+// Tells the creator when it is done, so the queue is not deleted under it
+static void queueSender(void* arg) {
+  delay(20);
+  uint32_t value = 42;
+  xQueueSend(senderQueue, &value, portMAX_DELAY);
+  xTaskNotifyGive(*(TaskHandle_t*)arg);
+  vTaskDelete(nullptr);
+}
+
+static void hostTasks() {
+  QueueHandle_t queue = xQueueCreate(2, sizeof(uint32_t));
+  uint32_t values[] = {1, 2, 3};
+  bool sent = xQueueSend(queue, &values[0], 0) == pdTRUE && xQueueSend(queue, &values[1], 0) == pdTRUE;
+  check(sent && xQueueSend(queue, &values[2], 0) != pdTRUE && uxQueueMessagesWaiting(queue) == 2,
+        "queue holds its length and refuses the next item");
+  uint32_t first = 0;
+  uint32_t second = 0;
+  xQueueReceive(queue, &first, 0);
+  xQueueReceive(queue, &second, 0);
+  check(first == 1 && second == 2, "queue is FIFO");
+
+  unsigned long start = millis();
+  uint32_t value = 0;
+  bool timedOut = xQueueReceive(queue, &value, pdMS_TO_TICKS(30)) != pdTRUE;
+  check(timedOut && millis() - start >= 30, "receive on an empty queue waits out its timeout");
+
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  senderQueue = queue;
+  xTaskCreate(queueSender, "sender", 2048, &self, 1, nullptr);
+  start = millis();
+  bool received = xQueueReceive(queue, &value, pdMS_TO_TICKS(1000)) == pdTRUE;
+  check(received && value == 42 && millis() - start < 500, "blocked receive wakes when another task sends");
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  vQueueDelete(queue);
+
+  xTaskNotifyGive(self);
+  xTaskNotifyGive(self);
+  uint32_t counted = ulTaskNotifyTake(pdFALSE, 0);
+  uint32_t rest = ulTaskNotifyTake(pdTRUE, 0);
+  check(counted == 2 && rest == 1 && ulTaskNotifyTake(pdTRUE, 0) == 0, "notifications count and clear");
+
+  xTaskCreate(selfDeletingTask, "deleter", 2048, &self, 1, nullptr);
+  bool notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000)) == 1;
+  delay(20);
+  check(notified && !pastDelete, "vTaskDelete(nullptr) ends the calling task");
+}
+
+static void hostFiles() {
+  File file = LittleFS.open("/smoke.txt", FILE_WRITE);
+  file.print("first");
+  file.close();
+  file = LittleFS.open("/smoke.txt", FILE_APPEND);
+  file.print(" second");
+  file.close();
+
+  file = LittleFS.open("/smoke.txt", FILE_READ);
+  char text[32] = {};
+  size_t length = file.readBytes(text, sizeof(text) - 1);
+  file.close();
+  check(length == 12 && strcmp(text, "first second") == 0, "file write then append reads back");
+
+  bool renamed = LittleFS.rename("/smoke.txt", "/smoke2.txt");
+  check(renamed && !LittleFS.exists("/smoke.txt") && LittleFS.exists("/smoke2.txt"), "rename moves the file");
+  check(LittleFS.remove("/smoke2.txt") && !LittleFS.exists("/smoke2.txt"), "remove deletes the file");
+
+  // Data partitions are files under partitions/; reads and mmap see the same bytes
+  std::string imagePath = hostFsRoot() + "/partitions/smoke.bin";
+  hostMakeDirs(hostFsRoot() + "/partitions");
+  FILE* image = fopen(imagePath.c_str(), "wb");
+  fwrite("0123456789", 1, 10, image);
+  fclose(image);
+  const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)0x40, "smoke");
+  char bytes[4] = {};
+  const void* mapped = nullptr;
+  esp_partition_mmap_handle_t handle;
+  bool read = partition && partition->size == 10 && esp_partition_read(partition, 2, bytes, 3) == ESP_OK;
+  bool mappedOk = partition && esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &mapped, &handle) == ESP_OK;
+  check(read && strcmp(bytes, "234") == 0 && mappedOk && memcmp(mapped, "0123456789", 10) == 0,
+        "data partition reads and maps from its image file");
+  if (mappedOk) {
+    esp_partition_munmap(handle);
+  }
+  remove(imagePath.c_str());
+  check(esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)0x40, "smoke") == nullptr,
+        "partition without an image file is not found");
+}
+
+static DeviceData sampleFrame() {
+  SampleRecord record = {};
+  record.timestampMs = millis();
+  record.tof = 412.0;
+  record.force0 = forceFromAdc(1800);
+  record.force1 = forceFromAdc(2100);
+  record.weight = 3.25;
+  record.turbidity = turbidityFromAdc(3400);
+  record.ultrasonic = distanceFromEcho(2400);
+  record.batteryVoltage = 3.92;
+
+  DeviceData data;
+  data.deviceId = "host-device";
+  data.isOnline = true;
+  applySampleRecord(record, data);
+  data.batteryPercentage = getBatteryPercentage(data.batteryVoltage);
+  data.batteryStatus = batteryStatusFor(data.batteryVoltage);
+  data.deviceStatus["modem"] = "host";
+  data.moduleStatus["weight"] = "online";
+  return data;
+}
+
+static void serializationRoundTrip(const DeviceData& data) {
+  String json = createDeviceDataJSON(data);
+  JsonDocument doc;
+  check(deserializeJson(doc, json) == DeserializationError::Ok, "device data JSON parses");
+  DeviceData parsed = parseDeviceDataJSON(doc);
+  check(parsed.deviceId == data.deviceId && parsed.weight == data.weight &&
+        parsed.batteryStatus == data.batteryStatus, "device data survives a round trip");
+}
+
+static void scriptedPost(const DeviceData& data) {
+  modem.script("HTTP/1.1 201 Created\r\nContent-Type: application/json\r\nContent-Length: 2\r\n\r\n{}");
+  DeviceDB db(&modem, &client);
+  int status = db.createDeviceData(data);
+  check(status == 201, "device data POST returns 201");
+  const std::string& request = modem.sent();
+  check(request.compare(0, 22, "POST /api/device-data ") == 0, "request line is POST /api/device-data");
+  Serial.printf("  %u request bytes, %u payload bytes\n", (unsigned)request.size(), (unsigned)db.getLastPayloadBytes());
+}
+
+static void configPersists() {
+  configStore.begin();
+  configStore.setDeviceId("host-device");
+  configStore.setSetupCompleted(true);
+  check(configStore.commit(), "config commits to NVS");
+
+  ConfigStore reloaded;
+  reloaded.begin();
+  check(reloaded.getDeviceId() == "host-device" && reloaded.isSetupCompleted(), "config reloads from NVS");
+}
+
+static void schedulerRuns() {
+  scheduler.begin();
+  int fast = 0;
+  int slow = 0;
+  bool once = false;
+  int fastJob = scheduler.every("fast", 10, [&fast]() { fast++; });
+  int slowJob = scheduler.every("slow", 50, [&slow]() { slow++; });
+  scheduler.after("once", 30, [&once]() { once = true; });
+
+  unsigned long start = millis();
+  while (millis() - start < 200) {
+    scheduler.wait(scheduler.runDue());
+  }
+  scheduler.cancel(fastJob);
+  scheduler.cancel(slowJob);
+  Serial.printf("  fast=%d slow=%d\n", fast, slow);
+  check(fast >= 15 && slow >= 3 && once, "scheduler runs periodic and one-shot jobs");
+}
+
+// Exact timing on the manual clock, on a scheduler of its own
+static void schedulerTiming() {
+  hostUseManualClock(true);
+  Scheduler local;
+  local.begin();
+
+  String order;
+  local.after("low", 5, [&order]() { order += "L"; }, SCHED_PRIORITY_LOW);
+  local.after("high", 5, [&order]() { order += "H"; }, SCHED_PRIORITY_HIGH);
+  local.after("normal", 5, [&order]() { order += "N"; });
+  check(local.runDue() == 5, "sleep budget is the time to the next job");
+  hostAdvanceClock(5);
+  local.runDue();
+  check(order == "HNL", "jobs due together run highest priority first");
+
+  // Past one turn of the wheel, and past the longest sleep
+  int farJob = local.after("far", SCHEDULER_WHEEL_SLOTS * SCHEDULER_TICK_MS + 100, []() {});
+  check(local.runDue() == SCHEDULER_WHEEL_SLOTS * SCHEDULER_TICK_MS + 100, "next job found a wheel turn ahead");
+  local.cancel(farJob);
+  int idleJob = local.after("idle", SCHEDULER_MAX_SLEEP_MS * 5, []() {});
+  check(local.runDue() == SCHEDULER_MAX_SLEEP_MS, "sleep capped at SCHEDULER_MAX_SLEEP_MS");
+  local.cancel(idleJob);
+
+  // Sleeping exactly the returned budget runs a periodic job on time
+  int runs = 0;
+  int tickJob = local.every("tick", 10, [&runs]() { runs++; });
+  unsigned long start = millis();
+  while (millis() - start < 100) {
+    hostAdvanceClock(local.runDue());
+    local.runDue();
+  }
+  check(runs == 10, "periodic job runs once per period");
+
+  // A blocked loop skips the missed periods instead of catching up
+  hostAdvanceClock(55);
+  int before = runs;
+  check(local.runDue() == 10 && runs == before + 1, "missed periods are skipped");
+  local.cancel(tickJob);
+
+  // Callbacks may reschedule themselves and cancel other jobs
+  int bounces = 0;
+  int victimRuns = 0;
+  int victim = local.after("victim", 20, [&victimRuns]() { victimRuns++; });
+  int bounce = -1;
+  bounce = local.after("bounce", 0, [&]() {
+    bounces++;
+    local.cancel(victim);
+    if (bounces < 3) {
+      local.reschedule(bounce, 3);
+    }
+  });
+  for (int i = 0; i < 10; i++) {
+    local.runDue();
+    hostAdvanceClock(5);
+  }
+  check(bounces == 3 && victimRuns == 0, "callbacks reschedule themselves and cancel others");
+
+  std::map<String, String> counters;
+  local.appendCounters(counters);
+  check(counters.count("sched_bounce_runs") == 0 && counters.count("sched_tick_runs") == 0,
+        "finished and cancelled jobs leave the counters");
+  hostUseManualClock(false);
+}
+
+// A job added from another task wakes the sleeping owner
+static void schedulerWakes() {
+  Scheduler local;
+  local.begin();
+  bool ran = false;
+  std::thread other([&local, &ran]() {
+    delay(20);
+    local.after("remote", 0, [&ran]() { ran = true; });
+  });
+  unsigned long start = millis();
+  local.wait(local.runDue());
+  unsigned long waitedMs = millis() - start;
+  local.runDue();
+  other.join();
+  Serial.printf("  woke after %lu ms\n", waitedMs);
+  check(ran && waitedMs < SCHEDULER_MAX_SLEEP_MS / 2, "job added from another task wakes the owner");
+}
+
+static std::atomic<int> conditionRecoveries(0);
+
+// Expects the stuck run to return by itself, as the sampler's reads do
+static bool waitForCondition() {
+  conditionRecoveries++;
+  return false;
+}
+
+// Real clock: the monitor wakes every WATCHDOG_CHECK_MS, so this takes a
+// couple of seconds
+static void watchdogRecovers() {
+  check(stageWatchdog.begin(), "watchdog monitor starts");
+
+  stageWatchdog.enter(WATCHDOG_CONDITION);
+  delay(WATCHDOG_CONDITION_BUDGET_MS + 50);
+  bool recovered = stageWatchdog.leave(WATCHDOG_CONDITION);
+  std::map<String, String> counters;
+  stageWatchdog.appendCounters(counters);
+  check(!recovered && counters["wd_condition_overruns"] == "1" &&
+        counters["wd_condition_max_ms"].toInt() >= WATCHDOG_CONDITION_BUDGET_MS + 50,
+        "run over budget counted as an overrun");
+
+  // Held past the hang point: the hook fires while the run is still going
+  // and leave() reports it, which is how the sampler knows to drop a read
+  stageWatchdog.setRecovery(WATCHDOG_CONDITION, waitForCondition);
+  stageWatchdog.enter(WATCHDOG_CONDITION);
+  unsigned long start = millis();
+  while (conditionRecoveries == 0 && millis() - start < WATCHDOG_CONDITION_BUDGET_MS * WATCHDOG_HANG_FACTOR * 3) {
+    delay(10);
+  }
+  unsigned long stuckMs = millis() - start;
+  recovered = stageWatchdog.leave(WATCHDOG_CONDITION);
+  counters.clear();
+  stageWatchdog.appendCounters(counters);
+  Serial.printf("  recovery fired after %lu ms\n", stuckMs);
+  check(conditionRecoveries == 1 && stuckMs >= WATCHDOG_CONDITION_BUDGET_MS * WATCHDOG_HANG_FACTOR,
+        "hung run recovered once past the hang point");
+  check(recovered && counters["wd_condition_recoveries"] == "1" && counters["wd_condition_overruns"] == "2",
+        "leave() reports the recovery to the stuck task");
+
+  // A clean run clears the streak that would end in a restart
+  stageWatchdog.enter(WATCHDOG_CONDITION);
+  check(!stageWatchdog.leave(WATCHDOG_CONDITION), "next clean run is not flagged");
+  stageWatchdog.setRecovery(WATCHDOG_CONDITION, nullptr);
+}
+
+int main() {
+  LittleFS.begin(true);
+
+  hostClock();
+  hostTasks();
+  hostFiles();
+
+  DeviceData data = sampleFrame();
+  serializationRoundTrip(data);
+  scriptedPost(data);
+  configPersists();
+  schedulerRuns();
+  schedulerTiming();
+  schedulerWakes();
+  watchdogRecovers();
+
+  Serial.printf("%s host smoke run: %d failure(s)\n", failures ? "✗" : "✓", failures);
+  return failures ? 1 : 0;
+}
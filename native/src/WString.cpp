@@ -0,0 +1,174 @@
+#include <WString.h>
+#include <algorithm>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+  if (base < 2 || base > 36) {
+    base = 10;
+  }
+  char digits[66];
+  int pos = sizeof(digits) - 1;
+  digits[pos] = '\0';
+  do {
+    unsigned digit = value % base;
+    digits[--pos] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+    value /= base;
+  } while (value != 0);
+  if (negative) {
+    digits[--pos] = '-';
+  }
+  return std::string(digits + pos);
+}
+
+// Arduino prints negative values in other bases as their two's complement
+static std::string formatSigned(long long value, unsigned char base, unsigned long long mask) {
+  if (base == 10) {
+    return value < 0 ? formatInteger(0ULL - (unsigned long long)value, true, 10) : formatInteger(value, false, 10);
+  }
+  return formatInteger((unsigned long long)value & mask, false, base);
+}
+
+String::String(unsigned char value, unsigned char base) : buffer(formatInteger(value, false, base)) {}
+String::String(int value, unsigned char base) : buffer(formatSigned(value, base, 0xFFFFFFFFULL)) {}
+String::String(unsigned int value, unsigned char base) : buffer(formatInteger(value, false, base)) {}
+String::String(long value, unsigned char base) : buffer(formatSigned(value, base, ~0ULL)) {}
+String::String(unsigned long value, unsigned char base) : buffer(formatInteger(value, false, base)) {}
+String::String(long long value, unsigned char base) : buffer(formatSigned(value, base, ~0ULL)) {}
+String::String(unsigned long long value, unsigned char base) : buffer(formatInteger(value, false, base)) {}
+
+String::String(float value, unsigned int decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned int decimalPlaces) {
+  char text[64];
+  snprintf(text, sizeof(text), "%.*f", (int)decimalPlaces, value);
+  buffer = text;
+}
+
+bool String::equalsIgnoreCase(const String& s) const {
+  if (buffer.length() != s.buffer.length()) {
+    return false;
+  }
+  for (size_t i = 0; i < buffer.length(); i++) {
+    if (tolower((unsigned char)buffer[i]) != tolower((unsigned char)s.buffer[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const {
+  if (offset > buffer.length()) {
+    return false;
+  }
+  return buffer.compare(offset, prefix.buffer.length(), prefix.buffer) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+  if (suffix.buffer.length() > buffer.length()) {
+    return false;
+  }
+  return buffer.compare(buffer.length() - suffix.buffer.length(), suffix.buffer.length(), suffix.buffer) == 0;
+}
+
+void String::getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index) const {
+  if (!buf || bufsize == 0) {
+    return;
+  }
+  size_t n = 0;
+  if (index < buffer.length()) {
+    n = std::min((size_t)bufsize - 1, buffer.length() - index);
+    memcpy(buf, buffer.data() + index, n);
+  }
+  buf[n] = '\0';
+}
+
+static int toIndex(size_t pos) {
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(char c, unsigned int fromIndex) const {
+  return toIndex(buffer.find(c, fromIndex));
+}
+
+int String::indexOf(const String& s, unsigned int fromIndex) const {
+  return toIndex(buffer.find(s.buffer, fromIndex));
+}
+
+int String::lastIndexOf(char c) const {
+  return toIndex(buffer.rfind(c));
+}
+
+int String::lastIndexOf(char c, unsigned int fromIndex) const {
+  return toIndex(buffer.rfind(c, fromIndex));
+}
+
+int String::lastIndexOf(const String& s) const {
+  return toIndex(buffer.rfind(s.buffer));
+}
+
+int String::lastIndexOf(const String& s, unsigned int fromIndex) const {
+  return toIndex(buffer.rfind(s.buffer, fromIndex));
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+  if (beginIndex > endIndex) {
+    std::swap(beginIndex, endIndex);
+  }
+  if (beginIndex >= buffer.length()) {
+    return String();
+  }
+  endIndex = std::min(endIndex, (unsigned int)buffer.length());
+  return String(buffer.substr(beginIndex, endIndex - beginIndex));
+}
+
+void String::replace(char find, char replacement) {
+  std::replace(buffer.begin(), buffer.end(), find, replacement);
+}
+
+void String::replace(const String& find, const String& replacement) {
+  if (find.buffer.empty()) {
+    return;
+  }
+  size_t pos = 0;
+  while ((pos = buffer.find(find.buffer, pos)) != std::string::npos) {
+    buffer.replace(pos, find.buffer.length(), replacement.buffer);
+    pos += replacement.buffer.length();
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index < buffer.length()) {
+    buffer.erase(index, count);
+  }
+}
+
+void String::toLowerCase() {
+  for (char& c : buffer) c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+  for (char& c : buffer) c = toupper((unsigned char)c);
+}
+
+void String::trim() {
+  size_t first = 0;
+  while (first < buffer.length() && isspace((unsigned char)buffer[first])) first++;
+  size_t last = buffer.length();
+  while (last > first && isspace((unsigned char)buffer[last - 1])) last--;
+  buffer = buffer.substr(first, last - first);
+}
+
+long String::toInt() const {
+  return strtol(buffer.c_str(), nullptr, 10);
+}
+
+float String::toFloat() const {
+  return (float)toDouble();
+}
+
+double String::toDouble() const {
+  return strtod(buffer.c_str(), nullptr);
+}
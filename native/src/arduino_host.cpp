@@ -0,0 +1,249 @@
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+
+HostSerial Serial;
+HostSerial Serial1;
+HostEsp ESP;
+
+static std::mt19937 randomEngine(0);
+static uint32_t cpuFrequencyMhz = 240;
+
+// Function-local so globals constructed before main() can already read the clock
+static std::chrono::steady_clock::time_point bootTime() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return start;
+}
+
+static std::atomic<bool> manualClock(false);
+static std::atomic<uint64_t> manualMicros(0);
+
+static uint64_t hostMicros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime()).count();
+}
+
+void hostUseManualClock(bool manual) {
+  // Start from the current host time so earlier timestamps stay in the past
+  if (manual && !manualClock) {
+    manualMicros = hostMicros();
+  }
+  manualClock = manual;
+}
+
+void hostAdvanceClock(unsigned long ms) {
+  manualMicros += (uint64_t)ms * 1000;
+}
+
+unsigned long millis() {
+  return (manualClock ? manualMicros.load() : hostMicros()) / 1000;
+}
+
+unsigned long micros() {
+  return manualClock ? manualMicros.load() : hostMicros();
+}
+
+void delay(unsigned long ms) {
+  if (manualClock) {
+    hostAdvanceClock(ms);
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (manualClock) {
+    manualMicros += us;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {
+  std::this_thread::yield();
+}
+
+long random(long howbig) {
+  if (howbig <= 0) {
+    return 0;
+  }
+  return std::uniform_int_distribution<long>(0, howbig - 1)(randomEngine);
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) {
+    return howsmall;
+  }
+  return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed) {
+  randomEngine.seed(seed);
+}
+
+bool setCpuFrequencyMhz(uint32_t mhz) {
+  cpuFrequencyMhz = mhz;
+  return true;
+}
+
+uint32_t getCpuFrequencyMhz() {
+  return cpuFrequencyMhz;
+}
+
+size_t HostSerial::write(uint8_t c) {
+  return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t HostSerial::write(const uint8_t* buffer, size_t size) {
+  return fwrite(buffer, 1, size, stdout);
+}
+
+void HostSerial::flush() {
+  fflush(stdout);
+}
+
+void HostEsp::restart() {
+  Serial.println("ESP.restart() on host: exiting");
+  fflush(stdout);
+  exit(3);
+}
+
+size_t Print::printf(const char* format, ...) {
+  char small[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (length < 0) {
+    return 0;
+  }
+  if ((size_t)length < sizeof(small)) {
+    return write(small, length);
+  }
+
+  char* large = (char*)malloc(length + 1);
+  if (!large) {
+    return 0;
+  }
+  va_start(args, format);
+  vsnprintf(large, length + 1, format, args);
+  va_end(args);
+  size_t n = write(large, length);
+  free(large);
+  return n;
+}
+
+int Stream::timedRead() {
+  unsigned long start = millis();
+  do {
+    int c = read();
+    if (c >= 0) return c;
+    yield();
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+int Stream::timedPeek() {
+  unsigned long start = millis();
+  do {
+    int c = peek();
+    if (c >= 0) return c;
+    yield();
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+bool Stream::find(const char* target) {
+  return find(target, strlen(target));
+}
+
+bool Stream::find(const char* target, size_t length) {
+  if (length == 0) {
+    return true;
+  }
+  size_t matched = 0;
+  int c;
+  while ((c = timedRead()) >= 0) {
+    if (c == target[matched]) {
+      if (++matched == length) return true;
+    } else {
+      matched = c == target[0] ? 1 : 0;
+    }
+  }
+  return false;
+}
+
+bool Stream::findUntil(const char* target, const char* terminator) {
+  size_t targetLength = strlen(target);
+  size_t terminatorLength = strlen(terminator);
+  size_t matched = 0;
+  size_t terminated = 0;
+  int c;
+  while ((c = timedRead()) >= 0) {
+    matched = c == target[matched] ? matched + 1 : (c == target[0] ? 1 : 0);
+    if (targetLength && matched == targetLength) return true;
+    terminated = c == terminator[terminated] ? terminated + 1 : (c == terminator[0] ? 1 : 0);
+    if (terminatorLength && terminated == terminatorLength) return false;
+  }
+  return false;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+  size_t count = 0;
+  while (count < length) {
+    int c = timedRead();
+    if (c < 0) break;
+    buffer[count++] = (char)c;
+  }
+  return count;
+}
+
+size_t Stream::readBytesUntil(char terminator, char* buffer, size_t length) {
+  size_t count = 0;
+  while (count < length) {
+    int c = timedRead();
+    if (c < 0 || c == terminator) break;
+    buffer[count++] = (char)c;
+  }
+  return count;
+}
+
+long Stream::parseInt() {
+  int c = timedPeek();
+  while (c >= 0 && c != '-' && !isdigit(c)) {
+    read();
+    c = timedPeek();
+  }
+  bool negative = false;
+  long value = 0;
+  if (c == '-') {
+    negative = true;
+    read();
+    c = timedPeek();
+  }
+  while (c >= 0 && isdigit(c)) {
+    value = value * 10 + (c - '0');
+    read();
+    c = timedPeek();
+  }
+  return negative ? -value : value;
+}
+
+String Stream::readString() {
+  String result;
+  int c;
+  while ((c = timedRead()) >= 0) {
+    result += (char)c;
+  }
+  return result;
+}
+
+String Stream::readStringUntil(char terminator) {
+  String result;
+  int c;
+  while ((c = timedRead()) >= 0 && c != terminator) {
+    result += (char)c;
+  }
+  return result;
+}
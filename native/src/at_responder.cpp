@@ -0,0 +1,165 @@
+#include <at_responder.h>
+
+AtResponder::AtResponder(unsigned long bootMs_)
+  : bootMs(bootMs_), onAtMs(0), powered(false), powerKeyPresses(0) {
+}
+
+static std::string trimmed(const std::string& text) {
+  size_t begin = text.find_first_not_of(" \t\r");
+  if (begin == std::string::npos) {
+    return std::string();
+  }
+  size_t end = text.find_last_not_of(" \t\r");
+  return text.substr(begin, end - begin + 1);
+}
+
+bool AtResponder::script(const char* text) {
+  bool ok = true;
+  std::string all(text);
+  size_t start = 0;
+  while (start <= all.size()) {
+    size_t end = all.find('\n', start);
+    if (end == std::string::npos) end = all.size();
+    std::string entry = trimmed(all.substr(start, end - start));
+    start = end + 1;
+    if (entry.empty() || entry[0] == '#') {
+      continue;
+    }
+
+    size_t arrow = entry.find("=>");
+    if (arrow == std::string::npos) {
+      Serial.printf("✗ AtResponder: no => in \"%s\"\n", entry.c_str());
+      ok = false;
+      continue;
+    }
+
+    // Left side: the command, then optional xN and +Nms
+    Rule rule = {std::string(), std::string(), 0, 0};
+    std::string left = trimmed(entry.substr(0, arrow));
+    size_t space;
+    while ((space = left.find_last_of(' ')) != std::string::npos) {
+      std::string option = left.substr(space + 1);
+      if (option.size() > 1 && option[0] == 'x' && isdigit((unsigned char)option[1])) {
+        rule.remaining = strtoul(option.c_str() + 1, nullptr, 10);
+      } else if (option.size() > 3 && option[0] == '+' && option.compare(option.size() - 2, 2, "ms") == 0) {
+        rule.latencyMs = strtoul(option.c_str() + 1, nullptr, 10);
+      } else {
+        break;
+      }
+      left = trimmed(left.substr(0, space));
+    }
+    rule.command = left;
+
+    // Right side: reply lines separated by |
+    std::string right = trimmed(entry.substr(arrow + 2));
+    size_t from = 0;
+    while (!right.empty() && from <= right.size()) {
+      size_t bar = right.find('|', from);
+      if (bar == std::string::npos) bar = right.size();
+      rule.reply += trimmed(right.substr(from, bar - from)) + "\r\n";
+      from = bar + 1;
+    }
+    rules.push_back(rule);
+  }
+  return ok;
+}
+
+void AtResponder::clearScript() {
+  rules.clear();
+}
+
+void AtResponder::powerKey() {
+  powerKeyPresses++;
+  if (!powered) {
+    powered = true;
+    onAtMs = millis() + bootMs;
+  }
+}
+
+void AtResponder::powerOff() {
+  powered = false;
+  replies.clear();
+  line.clear();
+}
+
+bool AtResponder::isAnswering() const {
+  return powered && (long)(millis() - onAtMs) >= 0;
+}
+
+size_t AtResponder::count(const char* command) const {
+  size_t n = 0;
+  for (const Command& entry : received) {
+    if (entry.line == command) n++;
+  }
+  return n;
+}
+
+void AtResponder::handle(const std::string& command) {
+  received.push_back({millis(), command});
+
+  for (Rule& rule : rules) {
+    if (rule.command != command) {
+      continue;
+    }
+    if (rule.remaining > 0 && --rule.remaining == 0) {
+      rule.command.clear();  // Used up; later rules match from now on
+    }
+    if (!rule.reply.empty()) {
+      replies.push_back({millis() + rule.latencyMs, rule.reply});
+    }
+    return;
+  }
+  replies.push_back({millis(), "ERROR\r\n"});
+}
+
+size_t AtResponder::write(uint8_t c) {
+  if (!isAnswering()) {
+    // Bytes sent to a modem that is off or still booting are lost
+    line.clear();
+    return 1;
+  }
+  if (c == '\r' || c == '\n') {
+    std::string command = trimmed(line);
+    line.clear();
+    if (!command.empty()) {
+      handle(command);
+    }
+    return 1;
+  }
+  line += (char)c;
+  return 1;
+}
+
+size_t AtResponder::write(const uint8_t* buffer, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    write(buffer[i]);
+  }
+  return size;
+}
+
+int AtResponder::available() {
+  if (replies.empty() || (long)(millis() - replies.front().readyAtMs) < 0) {
+    return 0;
+  }
+  return (int)replies.front().bytes.size();
+}
+
+int AtResponder::read() {
+  int c = peek();
+  if (c < 0) {
+    return -1;
+  }
+  Pending& front = replies.front();
+  front.bytes.erase(0, 1);
+  if (front.bytes.empty()) {
+    replies.pop_front();
+  }
+  return c;
+}
+
+int AtResponder::peek() {
+  if (available() <= 0) {
+    return -1;
+  }
+  return (unsigned char)replies.front().bytes[0];
+}
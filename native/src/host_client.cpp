@@ -0,0 +1,222 @@
+#include <TinyGsmClient.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+bool IPAddress::fromString(const char* address) {
+  unsigned a, b, c, d;
+  char extra;
+  if (!address || sscanf(address, "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+    return false;
+  }
+  octets[0] = a;
+  octets[1] = b;
+  octets[2] = c;
+  octets[3] = d;
+  return true;
+}
+
+String IPAddress::toString() const {
+  char text[16];
+  snprintf(text, sizeof(text), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+  return String(text);
+}
+
+size_t IPAddress::printTo(Print& p) const {
+  return p.print(toString());
+}
+
+TinyGsm::TinyGsm(Stream& modemStream) : endpointPort(0), connects(0), bytesSent(0), bytesReceived(0), stream(modemStream) {
+  const char* endpoint = getenv("HOST_NET_ENDPOINT");
+  if (endpoint && *endpoint) {
+    std::string value(endpoint);
+    size_t colon = value.rfind(':');
+    if (colon != std::string::npos) {
+      redirect(value.substr(0, colon).c_str(), (uint16_t)atoi(value.c_str() + colon + 1));
+    }
+  }
+}
+
+void TinyGsm::redirect(const char* host, uint16_t port) {
+  endpointHost = host;
+  endpointPort = port;
+}
+
+void TinyGsm::script(const String& response) {
+  endpointHost.clear();
+  endpointPort = 0;
+  responses.push_back(response.str());
+}
+
+TinyGsmClient::TinyGsmClient()
+  : modem(nullptr), socketFd(-1), scriptOpen(false), requestPending(false), rxPos(0) {}
+
+TinyGsmClient::TinyGsmClient(TinyGsm& modem_ref, uint8_t mux) : TinyGsmClient() {
+  init(&modem_ref, mux);
+}
+
+TinyGsmClient::~TinyGsmClient() {
+  stop();
+}
+
+bool TinyGsmClient::init(TinyGsm* modem_ref, uint8_t) {
+  modem = modem_ref;
+  return true;
+}
+
+int TinyGsmClient::connect(IPAddress ip, uint16_t port) {
+  return connect(ip.toString().c_str(), port);
+}
+
+int TinyGsmClient::connect(const char* host, uint16_t port) {
+  stop();
+  if (!modem) {
+    return 0;
+  }
+  modem->connects++;
+
+  if (modem->endpointHost.empty()) {
+    scriptOpen = true;
+    requestPending = false;
+    return 1;
+  }
+
+  // The requested host and port only matter on target; everything goes to the endpoint
+  (void)host;
+  (void)port;
+  addrinfo hints = {};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* result = nullptr;
+  String service(modem->endpointPort);
+  if (getaddrinfo(modem->endpointHost.c_str(), service.c_str(), &hints, &result) != 0) {
+    return 0;
+  }
+  for (addrinfo* ai = result; ai; ai = ai->ai_next) {
+    int fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+    if (fd < 0) continue;
+    if (::connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      socketFd = fd;
+      break;
+    }
+    close(fd);
+  }
+  freeaddrinfo(result);
+  return socketFd >= 0 ? 1 : 0;
+}
+
+size_t TinyGsmClient::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t TinyGsmClient::write(const uint8_t* buffer, size_t size) {
+  if (scriptOpen) {
+    modem->sentBytes.append(reinterpret_cast<const char*>(buffer), size);
+    modem->bytesSent += size;
+    requestPending = true;
+    return size;
+  }
+  if (socketFd < 0) {
+    return 0;
+  }
+  size_t sent = 0;
+  while (sent < size) {
+    ssize_t n = send(socketFd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (n <= 0) {
+      if (n < 0 && errno == EINTR) continue;
+      break;
+    }
+    sent += n;
+  }
+  modem->bytesSent += sent;
+  return sent;
+}
+
+// Make unread bytes available without blocking; false if there are none
+bool TinyGsmClient::fill() {
+  if (rxPos < rx.size()) {
+    return true;
+  }
+  rx.clear();
+  rxPos = 0;
+
+  if (scriptOpen) {
+    // A scripted server answers once the request has been written
+    if (requestPending && !modem->responses.empty()) {
+      rx = modem->responses.front();
+      modem->responses.pop_front();
+      modem->bytesReceived += rx.size();
+      requestPending = false;
+    }
+    return !rx.empty();
+  }
+
+  if (socketFd < 0) {
+    return false;
+  }
+  char chunk[1460];
+  ssize_t n = recv(socketFd, chunk, sizeof(chunk), MSG_DONTWAIT);
+  if (n > 0) {
+    rx.assign(chunk, n);
+    modem->bytesReceived += n;
+    return true;
+  }
+  if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+    // Peer closed; keep the descriptor until stop() like the modem would
+    close(socketFd);
+    socketFd = -1;
+  }
+  return false;
+}
+
+int TinyGsmClient::available() {
+  return fill() ? (int)(rx.size() - rxPos) : 0;
+}
+
+int TinyGsmClient::read() {
+  return fill() ? (uint8_t)rx[rxPos++] : -1;
+}
+
+int TinyGsmClient::read(uint8_t* buffer, size_t size) {
+  size_t count = 0;
+  while (count < size && fill()) {
+    size_t n = std::min(size - count, rx.size() - rxPos);
+    memcpy(buffer + count, rx.data() + rxPos, n);
+    rxPos += n;
+    count += n;
+  }
+  return count == 0 && !connected() ? -1 : (int)count;
+}
+
+int TinyGsmClient::peek() {
+  return fill() ? (uint8_t)rx[rxPos] : -1;
+}
+
+void TinyGsmClient::stop() {
+  if (socketFd >= 0) {
+    close(socketFd);
+    socketFd = -1;
+  }
+  scriptOpen = false;
+  requestPending = false;
+  rx.clear();
+  rxPos = 0;
+}
+
+uint8_t TinyGsmClient::connected() {
+  if (rxPos < rx.size()) {
+    return 1;
+  }
+  if (scriptOpen) {
+    // The scripted server hangs up once it has nothing left to say
+    return !modem->responses.empty();
+  }
+  fill();
+  return socketFd >= 0 || rxPos < rx.size();
+}
@@ -0,0 +1,269 @@
+#include <LittleFS.h>
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+LittleFSFS LittleFS;
+
+struct HostFileImpl {
+  std::string path;       // Path as the firmware sees it, e.g. "/tlog/0001.seg"
+  std::string name;       // Last path component
+  std::string hostPath;
+  FILE* fp = nullptr;
+  bool directory = false;
+  std::vector<std::string> entries;
+  size_t nextEntry = 0;
+  const HostFS* fs = nullptr;
+
+  ~HostFileImpl() {
+    if (fp) fclose(fp);
+  }
+};
+
+std::string hostFsRoot() {
+  const char* root = getenv("HOST_FS_ROOT");
+  return root && *root ? root : ".hostfs";
+}
+
+bool hostMakeDirs(const std::string& path) {
+  for (size_t pos = 1; pos <= path.size(); pos++) {
+    if (pos == path.size() || path[pos] == '/') {
+      std::string partial = path.substr(0, pos);
+      if (::mkdir(partial.c_str(), 0755) != 0 && errno != EEXIST) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static std::string baseName(const std::string& path) {
+  size_t slash = path.rfind('/');
+  return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+HostFS::HostFS(const char* subdir_name) : subdir(subdir_name) {}
+
+std::string HostFS::hostPath(const char* path) const {
+  std::string p = path ? path : "";
+  if (p.empty() || p[0] != '/') {
+    p = "/" + p;
+  }
+  return hostFsRoot() + "/" + subdir + p;
+}
+
+File HostFS::open(const char* path, const char* mode, bool create) {
+  auto impl = std::make_shared<HostFileImpl>();
+  impl->path = path;
+  impl->name = baseName(impl->path);
+  impl->hostPath = hostPath(path);
+  impl->fs = this;
+
+  struct stat st;
+  bool isDir = stat(impl->hostPath.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+  if (isDir) {
+    DIR* dir = opendir(impl->hostPath.c_str());
+    if (!dir) {
+      return File();
+    }
+    while (dirent* entry = readdir(dir)) {
+      if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+        impl->entries.push_back(entry->d_name);
+      }
+    }
+    closedir(dir);
+    impl->directory = true;
+    return File(impl);
+  }
+
+  std::string fmode;
+  if (strcmp(mode, "r") == 0) fmode = "rb";
+  else if (strcmp(mode, "w") == 0) fmode = "wb";
+  else if (strcmp(mode, "a") == 0) fmode = "ab";
+  else fmode = std::string(mode) + "b";
+
+  if (create) {
+    hostMakeDirs(impl->hostPath.substr(0, impl->hostPath.rfind('/')));
+  }
+  impl->fp = fopen(impl->hostPath.c_str(), fmode.c_str());
+  if (!impl->fp) {
+    return File();
+  }
+  return File(impl);
+}
+
+bool HostFS::exists(const char* path) {
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool HostFS::remove(const char* path) {
+  return unlink(hostPath(path).c_str()) == 0;
+}
+
+bool HostFS::rename(const char* from, const char* to) {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool HostFS::mkdir(const char* path) {
+  return ::mkdir(hostPath(path).c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+bool HostFS::rmdir(const char* path) {
+  return ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+bool LittleFSFS::begin(bool formatOnFail, const char*, uint8_t, const char*) {
+  std::string base = hostPath("/");
+  struct stat st;
+  if (stat(base.c_str(), &st) == 0) {
+    return true;
+  }
+  return formatOnFail && hostMakeDirs(base.substr(0, base.size() - 1));
+}
+
+static void removeTree(const std::string& path, bool keepRoot) {
+  if (DIR* dir = opendir(path.c_str())) {
+    while (dirent* entry = readdir(dir)) {
+      if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+      removeTree(path + "/" + entry->d_name, false);
+    }
+    closedir(dir);
+    if (!keepRoot) ::rmdir(path.c_str());
+  } else {
+    unlink(path.c_str());
+  }
+}
+
+bool LittleFSFS::format() {
+  std::string base = hostPath("/");
+  removeTree(base.substr(0, base.size() - 1), true);
+  return true;
+}
+
+static size_t treeBytes(const std::string& path) {
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) {
+    return 0;
+  }
+  if (!S_ISDIR(st.st_mode)) {
+    return st.st_size;
+  }
+  size_t bytes = 0;
+  if (DIR* dir = opendir(path.c_str())) {
+    while (dirent* entry = readdir(dir)) {
+      if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+      bytes += treeBytes(path + "/" + entry->d_name);
+    }
+    closedir(dir);
+  }
+  return bytes;
+}
+
+size_t LittleFSFS::usedBytes() {
+  return treeBytes(hostPath("/"));
+}
+
+size_t File::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  return impl && impl->fp ? fwrite(buffer, 1, size, impl->fp) : 0;
+}
+
+int File::available() {
+  if (!impl || !impl->fp) {
+    return 0;
+  }
+  long pos = ftell(impl->fp);
+  return pos < 0 ? 0 : (int)(size() - pos);
+}
+
+int File::read() {
+  if (!impl || !impl->fp) {
+    return -1;
+  }
+  int c = fgetc(impl->fp);
+  return c == EOF ? -1 : c;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+  return impl && impl->fp ? fread(buffer, 1, size, impl->fp) : 0;
+}
+
+int File::peek() {
+  if (!impl || !impl->fp) {
+    return -1;
+  }
+  int c = fgetc(impl->fp);
+  if (c == EOF) {
+    return -1;
+  }
+  ungetc(c, impl->fp);
+  return c;
+}
+
+void File::flush() {
+  if (impl && impl->fp) fflush(impl->fp);
+}
+
+bool File::seek(uint32_t pos) {
+  return impl && impl->fp && fseek(impl->fp, pos, SEEK_SET) == 0;
+}
+
+size_t File::position() const {
+  if (!impl || !impl->fp) {
+    return 0;
+  }
+  long pos = ftell(impl->fp);
+  return pos < 0 ? 0 : pos;
+}
+
+size_t File::size() const {
+  if (!impl || !impl->fp) {
+    return 0;
+  }
+  fflush(impl->fp);
+  struct stat st;
+  return fstat(fileno(impl->fp), &st) == 0 ? st.st_size : 0;
+}
+
+void File::close() {
+  impl.reset();
+}
+
+const char* File::path() const {
+  return impl ? impl->path.c_str() : nullptr;
+}
+
+const char* File::name() const {
+  return impl ? impl->name.c_str() : nullptr;
+}
+
+bool File::isDirectory() const {
+  return impl && impl->directory;
+}
+
+File File::openNextFile(const char* mode) {
+  if (!impl || !impl->directory || impl->nextEntry >= impl->entries.size()) {
+    return File();
+  }
+  std::string child = impl->path;
+  if (child.empty() || child.back() != '/') {
+    child += '/';
+  }
+  child += impl->entries[impl->nextEntry++];
+  return const_cast<HostFS*>(impl->fs)->open(child.c_str(), mode);
+}
+
+void File::rewindDirectory() {
+  if (impl) impl->nextEntry = 0;
+}
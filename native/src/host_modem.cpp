@@ -0,0 +1,121 @@
+#include <TinyGsmClient.h>
+
+int8_t TinyGsm::sendAT(const String& command, uint32_t timeoutMs, String* data) {
+  // Drop whatever a timed-out exchange left behind
+  while (stream.available() > 0) {
+    stream.read();
+  }
+  stream.print("AT");
+  stream.print(command);
+  stream.print("\r\n");
+
+  String line;
+  unsigned long start = millis();
+  while (millis() - start < timeoutMs) {
+    int c = stream.read();
+    if (c < 0) {
+      delay(1);
+      continue;
+    }
+    if (c != '\n') {
+      line += (char)c;
+      continue;
+    }
+
+    line.trim();
+    if (line == "OK") {
+      return 1;
+    }
+    if (line == "ERROR" || line.startsWith("+CME ERROR")) {
+      return 2;
+    }
+    if (data && line.length() > 0) {
+      *data += line;
+      *data += "\n";
+    }
+    line = "";
+  }
+  return 0;
+}
+
+bool TinyGsm::testAT(uint32_t timeoutMs) {
+  return sendAT("", timeoutMs) == 1;
+}
+
+SimStatus TinyGsm::getSimStatus(uint32_t timeoutMs) {
+  String data;
+  if (sendAT("+CPIN?", timeoutMs, &data) != 1) {
+    return SIM_ERROR;
+  }
+  if (data.indexOf("READY") >= 0) {
+    return SIM_READY;
+  }
+  if (data.indexOf("SIM PIN") >= 0 || data.indexOf("SIM PUK") >= 0) {
+    return SIM_LOCKED;
+  }
+  return SIM_ERROR;
+}
+
+RegStatus TinyGsm::getRegistrationStatus() {
+  // "+CGREG: <n>,<stat>"
+  String data;
+  if (sendAT("+CGREG?", 1000, &data) != 1) {
+    return REG_NO_RESULT;
+  }
+  int comma = data.indexOf(',');
+  if (comma < 0) {
+    return REG_NO_RESULT;
+  }
+  return (RegStatus)data.substring(comma + 1).toInt();
+}
+
+bool TinyGsm::isNetworkConnected() {
+  RegStatus status = getRegistrationStatus();
+  return status == REG_OK_HOME || status == REG_OK_ROAMING;
+}
+
+bool TinyGsm::setNetworkMode(uint8_t mode) {
+  return sendAT("+CNMP=" + String(mode)) == 1;
+}
+
+bool TinyGsm::gprsConnect(const char* apn, const char*, const char*) {
+  if (sendAT(String("+CGDCONT=1,\"IP\",\"") + apn + "\"") != 1) {
+    return false;
+  }
+  return sendAT("+CGACT=1,1", 60000) == 1;
+}
+
+bool TinyGsm::isGprsConnected() {
+  String data;
+  return sendAT("+CGACT?", 1000, &data) == 1 && data.indexOf("+CGACT: 1,1") >= 0;
+}
+
+int16_t TinyGsm::getSignalQuality() {
+  // "+CSQ: <rssi>,<ber>"; 99 is what the modem reports for unknown
+  String data;
+  if (sendAT("+CSQ", 1000, &data) != 1) {
+    return 99;
+  }
+  int colon = data.indexOf(':');
+  return colon < 0 ? 99 : (int16_t)data.substring(colon + 1).toInt();
+}
+
+String TinyGsm::getLocalIP() {
+  // "+CGPADDR: 1,<address>"
+  String data;
+  if (sendAT("+CGPADDR=1", 1000, &data) != 1) {
+    return "";
+  }
+  int comma = data.indexOf(',');
+  if (comma < 0) {
+    return "";
+  }
+  String address = data.substring(comma + 1);
+  address.replace("\"", "");
+  address.trim();
+  return address;
+}
+
+bool TinyGsm::poweroff() {
+  return sendAT("+CPOF") == 1;
+}
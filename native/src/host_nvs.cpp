@@ -0,0 +1,147 @@
+#include <EEPROM.h>
+#include <FS.h>
+#include <Preferences.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+EEPROMClass EEPROM;
+
+static std::string eepromPath() {
+  return hostFsRoot() + "/eeprom.bin";
+}
+
+bool EEPROMClass::begin(size_t size) {
+  data.assign(size, 0xFF);
+  if (FILE* fp = fopen(eepromPath().c_str(), "rb")) {
+    fread(data.data(), 1, size, fp);
+    fclose(fp);
+  }
+  dirty = false;
+  return true;
+}
+
+void EEPROMClass::end() {
+  commit();
+  data.clear();
+}
+
+bool EEPROMClass::commit() {
+  if (!dirty) {
+    return true;
+  }
+  hostMakeDirs(hostFsRoot());
+  FILE* fp = fopen(eepromPath().c_str(), "wb");
+  if (!fp) {
+    return false;
+  }
+  bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+  fclose(fp);
+  dirty = !ok;
+  return ok;
+}
+
+uint8_t EEPROMClass::read(int address) const {
+  return address >= 0 && (size_t)address < data.size() ? data[address] : 0;
+}
+
+void EEPROMClass::write(int address, uint8_t value) {
+  if (address >= 0 && (size_t)address < data.size() && data[address] != value) {
+    data[address] = value;
+    dirty = true;
+  }
+}
+
+// NVS limits namespaces and keys to 15 characters
+bool Preferences::begin(const char* name, bool readOnly_, const char*) {
+  if (!name || strlen(name) > 15) {
+    return false;
+  }
+  directory = hostFsRoot() + "/nvs/" + name;
+  readOnly = readOnly_;
+  if (!readOnly && !hostMakeDirs(directory)) {
+    return false;
+  }
+  started = true;
+  return true;
+}
+
+std::string Preferences::keyPath(const char* key) const {
+  return directory + "/" + key;
+}
+
+size_t Preferences::putRaw(const char* key, const void* value, size_t length) {
+  if (!started || readOnly || !key || strlen(key) > 15) {
+    return 0;
+  }
+  // Write then rename, so a crash mid-write leaves the old value like NVS does
+  std::string path = keyPath(key);
+  std::string tmp = path + ".tmp";
+  FILE* fp = fopen(tmp.c_str(), "wb");
+  if (!fp) {
+    return 0;
+  }
+  bool ok = fwrite(value, 1, length, fp) == length;
+  fclose(fp);
+  if (!ok || ::rename(tmp.c_str(), path.c_str()) != 0) {
+    unlink(tmp.c_str());
+    return 0;
+  }
+  return length;
+}
+
+size_t Preferences::getRaw(const char* key, void* buffer, size_t maxLength) const {
+  size_t length = getBytesLength(key);
+  if (length == 0 || length > maxLength) {
+    return 0;
+  }
+  FILE* fp = fopen(keyPath(key).c_str(), "rb");
+  if (!fp) {
+    return 0;
+  }
+  size_t n = fread(buffer, 1, length, fp);
+  fclose(fp);
+  return n;
+}
+
+size_t Preferences::getBytesLength(const char* key) const {
+  struct stat st;
+  if (!started || !key || stat(keyPath(key).c_str(), &st) != 0) {
+    return 0;
+  }
+  return st.st_size;
+}
+
+bool Preferences::isKey(const char* key) const {
+  struct stat st;
+  return started && key && stat(keyPath(key).c_str(), &st) == 0;
+}
+
+bool Preferences::remove(const char* key) {
+  return started && !readOnly && unlink(keyPath(key).c_str()) == 0;
+}
+
+bool Preferences::clear() {
+  if (!started || readOnly) {
+    return false;
+  }
+  if (DIR* dir = opendir(directory.c_str())) {
+    while (dirent* entry = readdir(dir)) {
+      if (entry->d_name[0] != '.') {
+        unlink((directory + "/" + entry->d_name).c_str());
+      }
+    }
+    closedir(dir);
+  }
+  return true;
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) const {
+  size_t length = getBytesLength(key);
+  if (length == 0) {
+    return isKey(key) ? String() : defaultValue;
+  }
+  std::string value(length, '\0');
+  return getRaw(key, &value[0], length) == length ? String(value) : defaultValue;
+}
@@ -0,0 +1,116 @@
+#include <Arduino.h>
+#include <FS.h>
+#include <esp_partition.h>
+#include <esp_random.h>
+#include <esp_sleep.h>
+#include <map>
+#include <random>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+struct HostPartition {
+  esp_partition_t info;
+  std::string path;
+};
+
+static std::map<std::string, HostPartition> partitions;
+static std::map<esp_partition_mmap_handle_t, std::vector<uint8_t>> mappings;
+static esp_partition_mmap_handle_t nextHandle = 1;
+
+static std::string partitionPath(const char* label) {
+  return hostFsRoot() + "/partitions/" + label + ".bin";
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label) {
+  if (!label) {
+    return nullptr;
+  }
+  std::string path = partitionPath(label);
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) {
+    return nullptr;
+  }
+
+  HostPartition& partition = partitions[label];
+  partition.path = path;
+  partition.info.type = type;
+  partition.info.subtype = subtype;
+  partition.info.address = 0;
+  partition.info.size = st.st_size;
+  partition.info.encrypted = false;
+  snprintf(partition.info.label, sizeof(partition.info.label), "%s", label);
+  return &partition.info;
+}
+
+static const HostPartition* lookup(const esp_partition_t* partition) {
+  if (!partition) {
+    return nullptr;
+  }
+  auto it = partitions.find(partition->label);
+  return it == partitions.end() ? nullptr : &it->second;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t srcOffset, void* dst, size_t size) {
+  const HostPartition* hp = lookup(partition);
+  if (!hp || srcOffset + size > partition->size) {
+    return ESP_FAIL;
+  }
+  FILE* fp = fopen(hp->path.c_str(), "rb");
+  if (!fp) {
+    return ESP_FAIL;
+  }
+  bool ok = fseek(fp, srcOffset, SEEK_SET) == 0 && fread(dst, 1, size, fp) == size;
+  fclose(fp);
+  return ok ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t, const void** outPtr,
+                             esp_partition_mmap_handle_t* outHandle) {
+  std::vector<uint8_t> image(size);
+  if (esp_partition_read(partition, offset, image.data(), size) != ESP_OK) {
+    return ESP_FAIL;
+  }
+  esp_partition_mmap_handle_t handle = nextHandle++;
+  std::vector<uint8_t>& mapped = mappings[handle];
+  mapped.swap(image);
+  *outPtr = mapped.data();
+  *outHandle = handle;
+  return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle) {
+  mappings.erase(handle);
+}
+
+uint32_t esp_random() {
+  static std::random_device device;
+  return device();
+}
+
+void esp_fill_random(void* buffer, size_t length) {
+  uint8_t* bytes = static_cast<uint8_t*>(buffer);
+  while (length > 0) {
+    uint32_t value = esp_random();
+    size_t n = length < sizeof(value) ? length : sizeof(value);
+    memcpy(bytes, &value, n);
+    bytes += n;
+    length -= n;
+  }
+}
+
+static uint64_t sleepTimerUs = 0;
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t timeUs) {
+  sleepTimerUs = timeUs;
+  return ESP_OK;
+}
+
+// Light sleep on the host is just a sleep; millis() keeps counting, as on target
+esp_err_t esp_light_sleep_start() {
+  delayMicroseconds(sleepTimerUs);
+  return ESP_OK;
+}
@@ -0,0 +1,211 @@
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct HostSemaphore {
+  std::timed_mutex mutex;
+};
+
+struct HostTask {
+  std::string name;
+  std::mutex lock;
+  std::condition_variable wake;
+  uint32_t notifications = 0;
+};
+
+// Items are copied in and out by value, as FreeRTOS queues do
+struct HostQueue {
+  std::mutex lock;
+  std::condition_variable changed;
+  std::deque<std::vector<uint8_t>> items;
+  UBaseType_t length;
+  UBaseType_t itemSize;
+};
+
+// Thrown by vTaskDelete(nullptr) and caught by the thread trampoline
+struct HostTaskExit {};
+
+static thread_local HostTask* currentTask = nullptr;
+
+void hostSpinEnter(portMUX_TYPE* mux) {
+  while (__atomic_exchange_n(&mux->flag, 1, __ATOMIC_ACQUIRE)) {
+    std::this_thread::yield();
+  }
+}
+
+void hostSpinExit(portMUX_TYPE* mux) {
+  __atomic_store_n(&mux->flag, 0, __ATOMIC_RELEASE);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  return new HostSemaphore();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+  if (!semaphore) {
+    return pdFALSE;
+  }
+  if (ticks == portMAX_DELAY) {
+    semaphore->mutex.lock();
+    return pdTRUE;
+  }
+  return semaphore->mutex.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  if (!semaphore) {
+    return pdFALSE;
+  }
+  semaphore->mutex.unlock();
+  return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+  delete semaphore;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  HostQueue* queue = new HostQueue();
+  queue->length = length;
+  queue->itemSize = itemSize;
+  return queue;
+}
+
+template <typename Predicate>
+static bool waitFor(HostQueue* queue, std::unique_lock<std::mutex>& guard, TickType_t ticks, Predicate ready) {
+  if (ticks == portMAX_DELAY) {
+    queue->changed.wait(guard, ready);
+    return true;
+  }
+  return queue->changed.wait_for(guard, std::chrono::milliseconds(ticks), ready);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+  std::unique_lock<std::mutex> guard(queue->lock);
+  if (!waitFor(queue, guard, ticks, [queue]() { return queue->items.size() < queue->length; })) {
+    return pdFALSE;
+  }
+  const uint8_t* bytes = static_cast<const uint8_t*>(item);
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  guard.unlock();
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks) {
+  std::unique_lock<std::mutex> guard(queue->lock);
+  if (!waitFor(queue, guard, ticks, [queue]() { return !queue->items.empty(); })) {
+    return pdFALSE;
+  }
+  memcpy(buffer, queue->items.front().data(), queue->itemSize);
+  queue->items.pop_front();
+  guard.unlock();
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  std::lock_guard<std::mutex> guard(queue->lock);
+  return queue->items.size();
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+  delete queue;
+}
+
+// Task handles live for the life of the process so a stale handle held by
+// another task never dangles, matching how the firmware treats its tasks.
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t, void* parameter,
+                                   UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+  HostTask* task = new HostTask();
+  task->name = name ? name : "";
+  if (handle) {
+    *handle = task;
+  }
+  std::thread([task, code, parameter]() {
+    currentTask = task;
+    try {
+      code(parameter);
+    } catch (const HostTaskExit&) {
+    }
+  }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stackDepth, void* parameter,
+                       UBaseType_t priority, TaskHandle_t* handle) {
+  return xTaskCreatePinnedToCore(code, name, stackDepth, parameter, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  if (task == nullptr || task == currentTask) {
+    throw HostTaskExit();
+  }
+  Serial.println("✗ vTaskDelete on another task is not supported on host");
+}
+
+// The main thread gets a handle lazily, like the Arduino loop task on target
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  if (!currentTask) {
+    currentTask = new HostTask();
+    currentTask->name = "loopTask";
+  }
+  return currentTask;
+}
+
+void xTaskNotifyGive(TaskHandle_t task) {
+  if (!task) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->notifications++;
+  }
+  task->wake.notify_one();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  HostTask* task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> guard(task->lock);
+  auto ready = [task]() { return task->notifications > 0; };
+  if (ticks == portMAX_DELAY) {
+    task->wake.wait(guard, ready);
+  } else {
+    task->wake.wait_for(guard, std::chrono::milliseconds(ticks), ready);
+  }
+  uint32_t value = task->notifications;
+  if (value > 0) {
+    task->notifications = clearOnExit ? 0 : value - 1;
+  }
+  return value;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  delay(ticks);
+}
+
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment) {
+  *previousWake += increment;
+  int32_t remaining = (int32_t)(*previousWake - xTaskGetTickCount());
+  if (remaining > 0) {
+    delay(remaining);
+  }
+}
+
+TickType_t xTaskGetTickCount() {
+  return millis();
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) {
+  return 0;
+}
@@ -0,0 +1,201 @@
+// AddressIndex against images packed here in the layout tools/pack_addresses.py
+// writes, mapped through the partition stand-in from
+// $HOST_FS_ROOT/partitions/addridx.bin.
+
+#include "test.h"
+#include "../../src/Database/address_index.h"
+#include "../../src/Utils/crc32.h"
+#include <FS.h>
+#include <map>
+#include <stddef.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct FixtureLevel {
+  uint8_t digits;
+  std::vector<std::pair<uint32_t, std::string>> rows;  // Sorted by code
+};
+
+// A slice of the PSGC tables: both ends of each level, a shared description
+// and one that needs escaping in JSON
+static std::vector<FixtureLevel> fixture() {
+  return {
+    {2, {{1, "Region I (Ilocos Region)"}, {13, "National Capital Region (NCR)"}}},
+    {4, {{128, "Ilocos Norte"}, {129, "Ilocos Sur"}, {1374, "NCR, Second District"}}},
+    {6, {{12801, "Adams"}, {12802, "Bacarra"}, {12901, "Alilem"}, {137404, "Quezon City"}}},
+    {9, {{12801001, "Adams (Pob.)"}, {12801002, "Poblacion"}, {12802001, "Bani"}, {12802002, "Buyon"},
+         {12901001, "Poblacion"}, {137404001, "Alicia"}, {137404002, "Bagong Pag-asa"}, {137404003, "Barangay \"Bani\""}}},
+  };
+}
+
+// Same packing as tools/pack_addresses.py: header, per-level entry tables,
+// then the deduplicated string table
+static std::vector<uint8_t> pack(const std::vector<FixtureLevel>& levels) {
+  std::string strings;
+  std::map<std::string, size_t> stringOffsets;
+  std::vector<std::vector<AddressIndexEntry>> tables;
+  for (const FixtureLevel& level : levels) {
+    std::vector<AddressIndexEntry> table;
+    for (const auto& row : level.rows) {
+      if (stringOffsets.count(row.second) == 0) {
+        stringOffsets[row.second] = strings.size();
+        strings += row.second;
+      }
+      size_t offset = stringOffsets[row.second];
+      table.push_back({row.first, (uint32_t)(offset << 8 | row.second.size())});
+    }
+    tables.push_back(table);
+  }
+
+  AddressIndexHeader header = {};
+  header.magic = ADDRESS_INDEX_MAGIC;
+  header.version = ADDRESS_INDEX_FORMAT;
+  header.levelCount = ADDRESS_LEVEL_COUNT;
+  std::vector<uint8_t> image(sizeof(header));
+  for (size_t i = 0; i < tables.size(); i++) {
+    header.levels[i].offset = image.size();
+    header.levels[i].count = tables[i].size();
+    header.levels[i].digits = levels[i].digits;
+    const uint8_t* bytes = (const uint8_t*)tables[i].data();
+    image.insert(image.end(), bytes, bytes + tables[i].size() * sizeof(AddressIndexEntry));
+  }
+  header.stringsOffset = image.size();
+  header.stringsSize = strings.size();
+  image.insert(image.end(), strings.begin(), strings.end());
+  header.imageSize = image.size();
+  header.crc = crc32Update(0, image.data() + sizeof(header), image.size() - sizeof(header));
+  memcpy(image.data(), &header, sizeof(header));
+  return image;
+}
+
+static AddressIndexHeader& headerOf(std::vector<uint8_t>& image) {
+  return *(AddressIndexHeader*)image.data();
+}
+
+static AddressIndexEntry& entryOf(std::vector<uint8_t>& image, AddressLevel level, size_t index) {
+  return ((AddressIndexEntry*)(image.data() + headerOf(image).levels[level].offset))[index];
+}
+
+// Re-sign the body after a deliberate edit, like a buggy packer would
+static void resign(std::vector<uint8_t>& image) {
+  headerOf(image).crc = crc32Update(0, image.data() + sizeof(AddressIndexHeader),
+                                    image.size() - sizeof(AddressIndexHeader));
+}
+
+static std::string partitionPath() {
+  return hostFsRoot() + "/partitions/" ADDRESS_INDEX_PARTITION ".bin";
+}
+
+static void flash(const std::vector<uint8_t>& image) {
+  hostMakeDirs(hostFsRoot() + "/partitions");
+  FILE* fp = fopen(partitionPath().c_str(), "wb");
+  fwrite(image.data(), 1, image.size(), fp);
+  fclose(fp);
+}
+
+// Fresh index per image: begin() only tries once
+static bool mapImage(const std::vector<uint8_t>& image) {
+  flash(image);
+  AddressIndex index;
+  return index.begin();
+}
+
+static std::vector<uint32_t> childCodes(const AddressIndex& index, AddressLevel level, const char* parent) {
+  const AddressIndexEntry* first = nullptr;
+  size_t count = index.children(level, parent, &first);
+  std::vector<uint32_t> codes;
+  for (size_t i = 0; i < count; i++) {
+    codes.push_back(first[i].code);
+  }
+  return codes;
+}
+
+static void lookups() {
+  std::vector<uint8_t> image = pack(fixture());
+  flash(image);
+  AddressIndex index;
+  check(index.begin() && index.isReady(), "packed fixture maps and verifies");
+
+  check(childCodes(index, ADDRESS_LEVEL_REGION, "") == std::vector<uint32_t>({1, 13}), "all regions listed");
+  check(childCodes(index, ADDRESS_LEVEL_PROVINCE, "01") == std::vector<uint32_t>({128, 129}),
+        "provinces of the first region");
+  check(childCodes(index, ADDRESS_LEVEL_BARANGAY, "137404") ==
+        std::vector<uint32_t>({137404001, 137404002, 137404003}),
+        "barangays of the last city, at the end of the table");
+  check(childCodes(index, ADDRESS_LEVEL_CITY, "0130").empty(), "unknown parent has no children");
+  check(childCodes(index, ADDRESS_LEVEL_CITY, "128").empty() && childCodes(index, ADDRESS_LEVEL_CITY, "00128").empty(),
+        "parent code with the wrong digit count is rejected");
+  check(childCodes(index, ADDRESS_LEVEL_COUNT, "0128").empty(), "level past the barangays is rejected");
+
+  const AddressIndexEntry* first = nullptr;
+  index.children(ADDRESS_LEVEL_CITY, "0128", &first);
+  size_t length = 0;
+  const char* desc = index.description(first[1], length);
+  check(std::string(desc, length) == "Bacarra", "description read in place from the string table");
+  check(index.formatCode(ADDRESS_LEVEL_BARANGAY, 12801001) == "012801001", "codes keep their leading zeros");
+
+  String json;
+  index.appendJson(json, ADDRESS_LEVEL_BARANGAY, "012802", "brgyCode", "brgyDesc");
+  check(json == "[{\"brgyCode\":\"012802001\",\"brgyDesc\":\"Bani\"},{\"brgyCode\":\"012802002\",\"brgyDesc\":\"Buyon\"}]",
+        "dropdown JSON for a city's barangays");
+  json = "";
+  index.appendJson(json, ADDRESS_LEVEL_BARANGAY, "137404", "brgyCode", "brgyDesc");
+  check(json.indexOf("\"Barangay \\\"Bani\\\"\"") >= 0, "quotes in descriptions are escaped");
+  check(entryOf(image, ADDRESS_LEVEL_BARANGAY, 1).desc == entryOf(image, ADDRESS_LEVEL_BARANGAY, 4).desc,
+        "shared descriptions are stored once");
+}
+
+static void rejectedImages() {
+  remove(partitionPath().c_str());
+  AddressIndex missing;
+  check(!missing.begin() && !missing.isReady(), "missing partition leaves the index off");
+
+  std::vector<uint8_t> image = pack(fixture());
+  image[0] ^= 0x01;
+  check(!mapImage(image), "bad magic rejected");
+
+  image = pack(fixture());
+  headerOf(image).version = ADDRESS_INDEX_FORMAT + 1;
+  check(!mapImage(image), "unknown format version rejected");
+
+  image = pack(fixture());
+  image.resize(image.size() - 4);
+  check(!mapImage(image), "image cut short of its header size rejected");
+
+  image = pack(fixture());
+  image[image.size() - 1] ^= 0x20;
+  check(!mapImage(image), "flipped byte fails the CRC");
+
+  image = pack(fixture());
+  headerOf(image).levels[ADDRESS_LEVEL_BARANGAY].count += 1;
+  resign(image);
+  check(!mapImage(image), "level table running into the string table rejected");
+
+  image = pack(fixture());
+  headerOf(image).levels[ADDRESS_LEVEL_PROVINCE].count = 0x40000000;
+  resign(image);
+  check(!mapImage(image), "entry count that overflows the table size rejected");
+
+  image = pack(fixture());
+  entryOf(image, ADDRESS_LEVEL_BARANGAY, 7).desc += 1 << 8;
+  resign(image);
+  check(!mapImage(image), "description past the end of the string table rejected");
+
+  image = pack(fixture());
+  headerOf(image).stringsSize += 1;
+  resign(image);
+  check(!mapImage(image), "string table past the end of the image rejected");
+
+  image = pack(fixture());
+  headerOf(image).levels[ADDRESS_LEVEL_CITY].digits = 4;
+  resign(image);
+  check(!mapImage(image), "codes that do not extend their parent's rejected");
+}
+
+void runAddressIndexTests() {
+  lookups();
+  rejectedImages();
+  // Leave the good image for tools/pack_addresses.py verify/lookup
+  flash(pack(fixture()));
+}
@@ -0,0 +1,52 @@
+// Host unit test runner: program [suite...]
+
+#include "test.h"
+#include <LittleFS.h>
+
+struct Suite {
+  const char* name;
+  void (*run)();
+};
+
+static const Suite suites[] = {
+  {"modem", runModemTests},
+  {"address_index", runAddressIndexTests},
+  {"ring", runRingTests},
+};
+
+static int failures = 0;
+
+void check(bool ok, const char* what) {
+  Serial.printf("%s %s\n", ok ? "✓" : "✗", what);
+  if (!ok) {
+    failures++;
+  }
+}
+
+int main(int argc, char** argv) {
+  // Suites write flash files and partition images; keep them away from a
+  // development .hostfs unless told otherwise
+  setenv("HOST_FS_ROOT", ".hostfs-test", 0);
+  LittleFS.begin(true);
+
+  int ran = 0;
+  for (const Suite& suite : suites) {
+    bool selected = argc < 2;
+    for (int i = 1; i < argc; i++) {
+      selected |= strcmp(argv[i], suite.name) == 0;
+    }
+    if (!selected) {
+      continue;
+    }
+    Serial.printf("\n=== %s ===\n", suite.name);
+    suite.run();
+    ran++;
+  }
+
+  if (ran == 0) {
+    Serial.println("✗ No suite matched");
+    return 2;
+  }
+  Serial.printf("\n%s %d suite(s), %d failure(s)\n", failures ? "✗" : "✓", ran, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,254 @@
+// ModemManager bring-up against a scripted AT responder, on the manual clock
+// so the 20-60 s stage timeouts and the backoff schedule run in no time.
+
+#include "test.h"
+#include "../../src/Modem/modem_manager.h"
+#include <at_responder.h>
+#include <vector>
+
+// A modem that boots and attaches without trouble
+static const char* HEALTHY =
+  "AT => OK\n"
+  "AT+CPIN? +40ms => +CPIN: READY|OK\n"
+  "AT+CNMP=2 => OK\n"
+  "AT+CGREG? => +CGREG: 0,1|OK\n"
+  "AT+CGDCONT=1,\"IP\",\"" MODEM_APN "\" => OK\n"
+  "AT+CGACT=1,1 +800ms => OK\n"
+  "AT+CGPADDR=1 => +CGPADDR: 1,10.64.12.7|OK\n";
+
+#define MODEM_BOOT_MS 3000
+#define PWRKEY_PULSE_MS 200
+
+// Board pins wired to the responder: reset and power loss stop the modem,
+// the power key starts its boot
+class ScriptedModemManager : public ModemManager {
+private:
+  AtResponder& responder;
+
+protected:
+  void setPower(bool on) override {
+    if (!on) responder.powerOff();
+  }
+  void setReset(bool asserted) override {
+    if (asserted) responder.powerOff();
+  }
+  void pulsePowerKey() override {
+    delay(PWRKEY_PULSE_MS);
+    responder.powerKey();
+  }
+
+public:
+  ScriptedModemManager(TinyGsm* modem, AtResponder& responder_ref)
+    : ModemManager(modem), responder(responder_ref) {}
+};
+
+struct StateEntry {
+  ModemState state;
+  unsigned long atMs;
+};
+
+// Step like the loop task does and log every state change. Stops when the
+// manager is finished unless keepGoing, or after limitMs.
+static std::vector<StateEntry> run(ModemManager& manager, unsigned long limitMs, bool keepGoing = false) {
+  std::vector<StateEntry> entries;
+  entries.push_back({manager.getState(), millis()});
+  unsigned long start = millis();
+  while (millis() - start < limitMs && (keepGoing || !manager.isFinished())) {
+    ModemState state = manager.step();
+    if (state != entries.back().state) {
+      entries.push_back({state, millis()});
+    }
+    delay(10);
+  }
+  return entries;
+}
+
+static size_t countState(const std::vector<StateEntry>& entries, ModemState state) {
+  size_t n = 0;
+  for (const StateEntry& entry : entries) {
+    if (entry.state == state) n++;
+  }
+  return n;
+}
+
+static String counter(const ModemManager& manager, const char* name) {
+  std::map<String, String> counters;
+  manager.appendCounters(counters);
+  return counters[name];
+}
+
+static void bringUpLatency() {
+  AtResponder responder(MODEM_BOOT_MS);
+  responder.script("AT+CGREG? x4 => +CGREG: 0,2|OK");
+  responder.script(HEALTHY);
+  TinyGsm modem(responder);
+  ScriptedModemManager manager(&modem, responder);
+
+  manager.begin(MODEM_BOOT_MAX_ATTEMPTS);
+  run(manager, 120000);
+
+  // Reset pulse, key press, boot, four searching polls and the attach
+  unsigned long floorMs = 100 + MODEM_RESET_PULSE_MS + PWRKEY_PULSE_MS + MODEM_BOOT_MS +
+                          4 * MODEM_POLL_INTERVAL_MS + 800;
+  unsigned long bringUpMs = manager.getLastBringUpMs();
+  Serial.printf("  bring-up %lu ms (floor %lu): powering %lu, wait_at %lu, wait_sim %lu, registering %lu, attaching %lu\n",
+                bringUpMs, floorMs, manager.getStateDuration(MODEM_POWERING), manager.getStateDuration(MODEM_WAIT_AT),
+                manager.getStateDuration(MODEM_WAIT_SIM), manager.getStateDuration(MODEM_REGISTERING),
+                manager.getStateDuration(MODEM_ATTACHING));
+  check(manager.isConnected(), "healthy modem connects");
+  check(bringUpMs >= floorMs && bringUpMs <= floorMs + 2 * MODEM_POLL_INTERVAL_MS + 500,
+        "bring-up latency is the script's delays plus at most two poll periods");
+  check(manager.getStateDuration(MODEM_WAIT_AT) >= MODEM_BOOT_MS &&
+        manager.getStateDuration(MODEM_WAIT_AT) <= MODEM_BOOT_MS + MODEM_POLL_INTERVAL_MS + 300,
+        "wait_at covers the modem boot");
+  check(manager.getStateDuration(MODEM_REGISTERING) >= 4 * MODEM_POLL_INTERVAL_MS,
+        "registering covers the searching polls");
+  check(responder.count("AT+CGREG?") == 5, "registration polled at the poll interval");
+}
+
+static void atTimeout() {
+  AtResponder responder(1000000);  // Never finishes booting
+  TinyGsm modem(responder);
+  ScriptedModemManager manager(&modem, responder);
+
+  manager.begin(2);
+  std::vector<StateEntry> entries = run(manager, 200000);
+
+  check(manager.getState() == MODEM_FAILED, "silent modem fails after the attempt cap");
+  check(strcmp(manager.getLastError(), "at_timeout") == 0, "failure reason is at_timeout");
+  unsigned long waitAt = manager.getStateDuration(MODEM_WAIT_AT);
+  check(waitAt >= 2 * MODEM_AT_TIMEOUT_MS && waitAt <= 2 * (MODEM_AT_TIMEOUT_MS + MODEM_POLL_INTERVAL_MS + 300),
+        "each attempt waits MODEM_AT_TIMEOUT_MS for AT");
+  check(countState(entries, MODEM_BACKOFF) == 1, "one backoff between the two attempts");
+  // One press per power-up plus a re-press after 10 s without an answer
+  check(responder.getPowerKeyPresses() == 4, "power key re-pressed once per attempt");
+}
+
+// Run one attempt against `script` and check it fails with `reason` after
+// spending about timeoutMs in `state`
+static void stageTimeout(const char* script, ModemState state, unsigned long timeoutMs, const char* reason) {
+  AtResponder responder(MODEM_BOOT_MS);
+  responder.script(script);
+  responder.script(HEALTHY);
+  TinyGsm modem(responder);
+  ScriptedModemManager manager(&modem, responder);
+
+  manager.begin(1);
+  run(manager, 200000);
+
+  char what[96];
+  snprintf(what, sizeof(what), "%s after %lu ms in %s (%lu ms)", reason, timeoutMs, modemStateName(state),
+           manager.getStateDuration(state));
+  check(manager.getState() == MODEM_FAILED && strcmp(manager.getLastError(), reason) == 0 &&
+        manager.getStateDuration(state) >= timeoutMs &&
+        manager.getStateDuration(state) <= timeoutMs + MODEM_POLL_INTERVAL_MS + 1100, what);
+}
+
+static void stageTimeouts() {
+  stageTimeout("AT+CPIN? => +CME ERROR: 14", MODEM_WAIT_SIM, MODEM_SIM_TIMEOUT_MS, "sim_timeout");
+  stageTimeout("AT+CGREG? => +CGREG: 0,2|OK", MODEM_REGISTERING, MODEM_REGISTRATION_TIMEOUT_MS, "registration_timeout");
+  stageTimeout("AT+CGACT=1,1 => ERROR", MODEM_ATTACHING, 0, "data_attach");
+}
+
+static void retryBackoff() {
+  AtResponder responder(MODEM_BOOT_MS);
+  responder.script("AT+CGREG? => +CGREG: 0,3|OK");
+  responder.script(HEALTHY);
+  TinyGsm modem(responder);
+  ScriptedModemManager manager(&modem, responder);
+
+  const uint8_t attempts = 8;
+  manager.begin(attempts);
+  std::vector<StateEntry> entries = run(manager, 1200000);
+
+  std::vector<unsigned long> waits;
+  for (size_t i = 0; i + 1 < entries.size(); i++) {
+    if (entries[i].state == MODEM_BACKOFF) {
+      waits.push_back(entries[i + 1].atMs - entries[i].atMs);
+    }
+  }
+
+  bool doubling = waits.size() == attempts - 1;
+  unsigned long expected = MODEM_BACKOFF_BASE_MS;
+  Serial.print("  backoff ms:");
+  for (unsigned long wait : waits) {
+    Serial.printf(" %lu", wait);
+    // The power sequence restarts with a 100 ms reset setup time
+    doubling &= wait >= expected + 100 && wait <= expected + 150;
+    expected = min(expected * 2, (unsigned long)MODEM_BACKOFF_MAX_MS);
+  }
+  Serial.println();
+  check(doubling, "backoff doubles from MODEM_BACKOFF_BASE_MS up to MODEM_BACKOFF_MAX_MS");
+  check(manager.getState() == MODEM_FAILED && counter(manager, "modem_failures") == String(attempts),
+        "gives up after the attempt cap");
+}
+
+static void lockedSimRecovery() {
+  AtResponder responder(MODEM_BOOT_MS);
+  responder.script("AT+CPIN? => +CPIN: SIM PIN|OK");
+  responder.script(HEALTHY);
+  TinyGsm modem(responder);
+  ScriptedModemManager manager(&modem, responder);
+
+  manager.begin(0);  // Unlimited attempts, as in setup mode
+  std::vector<StateEntry> entries = run(manager, 200000);
+  check(manager.getState() == MODEM_FAILED && strcmp(manager.getLastError(), "sim_locked") == 0,
+        "locked SIM fails at once even with unlimited attempts");
+  check(countState(entries, MODEM_BACKOFF) == 0 && responder.count("AT+CPIN?") == 1,
+        "locked SIM is not retried");
+
+  // PIN removed on another device and the SIM reinserted
+  responder.clearScript();
+  responder.script(HEALTHY);
+  manager.begin(MODEM_BOOT_MAX_ATTEMPTS);
+  run(manager, 120000);
+  check(manager.isConnected() && counter(manager, "modem_connects") == "1",
+        "a fresh begin() connects once the SIM is unlocked");
+}
+
+static void deniedRegistrationRecovery() {
+  AtResponder responder(MODEM_BOOT_MS);
+  responder.script("AT+CGREG? x1 => +CGREG: 0,3|OK");
+  responder.script(HEALTHY);
+  TinyGsm modem(responder);
+  ScriptedModemManager manager(&modem, responder);
+
+  manager.begin(MODEM_BOOT_MAX_ATTEMPTS);
+  std::vector<StateEntry> entries = run(manager, 120000);
+  check(manager.isConnected(), "connects on the attempt after a denied registration");
+  check(countState(entries, MODEM_BACKOFF) == 1 && counter(manager, "modem_failures") == "1" &&
+        strcmp(manager.getLastError(), "registration_denied") == 0,
+        "denial costs one failed attempt and one backoff");
+}
+
+static void connectionLoss() {
+  AtResponder responder(MODEM_BOOT_MS);
+  responder.script(HEALTHY);
+  TinyGsm modem(responder);
+  ScriptedModemManager manager(&modem, responder);
+
+  manager.begin(MODEM_BOOT_MAX_ATTEMPTS);
+  run(manager, 120000);
+
+  // Coverage drops for two polls, then comes back
+  responder.clearScript();
+  responder.script("AT+CGREG? x2 => +CGREG: 0,2|OK");
+  responder.script(HEALTHY);
+  std::vector<StateEntry> entries = run(manager, 2 * MODEM_HEALTH_CHECK_MS, true);
+
+  check(countState(entries, MODEM_REGISTERING) == 1 && countState(entries, MODEM_POWERING) == 0,
+        "lost link drops back to registration without a power cycle");
+  check(manager.isConnected() && counter(manager, "modem_losses") == "1", "link comes back after the loss");
+}
+
+void runModemTests() {
+  hostUseManualClock(true);
+  bringUpLatency();
+  atTimeout();
+  stageTimeouts();
+  retryBackoff();
+  lockedSimRecovery();
+  deniedRegistrationRecovery();
+  connectionLoss();
+  hostUseManualClock(false);
+}
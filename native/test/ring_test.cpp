@@ -0,0 +1,193 @@
+// SpscRing and MpscRing on one thread and across several. Build with
+// -fsanitize=thread (env:native_tsan) to have the sanitizer check the
+// ordering as well.
+
+#include "test.h"
+#include "../../src/Utils/ring_buffer.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <thread>
+#include <vector>
+
+#define RING_TEST_ITEMS 1000000
+#define RING_TEST_PRODUCERS 4
+
+// Larger than a word so a torn copy shows up as a mismatched check field
+struct RingItem {
+  uint32_t sequence;
+  uint32_t inverse;
+  uint64_t payload;
+};
+
+static RingItem makeItem(uint32_t sequence) {
+  return {sequence, ~sequence, (uint64_t)sequence * 2654435761u};
+}
+
+static bool isIntact(const RingItem& item) {
+  return item.inverse == ~item.sequence && item.payload == (uint64_t)item.sequence * 2654435761u;
+}
+
+// Same single-threaded checks for both rings
+template <typename Ring>
+static void fillAndDrain(Ring& ring) {
+  RingItem item;
+  check(ring.empty() && !ring.pop(item), "new ring is empty");
+
+  bool pushed = true;
+  for (uint32_t i = 0; i < 8; i++) {
+    pushed &= ring.push(makeItem(i));
+  }
+  check(pushed && ring.size() == 8 && !ring.push(makeItem(8)), "ring takes exactly its capacity");
+
+  bool ordered = true;
+  for (uint32_t i = 0; i < 8; i++) {
+    ordered &= ring.pop(item) && item.sequence == i;
+  }
+  check(ordered && ring.empty(), "items come out in push order");
+
+  // Run the indices around the ring many times with the fill level varying
+  bool wrapped = true;
+  uint32_t next = 0;
+  uint32_t expected = 0;
+  for (int round = 0; round < 1000; round++) {
+    for (int i = 0; i < round % 8 + 1; i++) {
+      wrapped &= ring.push(makeItem(next++));
+    }
+    while (ring.pop(item)) {
+      wrapped &= item.sequence == expected++ && isIntact(item);
+    }
+  }
+  check(wrapped && expected == next, "order holds across wraparound");
+}
+
+// Producer spins on a full ring, consumer on an empty one
+static void spinningThreads() {
+  static SpscRing<RingItem, 16> ring;
+  std::thread producer([]() {
+    for (uint32_t i = 0; i < RING_TEST_ITEMS; i++) {
+      while (!ring.push(makeItem(i))) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint32_t expected = 0;
+  bool ok = true;
+  RingItem item;
+  while (expected < RING_TEST_ITEMS) {
+    if (!ring.pop(item)) {
+      std::this_thread::yield();
+      continue;
+    }
+    ok &= item.sequence == expected && isIntact(item);
+    expected++;
+  }
+  producer.join();
+  check(ok && ring.empty(), "one million items cross threads in order and intact");
+}
+
+// Producers race for the tail while one consumer drains. Each producer's
+// items must arrive in its own order; how they interleave is up to the ring.
+static void multipleProducers() {
+  static MpscRing<RingItem, 16> ring;
+  const uint32_t perProducer = RING_TEST_ITEMS / RING_TEST_PRODUCERS;
+  std::vector<std::thread> producers;
+  for (uint32_t p = 0; p < RING_TEST_PRODUCERS; p++) {
+    producers.emplace_back([p, perProducer]() {
+      for (uint32_t i = 0; i < perProducer; i++) {
+        while (!ring.push(makeItem(p << 24 | i))) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  uint32_t next[RING_TEST_PRODUCERS] = {};
+  uint32_t received = 0;
+  bool ok = true;
+  RingItem item;
+  while (received < perProducer * RING_TEST_PRODUCERS) {
+    if (!ring.pop(item)) {
+      std::this_thread::yield();
+      continue;
+    }
+    // Keep draining after a bad item so the producers can finish
+    uint32_t producer = item.sequence >> 24;
+    if (producer < RING_TEST_PRODUCERS && isIntact(item) && (item.sequence & 0xFFFFFF) == next[producer]) {
+      next[producer]++;
+    } else {
+      ok = false;
+    }
+    received++;
+  }
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  check(ok, "four producers' items arrive intact and in each producer's order");
+  check(ok && ring.empty(), "nothing is left or duplicated once the producers are done");
+}
+
+// The pipeline's pattern: the producer drops when full and notifies, the
+// consumer drains and then sleeps on the notification
+static TaskHandle_t consumerHandle = nullptr;
+static SpscRing<RingItem, 16> notifiedRing;
+static std::atomic<uint32_t> received(0);
+static std::atomic<bool> inOrder(true);
+static std::atomic<bool> stopConsumer(false);
+
+static void consumerTask(void*) {
+  uint32_t last = 0;
+  bool first = true;
+  while (!stopConsumer) {
+    RingItem item;
+    if (!notifiedRing.pop(item)) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    if (!isIntact(item) || (!first && item.sequence <= last)) {
+      inOrder = false;
+    }
+    first = false;
+    last = item.sequence;
+    received++;
+  }
+  vTaskDelete(nullptr);
+}
+
+static void notifiedHandOff() {
+  xTaskCreatePinnedToCore(consumerTask, "ring_consumer", 4096, nullptr, 2, &consumerHandle, 1);
+
+  uint32_t pushed = 0;
+  uint32_t dropped = 0;
+  for (uint32_t i = 0; i < RING_TEST_ITEMS / 10; i++) {
+    if (notifiedRing.push(makeItem(i))) {
+      pushed++;
+      xTaskNotifyGive(consumerHandle);
+    } else {
+      // Let the consumer catch up, as the sampler does between periods
+      dropped++;
+      std::this_thread::yield();
+    }
+  }
+
+  unsigned long start = millis();
+  while (received < pushed && millis() - start < 5000) {
+    delay(1);
+  }
+  Serial.printf("  %lu pushed, %lu dropped while the consumer was behind\n", (unsigned long)pushed,
+                (unsigned long)dropped);
+  check(received == pushed && inOrder, "notified consumer sees every pushed item, in order");
+
+  stopConsumer = true;
+  xTaskNotifyGive(consumerHandle);
+}
+
+void runRingTests() {
+  static SpscRing<RingItem, 8> spsc;
+  static MpscRing<RingItem, 8> mpsc;
+  fillAndDrain(spsc);
+  fillAndDrain(mpsc);
+  spinningThreads();
+  multipleProducers();
+  notifiedHandOff();
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+// Host unit tests. Each suite is a function that runs its cases through
+// check(); main() runs the suites named on the command line (all by
+// default) and exits non-zero if any check failed.
+
+#include <Arduino.h>
+
+void check(bool ok, const char* what);
+
+void runModemTests();
+void runAddressIndexTests();
+void runRingTests();
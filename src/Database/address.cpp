@@ -1,5 +1,8 @@
 #include "address.h"
 #include <ArduinoHttpClient.h>
+#include "../Storage/address_cache.h"
+#include "address_index.h"
+#include "../Utils/net_timing.h"
 
 AddressDB::AddressDB(TinyGsm* modem_ref, TinyGsmClientSecure* client_ref) 
   : modem(modem_ref), client(client_ref) {
@@ -9,6 +12,64 @@ AddressDB::~AddressDB() {
 }
 
 String AddressDB::getAddressDropdownData(const String& regCode, const String& provCode, const String& cityMunCode) {
+  // The bundled index answers everything locally when it is flashed
+  if (addressIndex.begin()) {
+    return getIndexedDropdownData(regCode, provCode, cityMunCode);
+  }
+
+  // The PSGC hierarchy rarely changes; serve it locally when we can
+  String cacheKey = AddressCache::makeKey(regCode, provCode, cityMunCode);
+  String cached;
+  AddressCacheResult cacheResult = addressCache.lookup(cacheKey, cached);
+  if (cacheResult == ADDRESS_CACHE_FRESH) {
+    addressCache.printStats();
+    return cached;
+  }
+
+  String body = fetchAddressDropdownData(regCode, provCode, cityMunCode);
+  
+  JsonDocument doc;
+  if (!deserializeJson(doc, body) && doc["success"].as<bool>()) {
+    addressCache.store(cacheKey, body);
+  } else if (cacheResult == ADDRESS_CACHE_STALE) {
+    Serial.println("Address fetch failed, serving expired cache entry");
+    body = cached;
+  }
+  addressCache.printStats();
+  return body;
+}
+
+String AddressDB::getIndexedDropdownData(const String& regCode, const String& provCode, const String& cityMunCode) {
+  // Same shape as /api/address: only the level being asked for is filled in
+  String out = "{\"success\":true,\"data\":{\"regions\":";
+  if (regCode.isEmpty() && provCode.isEmpty() && cityMunCode.isEmpty()) {
+    addressIndex.appendJson(out, ADDRESS_LEVEL_REGION, "", "reg_code", "reg_desc");
+  } else {
+    out += "[]";
+  }
+  out += ",\"provinces\":";
+  if (!regCode.isEmpty()) {
+    addressIndex.appendJson(out, ADDRESS_LEVEL_PROVINCE, regCode, "prov_code", "prov_desc");
+  } else {
+    out += "[]";
+  }
+  out += ",\"cities\":";
+  if (!provCode.isEmpty()) {
+    addressIndex.appendJson(out, ADDRESS_LEVEL_CITY, provCode, "citymun_code", "citymun_desc");
+  } else {
+    out += "[]";
+  }
+  out += ",\"barangays\":";
+  if (!cityMunCode.isEmpty()) {
+    addressIndex.appendJson(out, ADDRESS_LEVEL_BARANGAY, cityMunCode, "brgy_code", "brgy_desc");
+  } else {
+    out += "[]";
+  }
+  out += "}}";
+  return out;
+}
+
+String AddressDB::fetchAddressDropdownData(const String& regCode, const String& provCode, const String& cityMunCode) {
   if (!modem || !client) {
     Serial.println("Modem or client not initialized");
     return "{}";
@@ -36,7 +97,9 @@ String AddressDB::getAddressDropdownData(const String& regCode, const String& pr
 
   Serial.println("Fetching address data from: " + endpoint);
 
-  HttpClient http(*client, SERVER_HOST, SERVER_PORT);
+  MeteredClient metered(*client);
+  HttpClient http(metered, SERVER_HOST, SERVER_PORT);
+  NetTrace trace(metered, NET_ADDRESS);
 
   Serial.print(F("Performing HTTPS GET request... "));
   http.connectionKeepAlive(); // Currently, this is needed for HTTPS
@@ -45,8 +108,10 @@ String AddressDB::getAddressDropdownData(const String& regCode, const String& pr
     Serial.println(F("failed to connect"));
     return "{\"success\":false,\"data\":{\"regions\":[],\"provinces\":[],\"cities\":[],\"barangays\":[]}}";
   }
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   Serial.print(F("Response status code: "));
   Serial.println(statusCode);
   
@@ -59,6 +124,9 @@ String AddressDB::getAddressDropdownData(const String& regCode, const String& pr
     String headerName = http.readHeaderName();
     String headerValue = http.readHeaderValue();
     Serial.println("    " + headerName + " : " + headerValue);
+    if (headerName.equalsIgnoreCase("Date")) {
+      addressCache.noteServerDate(headerValue);
+    }
   }
 
   int length = http.contentLength();
@@ -78,6 +146,7 @@ String AddressDB::getAddressDropdownData(const String& regCode, const String& pr
   Serial.println(body.length());
 
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   if (statusCode == 200) {
@@ -89,6 +158,12 @@ String AddressDB::getAddressDropdownData(const String& regCode, const String& pr
 }
 
 String AddressDB::getRegions() {
+  if (addressIndex.begin()) {
+    String result;
+    addressIndex.appendJson(result, ADDRESS_LEVEL_REGION, "", "reg_code", "reg_desc");
+    return result;
+  }
+  
   String result = getAddressDropdownData();
   
   JsonDocument doc;
@@ -105,6 +180,12 @@ String AddressDB::getRegions() {
 }
 
 String AddressDB::getProvinces(const String& regCode) {
+  if (addressIndex.begin()) {
+    String result;
+    addressIndex.appendJson(result, ADDRESS_LEVEL_PROVINCE, regCode, "prov_code", "prov_desc");
+    return result;
+  }
+  
   String result = getAddressDropdownData(regCode);
   
   JsonDocument doc;
@@ -121,6 +202,12 @@ String AddressDB::getProvinces(const String& regCode) {
 }
 
 String AddressDB::getMunicipalities(const String& provCode) {
+  if (addressIndex.begin()) {
+    String result;
+    addressIndex.appendJson(result, ADDRESS_LEVEL_CITY, provCode, "citymun_code", "citymun_desc");
+    return result;
+  }
+  
   String result = getAddressDropdownData("", provCode);
   
   JsonDocument doc;
@@ -137,6 +224,12 @@ String AddressDB::getMunicipalities(const String& provCode) {
 }
 
 String AddressDB::getBarangays(const String& cityMunCode) {
+  if (addressIndex.begin()) {
+    String result;
+    addressIndex.appendJson(result, ADDRESS_LEVEL_BARANGAY, cityMunCode, "brgy_code", "brgy_desc");
+    return result;
+  }
+  
   String result = getAddressDropdownData("", "", cityMunCode);
   
   JsonDocument doc;
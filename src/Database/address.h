@@ -49,14 +49,20 @@ private:
   TinyGsmClientSecure* client;
   HttpClient* httpClient;
 
+  // Dropdown response built from the bundled address index
+  String getIndexedDropdownData(const String& regCode, const String& provCode, const String& cityMunCode);
+
+  // Uncached /api/address request
+  String fetchAddressDropdownData(const String& regCode, const String& provCode, const String& cityMunCode);
+
 public:
   AddressDB(TinyGsm* modem_ref, TinyGsmClientSecure* client_ref);
   ~AddressDB();
 
-  // Use API endpoint for efficient address data retrieval
+  // Use API endpoint for efficient address data retrieval; served from the address cache when possible
   String getAddressDropdownData(const String& regCode = "", const String& provCode = "", const String& cityMunCode = "");
   
-  // Individual getters (legacy support)
+  // Individual getters (legacy support); binary search in the address index when flashed
   String getRegions();
   String getProvinces(const String& regCode);
   String getMunicipalities(const String& provCode);
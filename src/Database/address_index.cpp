@@ -0,0 +1,198 @@
+#include "address_index.h"
+#include "../Utils/crc32.h"
+
+AddressIndex addressIndex;
+
+static uint32_t pow10u(uint8_t exponent) {
+  uint32_t value = 1;
+  while (exponent--) {
+    value *= 10;
+  }
+  return value;
+}
+
+AddressIndex::AddressIndex()
+  : image(nullptr), header(nullptr), mapHandle(0), ready(false), attempted(false) {
+}
+
+bool AddressIndex::begin() {
+  if (attempted) {
+    return ready;
+  }
+  attempted = true;
+
+  const esp_partition_t* partition = esp_partition_find_first(
+    ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ADDRESS_INDEX_SUBTYPE, ADDRESS_INDEX_PARTITION);
+  if (!partition) {
+    Serial.println("Address index partition not found");
+    return false;
+  }
+
+  AddressIndexHeader probe;
+  if (esp_partition_read(partition, 0, &probe, sizeof(probe)) != ESP_OK ||
+      probe.magic != ADDRESS_INDEX_MAGIC || probe.version != ADDRESS_INDEX_FORMAT ||
+      probe.levelCount != ADDRESS_LEVEL_COUNT || probe.imageSize > partition->size ||
+      probe.imageSize < sizeof(AddressIndexHeader)) {
+    Serial.println("Address index partition is empty or has an unknown format");
+    return false;
+  }
+
+  const void* mapped = nullptr;
+  if (esp_partition_mmap(partition, 0, probe.imageSize, ESP_PARTITION_MMAP_DATA, &mapped, &mapHandle) != ESP_OK) {
+    Serial.println("✗ Failed to map address index");
+    return false;
+  }
+  image = (const uint8_t*)mapped;
+  header = (const AddressIndexHeader*)image;
+
+  // One pass at startup catches a half-flashed image; the bounds checks keep
+  // lookups inside the mapping even if the packer wrote a bad table
+  unsigned long startMs = millis();
+  uint32_t crc = crc32Update(0, image + sizeof(AddressIndexHeader), header->imageSize - sizeof(AddressIndexHeader));
+  if (crc != header->crc) {
+    Serial.println("✗ Address index failed verification");
+    unmap();
+    return false;
+  }
+  if (!checkBounds()) {
+    Serial.println("✗ Address index tables out of bounds");
+    unmap();
+    return false;
+  }
+
+  ready = true;
+  Serial.printf("Address index mapped: %u regions, %u provinces, %u cities, %u barangays (%u bytes, verified in %lu ms)\n",
+                header->levels[ADDRESS_LEVEL_REGION].count, header->levels[ADDRESS_LEVEL_PROVINCE].count,
+                header->levels[ADDRESS_LEVEL_CITY].count, header->levels[ADDRESS_LEVEL_BARANGAY].count,
+                header->imageSize, millis() - startMs);
+  return true;
+}
+
+void AddressIndex::unmap() {
+  esp_partition_munmap(mapHandle);
+  image = nullptr;
+  header = nullptr;
+}
+
+bool AddressIndex::checkBounds() const {
+  uint32_t stringsOffset = header->stringsOffset;
+  if (stringsOffset > header->imageSize || header->stringsSize > header->imageSize - stringsOffset) {
+    return false;
+  }
+
+  uint8_t parentDigits = 0;
+  for (int i = 0; i < ADDRESS_LEVEL_COUNT; i++) {
+    const AddressIndexLevel& level = header->levels[i];
+    // Codes must fit in a uint32_t and extend the parent level's codes
+    if (level.digits <= parentDigits || level.digits > 9) {
+      return false;
+    }
+    parentDigits = level.digits;
+
+    if (level.offset < sizeof(AddressIndexHeader) || level.offset > stringsOffset ||
+        level.count > (stringsOffset - level.offset) / sizeof(AddressIndexEntry) ||
+        level.offset % alignof(AddressIndexEntry) != 0) {
+      return false;
+    }
+    const AddressIndexEntry* entries = levelEntries((AddressLevel)i);
+    for (uint32_t j = 0; j < level.count; j++) {
+      if ((entries[j].desc >> 8) + (entries[j].desc & 0xFF) > header->stringsSize) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool AddressIndex::isReady() const {
+  return ready;
+}
+
+const AddressIndexEntry* AddressIndex::levelEntries(AddressLevel level) const {
+  return (const AddressIndexEntry*)(image + header->levels[level].offset);
+}
+
+const AddressIndexEntry* AddressIndex::lowerBound(AddressLevel level, uint32_t code) const {
+  const AddressIndexEntry* entries = levelEntries(level);
+  size_t low = 0;
+  size_t high = header->levels[level].count;
+  while (low < high) {
+    size_t mid = (low + high) / 2;
+    if (entries[mid].code < code) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return entries + low;
+}
+
+size_t AddressIndex::children(AddressLevel level, const String& parentCode, const AddressIndexEntry** first) const {
+  if (!ready || level >= ADDRESS_LEVEL_COUNT) {
+    return 0;
+  }
+
+  if (level == ADDRESS_LEVEL_REGION) {
+    *first = levelEntries(level);
+    return header->levels[level].count;
+  }
+
+  // Child codes extend the parent code: [parent * 10^d, (parent + 1) * 10^d)
+  const AddressIndexLevel& parentLevel = header->levels[level - 1];
+  if (parentCode.length() != parentLevel.digits) {
+    return 0;
+  }
+  uint32_t scale = pow10u(header->levels[level].digits - parentLevel.digits);
+  uint32_t parent = strtoul(parentCode.c_str(), nullptr, 10);
+  const AddressIndexEntry* begin = lowerBound(level, parent * scale);
+  const AddressIndexEntry* end = lowerBound(level, (parent + 1) * scale);
+  *first = begin;
+  return end - begin;
+}
+
+const char* AddressIndex::description(const AddressIndexEntry& entry, size_t& length) const {
+  length = entry.desc & 0xFF;
+  return (const char*)(image + header->stringsOffset + (entry.desc >> 8));
+}
+
+String AddressIndex::formatCode(AddressLevel level, uint32_t code) const {
+  // Zero-padded to the level's width; begin() caps widths at 9 digits
+  char buffer[10];
+  uint8_t digits = header->levels[level].digits;
+  buffer[digits] = '\0';
+  for (int i = digits - 1; i >= 0; i--) {
+    buffer[i] = '0' + code % 10;
+    code /= 10;
+  }
+  return String(buffer);
+}
+
+void AddressIndex::appendJson(String& out, AddressLevel level, const String& parentCode,
+                              const char* codeKey, const char* descKey) const {
+  const AddressIndexEntry* first = nullptr;
+  size_t count = children(level, parentCode, &first);
+
+  out += '[';
+  for (size_t i = 0; i < count; i++) {
+    size_t length = 0;
+    const char* desc = description(first[i], length);
+    if (i > 0) {
+      out += ',';
+    }
+    out += "{\"";
+    out += codeKey;
+    out += "\":\"";
+    out += formatCode(level, first[i].code);
+    out += "\",\"";
+    out += descKey;
+    out += "\":\"";
+    for (size_t j = 0; j < length; j++) {
+      if (desc[j] == '"' || desc[j] == '\\') {
+        out += '\\';
+      }
+      out += desc[j];
+    }
+    out += "\"}";
+  }
+  out += ']';
+}
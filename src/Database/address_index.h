@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <esp_partition.h>
+
+// Levels of the PSGC hierarchy, in index order
+enum AddressLevel {
+  ADDRESS_LEVEL_REGION,
+  ADDRESS_LEVEL_PROVINCE,
+  ADDRESS_LEVEL_CITY,
+  ADDRESS_LEVEL_BARANGAY,
+  ADDRESS_LEVEL_COUNT
+};
+
+// On-flash layout written by tools/pack_addresses.py; keep the two in sync
+#define ADDRESS_INDEX_MAGIC 0x49475350 // "PSGI"
+#define ADDRESS_INDEX_FORMAT 1
+
+struct AddressIndexLevel {
+  uint32_t offset;
+  uint32_t count;
+  uint8_t digits;
+  uint8_t reserved[3];
+};
+
+struct AddressIndexHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t levelCount;
+  uint32_t imageSize;
+  uint32_t crc;   // CRC-32 of everything after the header
+  AddressIndexLevel levels[ADDRESS_LEVEL_COUNT];
+  uint32_t stringsOffset;
+  uint32_t stringsSize;
+};
+
+struct AddressIndexEntry {
+  uint32_t code;
+  uint32_t desc;  // String table offset << 8 | length
+};
+
+// Read-only PSGC table memory-mapped from the addridx partition. Each level is
+// sorted by code and codes are hierarchical, so children are one binary search away
+// and entries are read in place without copying.
+class AddressIndex {
+private:
+  const uint8_t* image;
+  const AddressIndexHeader* header;
+  esp_partition_mmap_handle_t mapHandle;
+  bool ready;
+  bool attempted;
+
+  const AddressIndexEntry* levelEntries(AddressLevel level) const;
+  const AddressIndexEntry* lowerBound(AddressLevel level, uint32_t code) const;
+  bool checkBounds() const;
+  void unmap();
+
+public:
+  AddressIndex();
+
+  // Map and validate the partition once; false if it is missing or not a valid image
+  bool begin();
+  bool isReady() const;
+
+  // Children of parentCode at the given level (all regions for ADDRESS_LEVEL_REGION)
+  size_t children(AddressLevel level, const String& parentCode, const AddressIndexEntry** first) const;
+
+  // Description bytes of an entry; not NUL-terminated
+  const char* description(const AddressIndexEntry& entry, size_t& length) const;
+  String formatCode(AddressLevel level, uint32_t code) const;
+
+  // Append the children as a JSON array of {codeKey, descKey} objects
+  void appendJson(String& out, AddressLevel level, const String& parentCode,
+                  const char* codeKey, const char* descKey) const;
+};
+
+extern AddressIndex addressIndex;
@@ -144,8 +144,34 @@ DeviceData parseDeviceDataJSON(const JsonDocument &doc)
   return parseDeviceDataJSON(doc.as<JsonObjectConst>());
 }
 
+SampleRecord createSampleRecord(const DeviceData &deviceData, uint32_t timestampMs)
+{
+  SampleRecord record;
+  record.timestampMs = timestampMs;
+  record.tof = deviceData.tof;
+  record.force0 = deviceData.force0;
+  record.force1 = deviceData.force1;
+  record.weight = deviceData.weight;
+  record.turbidity = deviceData.turbidity;
+  record.ultrasonic = deviceData.ultrasonic;
+  record.batteryVoltage = deviceData.batteryVoltage;
+  record.solarWattage = deviceData.solarWattage;
+  return record;
+}
 
-
+void applySampleRecord(const SampleRecord &record, DeviceData &deviceData)
+{
+  deviceData.tof = record.tof;
+  deviceData.force0 = record.force0;
+  deviceData.force1 = record.force1;
+  deviceData.weight = record.weight;
+  deviceData.turbidity = record.turbidity;
+  deviceData.ultrasonic = record.ultrasonic;
+  deviceData.batteryVoltage = record.batteryVoltage;
+  deviceData.solarWattage = record.solarWattage;
+  deviceData.createdAt = String(record.timestampMs);
+  deviceData.lastUpdatedAt = String(record.timestampMs);
+}
 
 String createDeviceJSON(const Device &device)
 {
@@ -52,6 +52,22 @@ struct DeviceData {
   String createdAt;
 };
 
+// Compact fixed-size sample used for buffering (RTC memory, flash, streaming)
+struct SampleRecord {
+  uint32_t timestampMs;  // Capture time in ms since first boot
+  float tof;
+  float force0;
+  float force1;
+  float weight;
+  float turbidity;
+  float ultrasonic;
+  float batteryVoltage;
+  float solarWattage;
+};
+
+SampleRecord createSampleRecord(const DeviceData &deviceData, uint32_t timestampMs);
+void applySampleRecord(const SampleRecord &record, DeviceData &deviceData);
+
 JsonDocument createDeviceDataJSONObject(const DeviceData &deviceData);
 String createDeviceDataJSON(const DeviceData &deviceData);
 DeviceData parseDeviceDataJSON(const JsonObject &obj);
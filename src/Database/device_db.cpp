@@ -1,21 +1,29 @@
 #include "device_db.h"
+#include "../Power/cpu_frequency.h"
+#include "../Utils/net_timing.h"
 #include <ArduinoJson.h>
 #include <ArduinoHttpClient.h>
 
 DeviceDB::DeviceDB(TinyGsm* modem_ref, TinyGsmClientSecure* client_ref) 
-  : modem(modem_ref), client(client_ref) {
+  : modem(modem_ref), client(client_ref), lastPayloadBytes(0) {
 }
 
 DeviceDB::~DeviceDB() {
 }
 
 int DeviceDB::createDevice(const Device& device) {
-  String deviceJson = createDeviceJSON(device);
+  String deviceJson;
+  {
+    CpuBoostLock boost;
+    deviceJson = createDeviceJSON(device);
+  }
 
   Serial.println(F("Creating device JSON:"));
   Serial.println(deviceJson);
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_CREATE);
 
   Serial.print(F("Performing HTTPS POST request... "));
   
@@ -37,8 +45,10 @@ int DeviceDB::createDevice(const Device& device) {
 
   // Send the JSON payload
   http.print(deviceJson);
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   Serial.print(F("Response status code: "));
   Serial.println(statusCode);
   
@@ -71,6 +81,7 @@ int DeviceDB::createDevice(const Device& device) {
   Serial.println(body.length());
 
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   Serial.printf("Create Device Response - Status: %d\n", statusCode);
@@ -83,7 +94,9 @@ int DeviceDB::updateDevice(const Device& device) {
   String deviceJson = createDeviceJSON(device);
   String endpoint = "/api/devices?uuid=" + device.uuid;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_UPDATE);
 
   Serial.print(F("Performing HTTPS PUT request... "));
   
@@ -105,11 +118,14 @@ int DeviceDB::updateDevice(const Device& device) {
 
   // Send the JSON payload
   http.print(deviceJson);
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   String body = http.responseBody();
   
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   return statusCode;
@@ -118,7 +134,9 @@ int DeviceDB::updateDevice(const Device& device) {
 String DeviceDB::getDevice(const String& deviceId) {
   String endpoint = "/api/devices?uuid=" + deviceId;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_READ);
 
   Serial.print(F("Performing HTTPS GET request... "));
   http.connectionKeepAlive(); // Currently, this is needed for HTTPS
@@ -127,8 +145,10 @@ String DeviceDB::getDevice(const String& deviceId) {
     Serial.println(F("failed to connect"));
     return "{}";
   }
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   Serial.print(F("Response status code: "));
   Serial.println(statusCode);
   
@@ -139,6 +159,7 @@ String DeviceDB::getDevice(const String& deviceId) {
 
   String body = http.responseBody();
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   if (statusCode == 200) {
@@ -150,7 +171,9 @@ String DeviceDB::getDevice(const String& deviceId) {
 String DeviceDB::getDeviceByOwnerId(const String& ownerId) {
   String endpoint = "/api/devices?ownerUuid=" + ownerId;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_READ);
 
   Serial.print(F("Performing HTTPS GET request... "));
   http.connectionKeepAlive(); // Currently, this is needed for HTTPS
@@ -159,11 +182,14 @@ String DeviceDB::getDeviceByOwnerId(const String& ownerId) {
     Serial.println(F("failed to connect"));
     return "{}";
   }
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   String body = http.responseBody();
   
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   if (statusCode == 200) {
@@ -175,7 +201,9 @@ String DeviceDB::getDeviceByOwnerId(const String& ownerId) {
 int DeviceDB::removeDevice(const String& deviceId) {
   String endpoint = "/api/devices?uuid=" + deviceId;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_UPDATE);
 
   Serial.print(F("Performing HTTPS DELETE request... "));
   http.connectionKeepAlive(); // Currently, this is needed for HTTPS
@@ -189,17 +217,32 @@ int DeviceDB::removeDevice(const String& deviceId) {
   http.sendHeader("User-Agent", "SmartEchoDrain/1.0");
   http.sendHeader("X-API-Key", ESP32_API_KEY);
   http.endRequest();
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   http.stop();
+  trace.finish(statusCode);
   
   return statusCode;
 }
 
 int DeviceDB::createDeviceData(const DeviceData& deviceData) {
-  String deviceDataJson = createDeviceDataJSON(deviceData);
+  String deviceDataJson;
+  {
+    // Serialization is the only CPU-bound part; TLS runs on the modem
+    CpuBoostLock boost;
+    deviceDataJson = createDeviceDataJSON(deviceData);
+  }
+  return postDeviceData(deviceDataJson.c_str(), deviceDataJson.length());
+}
+
+int DeviceDB::postDeviceData(const char* json, size_t length) {
+  lastPayloadBytes = length;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_DATA);
 
   Serial.print(F("Performing HTTPS POST request... "));
   
@@ -216,16 +259,19 @@ int DeviceDB::createDeviceData(const DeviceData& deviceData) {
   http.sendHeader("Accept", "application/json");
   http.sendHeader("User-Agent", "SmartEchoDrain/1.0");
   http.sendHeader("X-API-Key", ESP32_API_KEY);
-  http.sendHeader("Content-Length", deviceDataJson.length());
+  http.sendHeader("Content-Length", (int)length);
   http.endRequest();
 
   // Send the JSON payload
-  http.print(deviceDataJson);
+  http.write((const uint8_t*)json, length);
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   String body = http.responseBody();
   
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   Serial.printf("Create Device Data Response - Status: %d\n", statusCode);
@@ -238,7 +284,9 @@ int DeviceDB::updateDeviceData(const DeviceData& deviceData) {
   String deviceDataJson = createDeviceDataJSON(deviceData);
   String endpoint = "/api/device-data?deviceId=" + deviceData.deviceId;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_DATA);
 
   Serial.print(F("Performing HTTPS PUT request... "));
   
@@ -260,9 +308,12 @@ int DeviceDB::updateDeviceData(const DeviceData& deviceData) {
 
   // Send the JSON payload
   http.print(deviceDataJson);
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   http.stop();
+  trace.finish(statusCode);
 
   return statusCode;
 }
@@ -270,7 +321,9 @@ int DeviceDB::updateDeviceData(const DeviceData& deviceData) {
 String DeviceDB::getDeviceData(const String& deviceId) {
   String endpoint = "/api/device-data?deviceId=" + deviceId;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_READ);
 
   Serial.print(F("Performing HTTPS GET request... "));
   http.connectionKeepAlive(); // Currently, this is needed for HTTPS
@@ -279,11 +332,14 @@ String DeviceDB::getDeviceData(const String& deviceId) {
     Serial.println(F("failed to connect"));
     return "{}";
   }
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   String body = http.responseBody();
   
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   if (statusCode == 200) {
@@ -295,7 +351,9 @@ String DeviceDB::getDeviceData(const String& deviceId) {
 String DeviceDB::getLatestDeviceData(const String& deviceId) {
   String endpoint = "/api/device-data?deviceId=" + deviceId + "&latest=true";
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_READ);
 
   Serial.print(F("Performing HTTPS GET request... "));
   http.connectionKeepAlive(); // Currently, this is needed for HTTPS
@@ -304,11 +362,14 @@ String DeviceDB::getLatestDeviceData(const String& deviceId) {
     Serial.println(F("failed to connect"));
     return "{}";
   }
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   String body = http.responseBody();
   
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   if (statusCode == 200) {
@@ -326,7 +387,9 @@ int DeviceDB::updateDeviceStatus(const String& deviceId, bool isOnline) {
   
   String endpoint = "/api/devices?uuid=" + deviceId;
   
-  HttpClient http(*client, SERVER_HOST, SERVER_PORT);
+  MeteredClient metered(*client);
+  HttpClient http(metered, SERVER_HOST, SERVER_PORT);
+  NetTrace trace(metered, NET_DEVICE_UPDATE);
 
   Serial.print(F("Performing HTTPS PUT request... "));
   
@@ -348,9 +411,12 @@ int DeviceDB::updateDeviceStatus(const String& deviceId, bool isOnline) {
 
   // Send the JSON payload
   http.print(updateJson);
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   http.stop();
+  trace.finish(statusCode);
 
   return statusCode;
 }
@@ -371,7 +437,9 @@ int DeviceDB::updateDeviceLocation(const String& deviceId, const AddressLocation
   
   String endpoint = "/api/devices?uuid=" + deviceId;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_DEVICE_UPDATE);
 
   Serial.print(F("Performing HTTPS PUT request... "));
   
@@ -393,13 +461,20 @@ int DeviceDB::updateDeviceLocation(const String& deviceId, const AddressLocation
 
   // Send the JSON payload
   http.print(updateJson);
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   http.stop();
+  trace.finish(statusCode);
 
   return statusCode;
 }
 
+size_t DeviceDB::getLastPayloadBytes() const {
+  return lastPayloadBytes;
+}
+
 Device DeviceDB::parseDeviceFromResponse(const String& response) {
   JsonDocument doc;
   deserializeJson(doc, response);
@@ -434,7 +509,9 @@ int DeviceDB::authenticateUser(const String& email, const String& password) {
   String authJson;
   serializeJson(authDoc, authJson);
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_AUTH);
 
   Serial.print(F("Performing HTTPS POST request... "));
   
@@ -456,11 +533,14 @@ int DeviceDB::authenticateUser(const String& email, const String& password) {
 
   // Send the JSON payload
   http.print(authJson);
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   String body = http.responseBody();
   
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   Serial.printf("Auth Response - Status: %d\n", statusCode);
@@ -469,29 +549,145 @@ int DeviceDB::authenticateUser(const String& email, const String& password) {
   return statusCode;
 }
 
-String DeviceDB::checkDeviceSetup(const String& deviceId) {
+bool DeviceDB::provisionDevice(const String& email, const String& password, const Device& device, ProvisionResult& result) {
+  result.authStatus = 0;
+  result.createStatus = 0;
+  result.connectMs = 0;
+  result.authMs = 0;
+  result.createMs = 0;
+  result.reusedConnection = false;
+
+  JsonDocument authDoc;
+  authDoc["email"] = email;
+  authDoc["password"] = password;
+  
+  String authJson;
+  String deviceJson;
+  {
+    CpuBoostLock boost;
+    serializeJson(authDoc, authJson);
+    deviceJson = createDeviceJSON(device);
+  }
+  
+  // Both requests share one HttpClient so the TLS session opened for the
+  // login is reused for the insert instead of paying a second handshake
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  http.connectionKeepAlive();
+  NetTrace authTrace(metered, NET_AUTH);
+
+  Serial.print(F("Provisioning: connecting... "));
+  unsigned long stepStart = millis();
+  http.beginRequest();
+  int err = http.post("/api/auth/login");
+  result.connectMs = millis() - stepStart;
+  if (err != 0) {
+    Serial.println(F("failed to connect"));
+    return false;
+  }
+  Serial.printf("connected in %lu ms\n", result.connectMs);
+
+  stepStart = millis();
+  http.sendHeader("Content-Type", "application/json");
+  http.sendHeader("Accept", "application/json");
+  http.sendHeader("User-Agent", "SmartEchoDrain/1.0");
+  http.sendHeader("X-API-Key", ESP32_API_KEY);
+  http.sendHeader("Content-Length", authJson.length());
+  http.endRequest();
+  http.print(authJson);
+  authTrace.sent();
+
+  result.authStatus = http.responseStatusCode();
+  authTrace.firstByte();
+  String body = http.responseBody();
+  result.authMs = millis() - stepStart;
+  authTrace.finish(result.authStatus);
+  Serial.printf("Auth Response - Status: %d (%lu ms)\n", result.authStatus, result.authMs);
+
+  if (result.authStatus != 200) {
+    http.stop();
+    Serial.println("Auth Response: " + body);
+    return false;
+  }
+
+  // Carry the session token into the insert so the server can attribute it
+  String token;
+  {
+    JsonDocument loginDoc;
+    if (!deserializeJson(loginDoc, body)) {
+      token = loginDoc["session"]["access_token"] | "";
+      if (token.isEmpty()) token = loginDoc["access_token"] | "";
+      if (token.isEmpty()) token = loginDoc["token"] | "";
+    }
+  }
+
+  // HttpClient reconnects on its own if the server closed after the login
+  result.reusedConnection = client->connected();
+
+  stepStart = millis();
+  NetTrace createTrace(metered, NET_DEVICE_CREATE);
+  http.beginRequest();
+  err = http.post("/api/devices");
+  if (err != 0) {
+    result.createMs = millis() - stepStart;
+    Serial.println(F("Provisioning: failed to reach device endpoint"));
+    return false;
+  }
+
+  http.sendHeader("Content-Type", "application/json");
+  http.sendHeader("Accept", "application/json");
+  http.sendHeader("User-Agent", "SmartEchoDrain/1.0");
+  http.sendHeader("X-API-Key", ESP32_API_KEY);
+  if (!token.isEmpty()) {
+    http.sendHeader("Authorization", "Bearer " + token);
+  }
+  http.sendHeader("Content-Length", deviceJson.length());
+  http.endRequest();
+  http.print(deviceJson);
+  createTrace.sent();
+
+  result.createStatus = http.responseStatusCode();
+  createTrace.firstByte();
+  body = http.responseBody();
+  result.createMs = millis() - stepStart;
+
+  http.stop();
+  createTrace.finish(result.createStatus);
+  Serial.println(F("Server disconnected"));
+
+  Serial.printf("Create Device Response - Status: %d (%lu ms, %s connection)\n",
+                result.createStatus, result.createMs,
+                result.reusedConnection ? "reused" : "new");
+  Serial.println("Response: " + body);
+
+  return result.createStatus == 200 || result.createStatus == 201;
+}
+
+int DeviceDB::checkDeviceSetup(const String& deviceId, String& response) {
   String endpoint = "/api/devices/setup-status?deviceId=" + deviceId;
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_SETUP_STATUS);
 
   Serial.print(F("Performing HTTPS GET request... "));
   http.connectionKeepAlive(); // Currently, this is needed for HTTPS
   int err = http.get(endpoint);
   if (err != 0) {
     Serial.println(F("failed to connect"));
-    return "{\"setup_completed\": false}";
+    return 0;
   }
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
-  String body = http.responseBody();
+  trace.firstByte();
+  response = http.responseBody();
   
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
-  if (statusCode == 200) {
-    return body;
-  }
-  return "{\"setup_completed\": false}";
+  return statusCode;
 }
 
 int DeviceDB::sendHeartbeat(const String& deviceId) {
@@ -503,7 +699,9 @@ int DeviceDB::sendHeartbeat(const String& deviceId) {
   String heartbeatJson;
   serializeJson(heartbeatDoc, heartbeatJson);
   
-  HttpClient http(*client, "smart-echodrain.vercel.app", 443);
+  MeteredClient metered(*client);
+  HttpClient http(metered, "smart-echodrain.vercel.app", 443);
+  NetTrace trace(metered, NET_HEARTBEAT);
 
   Serial.print(F("Performing HTTPS POST request... "));
   
@@ -525,9 +723,12 @@ int DeviceDB::sendHeartbeat(const String& deviceId) {
 
   // Send the JSON payload
   http.print(heartbeatJson);
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   http.stop();
+  trace.finish(statusCode);
 
   return statusCode;
 }
\ No newline at end of file
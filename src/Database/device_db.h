@@ -5,11 +5,22 @@
 #include <TinyGsmClient.h>
 #include <ArduinoHttpClient.h>
 
+// Outcome of provisionDevice(): status and wall time of each step
+struct ProvisionResult {
+  int authStatus;
+  int createStatus;
+  unsigned long connectMs;      // TCP + TLS handshake
+  unsigned long authMs;         // Login request/response on the open connection
+  unsigned long createMs;       // Device insert, normally on the same connection
+  bool reusedConnection;        // False if the server closed after login and we reconnected
+};
+
 class DeviceDB {
 private:
   TinyGsm* modem;
   TinyGsmClientSecure* client;
   HttpClient* httpClient;
+  size_t lastPayloadBytes;
 
 public:
   DeviceDB(TinyGsm* modem_ref, TinyGsmClientSecure* client_ref);
@@ -24,6 +35,7 @@ public:
   
   // Device data operations
   int createDeviceData(const DeviceData& deviceData);
+  int postDeviceData(const char* json, size_t length);  // Already serialized
   int updateDeviceData(const DeviceData& deviceData);
   String getDeviceData(const String& deviceId);
   String getLatestDeviceData(const String& deviceId);
@@ -34,9 +46,13 @@ public:
   
   // Authentication and setup
   int authenticateUser(const String& email, const String& password);
-  String checkDeviceSetup(const String& deviceId);
+  bool provisionDevice(const String& email, const String& password, const Device& device, ProvisionResult& result);
+  int checkDeviceSetup(const String& deviceId, String& response);
   int sendHeartbeat(const String& deviceId);
   
+  // Size of the last device data payload sent
+  size_t getLastPayloadBytes() const;
+  
   // Utility functions
   Device parseDeviceFromResponse(const String& response);
   DeviceData parseDeviceDataFromResponse(const String& response);
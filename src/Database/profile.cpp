@@ -1,5 +1,7 @@
 #include "profile.h"
 #include <ArduinoHttpClient.h>
+#include <LittleFS.h>
+#include "../Utils/net_timing.h"
 
 ProfileDB::ProfileDB(TinyGsm* modem_ref, TinyGsmClientSecure* client_ref) 
   : modem(modem_ref), client(client_ref) {
@@ -18,7 +20,9 @@ String ProfileDB::getPublicProfiles() {
 
   Serial.println("Fetching public profiles from: " + endpoint);
 
-  HttpClient http(*client, SERVER_HOST, SERVER_PORT);
+  MeteredClient metered(*client);
+  HttpClient http(metered, SERVER_HOST, SERVER_PORT);
+  NetTrace trace(metered, NET_PROFILES);
 
   Serial.print(F("Performing HTTPS GET request... "));
   http.connectionKeepAlive(); // Currently, this is needed for HTTPS
@@ -27,8 +31,10 @@ String ProfileDB::getPublicProfiles() {
     Serial.println(F("failed to connect"));
     return "{\"success\":false,\"profiles\":[]}";
   }
+  trace.sent();
 
   int statusCode = http.responseStatusCode();
+  trace.firstByte();
   Serial.print(F("Response status code: "));
   Serial.println(statusCode);
   
@@ -60,6 +66,7 @@ String ProfileDB::getPublicProfiles() {
   Serial.println(body.length());
 
   http.stop();
+  trace.finish(statusCode);
   Serial.println(F("Server disconnected"));
   
   if (statusCode == 200) {
@@ -79,6 +86,184 @@ String ProfileDB::getPublicProfiles() {
   }
 }
 
+#define PROFILE_ETAG_PATH PROFILE_CACHE_DIR "/etag"
+#define PROFILE_TMP_PATH PROFILE_CACHE_DIR "/owners.tmp"
+
+int ProfileDB::fetchProfilePage(int page, const String& etag, JsonDocument& doc, String& responseEtag) {
+  String endpoint = "/api/profiles/public/all?page=" + String(page) + "&limit=" + String(PROFILE_PAGE_SIZE);
+  Serial.println("Fetching public profiles from: " + endpoint);
+
+  MeteredClient metered(*client);
+  HttpClient http(metered, SERVER_HOST, SERVER_PORT);
+  NetTrace trace(metered, NET_PROFILES);
+  http.connectionKeepAlive(); // Currently, this is needed for HTTPS
+  http.beginRequest();
+  int err = http.get(endpoint);
+  if (err != 0) {
+    Serial.println(F("failed to connect"));
+    return 0;
+  }
+  if (!etag.isEmpty()) {
+    http.sendHeader("If-None-Match", etag);
+  }
+  http.sendHeader("Accept", "application/json");
+  http.endRequest();
+  trace.sent();
+
+  int statusCode = http.responseStatusCode();
+  trace.firstByte();
+  Serial.printf("Response status code: %d\n", statusCode);
+
+  while (http.headerAvailable()) {
+    String headerName = http.readHeaderName();
+    String headerValue = http.readHeaderValue();
+    if (headerName.equalsIgnoreCase("ETag")) {
+      responseEtag = headerValue;
+    }
+  }
+
+  if (statusCode == 200) {
+    // Keep only the fields the owner dropdown needs while parsing from the socket
+    JsonDocument filter;
+    filter["success"] = true;
+    filter["has_more"] = true;
+    filter["profiles"][0]["uuid"] = true;
+    filter["profiles"][0]["email"] = true;
+    filter["profiles"][0]["full_name"] = true;
+
+    DeserializationError error = deserializeJson(doc, http, DeserializationOption::Filter(filter));
+    if (error) {
+      Serial.printf("Failed to parse profiles page: %s\n", error.c_str());
+      statusCode = 0;
+    }
+  }
+
+  http.stop();
+  trace.finish(statusCode);
+  return statusCode;
+}
+
+bool ProfileDB::hasCachedOwnerList() {
+  return LittleFS.begin(true) && LittleFS.exists(PROFILE_OWNERS_PATH);
+}
+
+bool ProfileDB::refreshOwnerList() {
+  if (!LittleFS.begin(true)) {
+    Serial.println("✗ Failed to mount LittleFS for the owner list");
+    return false;
+  }
+  if (!LittleFS.exists(PROFILE_CACHE_DIR)) {
+    LittleFS.mkdir(PROFILE_CACHE_DIR);
+  }
+
+  bool haveCache = LittleFS.exists(PROFILE_OWNERS_PATH);
+  if (!modem || !client) {
+    Serial.println("Modem or client not initialized");
+    return haveCache;
+  }
+
+  String etag;
+  if (haveCache) {
+    File etagFile = LittleFS.open(PROFILE_ETAG_PATH, "r");
+    if (etagFile) {
+      etag = etagFile.readString();
+      etagFile.close();
+    }
+  }
+
+  File out = LittleFS.open(PROFILE_TMP_PATH, "w");
+  if (!out) {
+    return haveCache;
+  }
+  out.print("[");
+
+  String firstPageEtag;
+  size_t owners = 0;
+  bool complete = false;
+  for (int page = 1; page <= PROFILE_MAX_PAGES; page++) {
+    JsonDocument doc;
+    String responseEtag;
+    // The first page's ETag versions the whole list
+    int statusCode = fetchProfilePage(page, page == 1 ? etag : String(), doc, responseEtag);
+
+    if (page == 1 && statusCode == 304) {
+      Serial.println("✓ Owner list unchanged (304), using cached copy");
+      out.close();
+      LittleFS.remove(PROFILE_TMP_PATH);
+      return true;
+    }
+    if (statusCode != 200 || !doc["success"].as<bool>()) {
+      Serial.printf("✗ Failed to fetch profiles page %d\n", page);
+      break;
+    }
+    if (page == 1) {
+      firstPageEtag = responseEtag;
+    }
+
+    owners = writeOwners(doc["profiles"].as<JsonArrayConst>(), out, owners);
+
+    // Servers without pagination return everything on the first page
+    if (!(doc["has_more"] | false)) {
+      complete = true;
+      break;
+    }
+  }
+  out.print("]");
+  out.close();
+
+  if (!complete) {
+    LittleFS.remove(PROFILE_TMP_PATH);
+    if (haveCache) {
+      Serial.println("Serving cached owner list");
+    }
+    return haveCache;
+  }
+
+  LittleFS.remove(PROFILE_OWNERS_PATH);
+  LittleFS.rename(PROFILE_TMP_PATH, PROFILE_OWNERS_PATH);
+  if (firstPageEtag.isEmpty()) {
+    LittleFS.remove(PROFILE_ETAG_PATH);
+  } else {
+    File etagFile = LittleFS.open(PROFILE_ETAG_PATH, "w");
+    if (etagFile) {
+      etagFile.print(firstPageEtag);
+      etagFile.close();
+    }
+  }
+  Serial.printf("✓ Owner list refreshed: %u profiles\n", (unsigned)owners);
+  return true;
+}
+
+// Transform to what the setup page expects, straight into the output
+size_t ProfileDB::writeOwners(JsonArrayConst profiles, Print& out, size_t owners) {
+  for (JsonObjectConst profile : profiles) {
+    JsonDocument owner;
+    owner["uuid"] = profile["uuid"];
+    owner["email"] = profile["email"];
+
+    // Use full_name as display_name since that's what the API provides
+    String fullName = profile["full_name"].as<String>();
+    owner["display_name"] = fullName;
+    owner["full_name"] = fullName;
+
+    // Extract first_name and last_name from full_name for compatibility
+    int spaceIndex = fullName.indexOf(' ');
+    if (spaceIndex > 0) {
+      owner["first_name"] = fullName.substring(0, spaceIndex);
+      owner["last_name"] = fullName.substring(spaceIndex + 1);
+    } else {
+      owner["first_name"] = fullName;
+      owner["last_name"] = "";
+    }
+
+    if (owners++ > 0) {
+      out.print(",");
+    }
+    serializeJson(owner, out);
+  }
+  return owners;
+}
+
 ProfileInfo ProfileDB::parseProfileFromJSON(const JsonObject& obj) {
   ProfileInfo profile;
   
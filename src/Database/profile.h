@@ -5,7 +5,9 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <TinyGsmClient.h>
+#include <ArduinoHttpClient.h>
 
+#define PROFILE_OWNERS_PATH PROFILE_CACHE_DIR "/owners.json"
 
 struct ProfileInfo {
   String uuid;
@@ -20,12 +22,25 @@ private:
   TinyGsm* modem;
   TinyGsmClientSecure* client;
 
+  // One page of /api/profiles/public/all, filtered while it streams in
+  int fetchProfilePage(int page, const String& etag, JsonDocument& doc, String& responseEtag);
+
 public:
   ProfileDB(TinyGsm* modem_ref, TinyGsmClientSecure* client_ref);
   ~ProfileDB();
   
   // Get public profiles for dropdown selection
   String getPublicProfiles();
+
+  // Refresh the owner list persisted at PROFILE_OWNERS_PATH with a conditional GET,
+  // transforming page by page so the full list is never held in RAM.
+  // Returns false only if there is no usable list on flash.
+  bool refreshOwnerList();
+  bool hasCachedOwnerList();
+
+  // Append one page of public profiles to an owner list as comma-separated
+  // owner objects; returns the running owner count
+  static size_t writeOwners(JsonArrayConst profiles, Print& out, size_t owners);
   
   // Parse profile data from JSON
   ProfileInfo parseProfileFromJSON(const JsonObject& obj);
@@ -0,0 +1,293 @@
+#include "modem_manager.h"
+
+const char* modemStateName(ModemState state) {
+  switch (state) {
+  case MODEM_OFF:
+    return "off";
+  case MODEM_POWERING:
+    return "powering";
+  case MODEM_WAIT_AT:
+    return "wait_at";
+  case MODEM_WAIT_SIM:
+    return "wait_sim";
+  case MODEM_REGISTERING:
+    return "registering";
+  case MODEM_ATTACHING:
+    return "attaching";
+  case MODEM_CONNECTED:
+    return "connected";
+  case MODEM_BACKOFF:
+    return "backoff";
+  case MODEM_FAILED:
+    return "failed";
+  default:
+    return "unknown";
+  }
+}
+
+ModemManager::ModemManager(TinyGsm* modem_ref)
+  : modem(modem_ref), state(MODEM_OFF), stateEnteredMs(0), lastPollMs(0), bringUpStartMs(0),
+    backoffMs(0), attempts(0), maxAttempts(0), pwrkeyRetries(0), lastError(""),
+    lastBringUpMs(0), connects(0), failures(0), connectionLosses(0) {
+  for (int i = 0; i < MODEM_STATE_COUNT; i++) {
+    stateDurations[i] = 0;
+  }
+}
+
+ModemManager::~ModemManager() {
+}
+
+void ModemManager::setPower(bool on) {
+#ifdef BOARD_POWERON_PIN
+  pinMode(BOARD_POWERON_PIN, OUTPUT);
+  digitalWrite(BOARD_POWERON_PIN, on ? HIGH : LOW);
+#endif
+}
+
+void ModemManager::setReset(bool asserted) {
+#ifdef MODEM_RESET_PIN
+  pinMode(MODEM_RESET_PIN, OUTPUT);
+  digitalWrite(MODEM_RESET_PIN, asserted ? MODEM_RESET_LEVEL : !MODEM_RESET_LEVEL);
+#endif
+}
+
+void ModemManager::pulsePowerKey() {
+  pinMode(BOARD_PWRKEY_PIN, OUTPUT);
+  digitalWrite(BOARD_PWRKEY_PIN, LOW);
+  delay(100);
+  digitalWrite(BOARD_PWRKEY_PIN, HIGH);
+  delay(100);
+  digitalWrite(BOARD_PWRKEY_PIN, LOW);
+}
+
+void ModemManager::begin(uint8_t maxAttempts_) {
+  Serial.println("\n=== Initializing Modem ===");
+
+  // Initialize Serial for modem
+  SerialAT.begin(MODEM_BAUDRATE, SERIAL_8N1, MODEM_RX_PIN, MODEM_TX_PIN);
+
+  maxAttempts = maxAttempts_;
+  attempts = 0;
+  backoffMs = MODEM_BACKOFF_BASE_MS;
+  bringUpStartMs = millis();
+  for (int i = 0; i < MODEM_STATE_COUNT; i++) {
+    stateDurations[i] = 0;
+  }
+
+  startPowerSequence();
+}
+
+void ModemManager::startPowerSequence() {
+  setPower(true);
+  Serial.println("Modem power enabled");
+
+  // Reset is released from step() once the pulse width has elapsed
+  setReset(false);
+  delay(100);
+  setReset(true);
+  pwrkeyRetries = 0;
+  enterState(MODEM_POWERING);
+}
+
+void ModemManager::enterState(ModemState next) {
+  unsigned long now = millis();
+  if (state != MODEM_OFF) {
+    stateDurations[state] += now - stateEnteredMs;
+  }
+  if (next != state) {
+    Serial.printf("Modem: %s -> %s (%lu ms)\n", modemStateName(state), modemStateName(next), now - stateEnteredMs);
+  }
+
+  state = next;
+  stateEnteredMs = now;
+  lastPollMs = 0;
+}
+
+void ModemManager::fail(const char* reason) {
+  lastError = reason;
+  failures++;
+  attempts++;
+  Serial.printf("Modem bring-up failed: %s (attempt %u)\n", reason, attempts);
+
+  if (maxAttempts != 0 && attempts >= maxAttempts) {
+    enterState(MODEM_FAILED);
+    return;
+  }
+
+  enterState(MODEM_BACKOFF);
+  Serial.printf("Modem: retrying in %lu ms\n", backoffMs);
+}
+
+bool ModemManager::stateTimedOut(unsigned long timeoutMs) const {
+  return millis() - stateEnteredMs > timeoutMs;
+}
+
+ModemState ModemManager::step() {
+  unsigned long now = millis();
+
+  switch (state) {
+  case MODEM_POWERING:
+    if (now - stateEnteredMs >= MODEM_RESET_PULSE_MS) {
+      setReset(false);
+      Serial.println("Modem reset completed");
+      pulsePowerKey();
+      enterState(MODEM_WAIT_AT);
+    }
+    return state;
+
+  case MODEM_BACKOFF:
+    if (now - stateEnteredMs >= backoffMs) {
+      backoffMs = min(backoffMs * 2, (unsigned long)MODEM_BACKOFF_MAX_MS);
+      startPowerSequence();
+    }
+    return state;
+
+  case MODEM_OFF:
+  case MODEM_FAILED:
+    return state;
+
+  default:
+    break;
+  }
+
+  // Remaining states poll the modem at a fixed rate
+  unsigned long interval = state == MODEM_CONNECTED ? MODEM_HEALTH_CHECK_MS : MODEM_POLL_INTERVAL_MS;
+  if (lastPollMs != 0 && now - lastPollMs < interval) {
+    return state;
+  }
+  lastPollMs = now;
+
+  switch (state) {
+  case MODEM_WAIT_AT:
+    if (modem->testAT(200)) {
+      Serial.println("Modem AT communication established");
+      enterState(MODEM_WAIT_SIM);
+    } else if (stateTimedOut(MODEM_AT_TIMEOUT_MS)) {
+      fail("at_timeout");
+    } else if (now - stateEnteredMs > (pwrkeyRetries + 1) * 10000UL) {
+      // Re-trigger power key if not responding
+      pwrkeyRetries++;
+      pulsePowerKey();
+    }
+    break;
+
+  case MODEM_WAIT_SIM: {
+    SimStatus sim = modem->getSimStatus(200);
+    if (sim == SIM_READY) {
+      Serial.println("SIM card ready");
+#ifndef TINY_GSM_MODEM_SIM7672
+      if (!modem->setNetworkMode(MODEM_NETWORK_AUTO)) {
+        Serial.println("Failed to set network mode");
+      }
+#endif
+      enterState(MODEM_REGISTERING);
+    } else if (sim == SIM_LOCKED) {
+      // Retrying cannot fix a locked SIM
+      lastError = "sim_locked";
+      failures++;
+      enterState(MODEM_FAILED);
+    } else if (stateTimedOut(MODEM_SIM_TIMEOUT_MS)) {
+      fail("sim_timeout");
+    }
+    break;
+  }
+
+  case MODEM_REGISTERING: {
+    RegStatus status = modem->getRegistrationStatus();
+    if (status == REG_OK_HOME || status == REG_OK_ROAMING) {
+      Serial.println(status == REG_OK_HOME ? "Registered on home network" : "Registered on roaming network");
+      enterState(MODEM_ATTACHING);
+    } else if (status == REG_DENIED) {
+      fail("registration_denied");
+    } else if (stateTimedOut(MODEM_REGISTRATION_TIMEOUT_MS)) {
+      fail("registration_timeout");
+    }
+    break;
+  }
+
+  case MODEM_ATTACHING:
+    if (modem->gprsConnect(MODEM_APN)) {
+      String ipAddress = modem->getLocalIP();
+      Serial.printf("Modem IP: %s\n", ipAddress.c_str());
+      // The attach itself can take seconds, so measure after it
+      lastBringUpMs = millis() - bringUpStartMs;
+      connects++;
+      attempts = 0;
+      backoffMs = MODEM_BACKOFF_BASE_MS;
+      enterState(MODEM_CONNECTED);
+    } else {
+      fail("data_attach");
+    }
+    break;
+
+  case MODEM_CONNECTED:
+    if (!modem->isNetworkConnected()) {
+      // Drop back to registration rather than power-cycling straight away
+      Serial.println("Network connection lost. Attempting reconnection...");
+      connectionLosses++;
+      bringUpStartMs = now;
+      enterState(MODEM_REGISTERING);
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  return state;
+}
+
+bool ModemManager::runUntilConnected() {
+  while (!isFinished()) {
+    step();
+    delay(10);
+  }
+  return isConnected();
+}
+
+void ModemManager::powerOff() {
+  if (state != MODEM_OFF) {
+    modem->poweroff();
+  }
+  setPower(false);
+  enterState(MODEM_OFF);
+}
+
+void ModemManager::holdReset() {
+  setReset(true);
+}
+
+ModemState ModemManager::getState() const {
+  return state;
+}
+
+bool ModemManager::isConnected() const {
+  return state == MODEM_CONNECTED;
+}
+
+bool ModemManager::isFinished() const {
+  return state == MODEM_CONNECTED || state == MODEM_FAILED;
+}
+
+unsigned long ModemManager::getStateDuration(ModemState s) const {
+  return stateDurations[s];
+}
+
+unsigned long ModemManager::getLastBringUpMs() const {
+  return lastBringUpMs;
+}
+
+const char* ModemManager::getLastError() const {
+  return lastError;
+}
+
+void ModemManager::appendCounters(std::map<String, String>& out) const {
+  out["modem_state"] = modemStateName(state);
+  out["modem_connects"] = String(connects);
+  out["modem_failures"] = String(failures);
+  out["modem_losses"] = String(connectionLosses);
+  out["modem_bringup_ms"] = String(lastBringUpMs);
+  if (lastError[0] != '\0') {
+    out["modem_last_error"] = lastError;
+  }
+}
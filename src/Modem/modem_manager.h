@@ -0,0 +1,96 @@
+#pragma once
+
+#include "../configs.h"
+#include "../Utils/utilities.h"
+
+#ifdef TINY_GSM_MODEM_A7670
+#undef TINY_GSM_MODEM_A7670
+#endif
+
+#ifndef TINY_GSM_MODEM_A76XXSSL
+#define TINY_GSM_MODEM_A76XXSSL // Support A7670X/A7608X/SIM7670G
+#endif
+
+#include <Arduino.h>
+#include <TinyGsmClient.h>
+#include <map>
+
+enum ModemState {
+  MODEM_OFF = 0,
+  MODEM_POWERING,
+  MODEM_WAIT_AT,
+  MODEM_WAIT_SIM,
+  MODEM_REGISTERING,
+  MODEM_ATTACHING,
+  MODEM_CONNECTED,
+  MODEM_BACKOFF,
+  MODEM_FAILED,
+  MODEM_STATE_COUNT
+};
+
+// Single non-blocking bring-up state machine shared by normal operation and setup mode.
+// All modem I/O goes through TinyGsm's stream, and the pin sequencing is virtual, so
+// the machine can be driven by a scripted AT responder off-target.
+class ModemManager {
+private:
+  TinyGsm* modem;
+  ModemState state;
+  unsigned long stateEnteredMs;
+  unsigned long lastPollMs;
+  unsigned long bringUpStartMs;
+  unsigned long backoffMs;
+  uint8_t attempts;
+  uint8_t maxAttempts;
+  uint8_t pwrkeyRetries;
+  const char* lastError;
+
+  // Duration of each state during the most recent bring-up
+  unsigned long stateDurations[MODEM_STATE_COUNT];
+  unsigned long lastBringUpMs;
+
+  // Counters
+  uint32_t connects;
+  uint32_t failures;
+  uint32_t connectionLosses;
+
+  void enterState(ModemState next);
+  void fail(const char* reason);
+  bool stateTimedOut(unsigned long timeoutMs) const;
+  void startPowerSequence();
+
+protected:
+  // Board pin sequencing
+  virtual void setPower(bool on);
+  virtual void setReset(bool asserted);
+  virtual void pulsePowerKey();
+
+public:
+  ModemManager(TinyGsm* modem_ref);
+  virtual ~ModemManager();
+
+  // Start a bring-up from power-on; maxAttempts == 0 retries forever
+  void begin(uint8_t maxAttempts = 0);
+
+  // Advance the state machine; each call blocks for at most one short AT exchange
+  ModemState step();
+
+  // Blocking helper for callers that have nothing else to do
+  bool runUntilConnected();
+
+  void powerOff();
+
+  // Hold the modem in reset from any task so an AT or socket exchange stuck on
+  // the owner task fails out; only the pin is touched, begin() releases it
+  void holdReset();
+
+  ModemState getState() const;
+  bool isConnected() const;
+  bool isFinished() const;
+  unsigned long getStateDuration(ModemState s) const;
+  unsigned long getLastBringUpMs() const;
+  const char* getLastError() const;
+
+  void appendCounters(std::map<String, String>& out) const;
+};
+
+const char* modemStateName(ModemState state);
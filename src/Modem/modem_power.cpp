@@ -0,0 +1,138 @@
+#include "modem_power.h"
+
+#if MODEM_LOW_POWER_MODE != 0 && defined(MODEM_DTR_PIN) && MODEM_DTR_PIN == ULTRASONIC_TRIG_PIN
+#error "MODEM_LOW_POWER_MODE drives MODEM_DTR_PIN, which is also ULTRASONIC_TRIG_PIN"
+#endif
+
+ModemPowerManager::ModemPowerManager(TinyGsm* modem_ref, ModemPowerMode mode)
+  : modem(modem_ref), mode(mode), configured(false), asleep(false), stateSinceMs(millis()),
+    totalAwakeMs(0), totalSleepMs(0), wakes(0), wakeFailures(0), lastWakeLatencyMs(0),
+    maxWakeLatencyMs(0), uploadStartMs(0), uploads(0), lastUploadMj(0), totalUploadMj(0) {
+}
+
+void ModemPowerManager::setDtr(bool sleepRequested) {
+#ifdef MODEM_DTR_PIN
+  // DTR high lets the modem enter sleep once AT+CSCLK=1 is set; low keeps it awake
+  pinMode(MODEM_DTR_PIN, OUTPUT);
+  digitalWrite(MODEM_DTR_PIN, sleepRequested ? HIGH : LOW);
+#endif
+}
+
+void ModemPowerManager::accountState(unsigned long now) {
+  if (asleep) {
+    totalSleepMs += now - stateSinceMs;
+  } else {
+    totalAwakeMs += now - stateSinceMs;
+  }
+  stateSinceMs = now;
+}
+
+bool ModemPowerManager::configure() {
+  if (mode == MODEM_POWER_ALWAYS_ON) {
+    return true;
+  }
+
+  setDtr(false);
+
+  // UART sleep controlled by DTR
+  if (!modem->sleepEnable(true)) {
+    Serial.println("Failed to enable modem DTR sleep");
+    return false;
+  }
+
+  if (mode == MODEM_POWER_PSM) {
+    modem->sendAT("+CPSMS=1,,,\"", MODEM_PSM_TAU, "\",\"", MODEM_PSM_ACTIVE, "\"");
+    if (modem->waitResponse() != 1) {
+      Serial.println("Network rejected PSM request, using DTR sleep only");
+    }
+  } else if (mode == MODEM_POWER_EDRX) {
+    modem->sendAT("+CEDRXS=1,4,\"", MODEM_EDRX_VALUE, "\"");
+    if (modem->waitResponse() != 1) {
+      Serial.println("Network rejected eDRX request, using DTR sleep only");
+    }
+  }
+
+  configured = true;
+  Serial.printf("Modem low-power mode %d configured\n", mode);
+  return true;
+}
+
+void ModemPowerManager::sleep() {
+  if (!configured || asleep) {
+    return;
+  }
+
+  accountState(millis());
+  setDtr(true);
+  asleep = true;
+}
+
+bool ModemPowerManager::wake() {
+  if (!asleep) {
+    return true;
+  }
+
+  unsigned long start = millis();
+  accountState(start);
+  setDtr(false);
+  asleep = false;
+
+  bool responding = false;
+  while (millis() - start < MODEM_WAKE_TIMEOUT_MS) {
+    if (modem->testAT(100)) {
+      responding = true;
+      break;
+    }
+  }
+
+  // PSM may have released the PDP context; re-attach before the upload
+  if (responding && !modem->isGprsConnected()) {
+    responding = modem->gprsConnect(MODEM_APN);
+  }
+
+  lastWakeLatencyMs = millis() - start;
+  maxWakeLatencyMs = max(maxWakeLatencyMs, lastWakeLatencyMs);
+  wakes++;
+
+  if (!responding) {
+    wakeFailures++;
+    Serial.printf("Modem did not wake within %lu ms\n", lastWakeLatencyMs);
+  }
+  return responding;
+}
+
+bool ModemPowerManager::isAsleep() const {
+  return asleep;
+}
+
+unsigned long ModemPowerManager::getAwakeMs() const {
+  return totalAwakeMs + (asleep ? 0 : millis() - stateSinceMs);
+}
+
+unsigned long ModemPowerManager::getSleepMs() const {
+  return totalSleepMs + (asleep ? millis() - stateSinceMs : 0);
+}
+
+void ModemPowerManager::beginUpload() {
+  uploadStartMs = millis();
+}
+
+void ModemPowerManager::endUpload(float supplyVoltage) {
+  unsigned long activeMs = millis() - uploadStartMs + lastWakeLatencyMs;
+
+  // mJ = V * mA * ms / 1000
+  lastUploadMj = supplyVoltage * MODEM_ACTIVE_MA * activeMs / 1000.0;
+  totalUploadMj += lastUploadMj;
+  uploads++;
+}
+
+void ModemPowerManager::appendCounters(std::map<String, String>& out) const {
+  out["modem_awake_ms"] = String(getAwakeMs());
+  out["modem_sleep_ms"] = String(getSleepMs());
+  out["modem_wakes"] = String(wakes);
+  out["modem_wake_failures"] = String(wakeFailures);
+  out["modem_wake_latency_ms"] = String(lastWakeLatencyMs);
+  out["modem_wake_latency_max_ms"] = String(maxWakeLatencyMs);
+  out["modem_upload_mj"] = String(lastUploadMj, 1);
+  out["modem_upload_avg_mj"] = String(uploads ? totalUploadMj / uploads : 0.0, 1);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "modem_manager.h"
+#include <map>
+
+enum ModemPowerMode {
+  MODEM_POWER_ALWAYS_ON = 0,
+  MODEM_POWER_DTR_SLEEP,
+  MODEM_POWER_PSM,
+  MODEM_POWER_EDRX
+};
+
+// Puts the modem to sleep between transmissions and wakes it on demand, keeping
+// track of awake time, wake latency and estimated energy per upload.
+class ModemPowerManager {
+private:
+  TinyGsm* modem;
+  ModemPowerMode mode;
+  bool configured;
+  bool asleep;
+
+  unsigned long stateSinceMs;
+  unsigned long totalAwakeMs;
+  unsigned long totalSleepMs;
+
+  uint32_t wakes;
+  uint32_t wakeFailures;
+  unsigned long lastWakeLatencyMs;
+  unsigned long maxWakeLatencyMs;
+
+  unsigned long uploadStartMs;
+  uint32_t uploads;
+  float lastUploadMj;
+  float totalUploadMj;
+
+  void setDtr(bool sleepRequested);
+  void accountState(unsigned long now);
+
+public:
+  ModemPowerManager(TinyGsm* modem_ref, ModemPowerMode mode = (ModemPowerMode)MODEM_LOW_POWER_MODE);
+
+  // Negotiate the configured low-power features; call once the modem is connected
+  bool configure();
+
+  // Let the modem sleep until the next transmission
+  void sleep();
+
+  // Wake the modem and make sure the data link is up; blocks for at most MODEM_WAKE_TIMEOUT_MS
+  bool wake();
+
+  bool isAsleep() const;
+  unsigned long getAwakeMs() const;
+  unsigned long getSleepMs() const;
+
+  // Bracket an upload to estimate its energy cost at the given supply voltage
+  void beginUpload();
+  void endUpload(float supplyVoltage);
+
+  void appendCounters(std::map<String, String>& out) const;
+};
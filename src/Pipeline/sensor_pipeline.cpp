@@ -0,0 +1,276 @@
+#include "sensor_pipeline.h"
+
+SensorPipeline sensorPipeline;
+
+const char* pipelineStageName(PipelineStage stage) {
+  switch (stage) {
+  case PIPELINE_SAMPLE:
+    return "sample";
+  case PIPELINE_CONDITION:
+    return "condition";
+  case PIPELINE_ENCODE:
+    return "encode";
+  case PIPELINE_UPLOAD:
+    return "upload";
+  default:
+    return "unknown";
+  }
+}
+
+SensorPipeline::SensorPipeline()
+  : samplerHandle(nullptr), conditionerHandle(nullptr), reportQueue(nullptr), payloadQueue(nullptr),
+    overruns(0), endToEndMaxMs(0), payloadDepth(0), sensorResets(0), nextSampleMs(0), reportRequested(false), running(false) {
+  memset(&hooks, 0, sizeof(hooks));
+  memset(stats, 0, sizeof(stats));
+}
+
+bool SensorPipeline::begin(const PipelineHooks& stageHooks) {
+  if (running) {
+    return true;
+  }
+  hooks = stageHooks;
+
+  if (!reportQueue) {
+    reportQueue = xQueueCreate(PIPELINE_REPORT_QUEUE, sizeof(PipelineReport));
+  }
+  if (!payloadQueue) {
+    payloadQueue = xQueueCreate(PIPELINE_PAYLOAD_QUEUE, sizeof(PipelinePayload));
+  }
+  if (!reportQueue || !payloadQueue) {
+    Serial.println("✗ Pipeline: failed to allocate queues");
+    return false;
+  }
+
+  // Sampler outranks the other stages so conditioning or encoding never delays a read.
+  // Consumers start first so the sampler never notifies a missing task.
+  TaskHandle_t encoderHandle = nullptr;
+  if (xTaskCreatePinnedToCore(encoderTask, "encode", PIPELINE_ENCODER_STACK, this, 1, &encoderHandle,
+                              PIPELINE_SENSOR_CORE) != pdPASS) {
+    Serial.println("✗ Pipeline: failed to start the encoder");
+    return false;
+  }
+  if (xTaskCreatePinnedToCore(conditionerTask, "condition", PIPELINE_CONDITION_STACK, this, 2, &conditionerHandle,
+                              PIPELINE_SENSOR_CORE) != pdPASS) {
+    Serial.println("✗ Pipeline: failed to start the conditioner");
+    vTaskDelete(encoderHandle);
+    conditionerHandle = nullptr;
+    return false;
+  }
+  if (xTaskCreatePinnedToCore(samplerTask, "sampler", PIPELINE_SAMPLER_STACK, this, 3, &samplerHandle,
+                              PIPELINE_SENSOR_CORE) != pdPASS) {
+    Serial.println("✗ Pipeline: failed to start the sampler");
+    vTaskDelete(conditionerHandle);
+    vTaskDelete(encoderHandle);
+    conditionerHandle = nullptr;
+    samplerHandle = nullptr;
+    return false;
+  }
+
+  running = true;
+  Serial.printf("✓ Pipeline started on core %d\n", PIPELINE_SENSOR_CORE);
+  return true;
+}
+
+bool SensorPipeline::isRunning() const {
+  return running;
+}
+
+void SensorPipeline::samplerTask(void* arg) {
+  static_cast<SensorPipeline*>(arg)->runSampler();
+}
+
+void SensorPipeline::conditionerTask(void* arg) {
+  static_cast<SensorPipeline*>(arg)->runConditioner();
+}
+
+void SensorPipeline::encoderTask(void* arg) {
+  static_cast<SensorPipeline*>(arg)->runEncoder();
+}
+
+void SensorPipeline::record(PipelineStage stage, uint32_t waitMs, uint32_t busyMs, uint32_t depth) {
+  PipelineStageStats& s = stats[stage];
+  s.items++;
+  s.busyTotalMs += busyMs;
+  if (busyMs > s.busyMaxMs) s.busyMaxMs = busyMs;
+  if (waitMs > s.waitMaxMs) s.waitMaxMs = waitMs;
+  if (depth > s.depthMax) s.depthMax = depth;
+}
+
+void SensorPipeline::runSampler() {
+  TickType_t wake = xTaskGetTickCount();
+
+  for (;;) {
+    uint32_t start = millis();
+    stageWatchdog.enter(WATCHDOG_SAMPLE);
+    SensorSample sample = hooks.sample();
+
+    // The task is never deleted mid-read: it may hold the I2C driver's bus
+    // lock. A read the watchdog flagged as hung is dropped once it returns,
+    // and the sensors are reset from here, where no transfer is in flight.
+    if (stageWatchdog.leave(WATCHDOG_SAMPLE)) {
+      sensorResets++;
+      Serial.printf("Pipeline: hung sensor read dropped, resetting sensors (%lu so far)\n",
+                    (unsigned long)sensorResets);
+      if (hooks.resetSensors) {
+        hooks.resetSensors();
+      }
+      wake = xTaskGetTickCount();
+      continue;
+    }
+    sample.queuedAtMs = millis();
+
+    if (sampleRing.push(sample)) {
+      xTaskNotifyGive(conditionerHandle);
+    } else {
+      stats[PIPELINE_SAMPLE].dropped++;
+    }
+    record(PIPELINE_SAMPLE, 0, sample.queuedAtMs - start, 0);
+
+    // The policy may change the period between samples; re-read it every time
+    TickType_t period = pdMS_TO_TICKS(hooks.sampleIntervalMs());
+    if (xTaskGetTickCount() - wake >= period) {
+      overruns++;
+      wake = xTaskGetTickCount();
+      continue;
+    }
+    nextSampleMs = millis() + (wake + period - xTaskGetTickCount()) * portTICK_PERIOD_MS;
+    vTaskDelayUntil(&wake, period);
+  }
+}
+
+void SensorPipeline::runConditioner() {
+  uint32_t lastReportMs = 0;
+  uint16_t windowSamples = 0;
+  bool reported = false;
+
+  for (;;) {
+    SensorSample sample;
+    uint32_t depth = sampleRing.size();
+    if (!sampleRing.pop(sample)) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+
+    uint32_t start = millis();
+    stageWatchdog.enter(WATCHDOG_CONDITION);
+    hooks.condition(sample);
+    stageWatchdog.leave(WATCHDOG_CONDITION);
+    windowSamples++;
+
+    if (!reported || reportRequested || start - lastReportMs >= hooks.reportIntervalMs()) {
+      PipelineReport report;
+      report.sample = sample;
+      report.windowSamples = windowSamples;
+      report.queuedAtMs = millis();
+
+      // Freshest report wins: make room by dropping the oldest
+      if (xQueueSend(reportQueue, &report, 0) != pdTRUE) {
+        PipelineReport stale;
+        xQueueReceive(reportQueue, &stale, 0);
+        stats[PIPELINE_CONDITION].dropped++;
+        xQueueSend(reportQueue, &report, 0);
+      }
+
+      reportRequested = false;
+      reported = true;
+      lastReportMs = start;
+      windowSamples = 0;
+    }
+
+    record(PIPELINE_CONDITION, start - sample.queuedAtMs, millis() - start, depth);
+  }
+}
+
+void SensorPipeline::runEncoder() {
+  for (;;) {
+    PipelineReport report;
+    if (xQueueReceive(reportQueue, &report, portMAX_DELAY) != pdTRUE) {
+      continue;
+    }
+    uint32_t depth = uxQueueMessagesWaiting(reportQueue) + 1;
+
+    uint32_t start = millis();
+    stageWatchdog.enter(WATCHDOG_ENCODE);
+    String json = hooks.encode(report);
+    stageWatchdog.leave(WATCHDOG_ENCODE);
+
+    PipelinePayload payload;
+    payload.length = json.length();
+    payload.json = (char*)malloc(payload.length + 1);
+    if (!payload.json) {
+      Serial.println("✗ Pipeline: out of memory for payload");
+      stats[PIPELINE_ENCODE].dropped++;
+      continue;
+    }
+    memcpy(payload.json, json.c_str(), payload.length + 1);
+    payload.record = report.sample.record;
+    payload.queuedAtMs = millis();
+    payload.takenAtMs = 0;
+
+    if (xQueueSend(payloadQueue, &payload, 0) != pdTRUE) {
+      PipelinePayload stale;
+      if (xQueueReceive(payloadQueue, &stale, 0) == pdTRUE) {
+        free(stale.json);
+      }
+      stats[PIPELINE_ENCODE].dropped++;
+      xQueueSend(payloadQueue, &payload, 0);
+    }
+
+    record(PIPELINE_ENCODE, start - report.queuedAtMs, millis() - start, depth);
+  }
+}
+
+void SensorPipeline::requestReport() {
+  reportRequested = true;
+}
+
+unsigned long SensorPipeline::quietForMs() const {
+  if (!running || !sampleRing.empty() || uxQueueMessagesWaiting(reportQueue) > 0 ||
+      uxQueueMessagesWaiting(payloadQueue) > 0 || stageWatchdog.isArmed(WATCHDOG_SAMPLE) ||
+      stageWatchdog.isArmed(WATCHDOG_CONDITION) || stageWatchdog.isArmed(WATCHDOG_ENCODE)) {
+    return 0;
+  }
+  long untilSample = (long)(nextSampleMs - millis());
+  return untilSample > 0 ? untilSample : 0;
+}
+
+bool SensorPipeline::receive(PipelinePayload& payload, TickType_t wait) {
+  if (!running || xQueueReceive(payloadQueue, &payload, wait) != pdTRUE) {
+    return false;
+  }
+  payload.takenAtMs = millis();
+  payloadDepth = uxQueueMessagesWaiting(payloadQueue) + 1;
+  return true;
+}
+
+void SensorPipeline::release(PipelinePayload& payload, unsigned long uploadMs) {
+  record(PIPELINE_UPLOAD, payload.takenAtMs - payload.queuedAtMs, uploadMs, payloadDepth);
+
+  uint32_t endToEnd = millis() - payload.record.timestampMs;
+  if (endToEnd > endToEndMaxMs) {
+    endToEndMaxMs = endToEnd;
+  }
+
+  free(payload.json);
+  payload.json = nullptr;
+}
+
+const PipelineStageStats& SensorPipeline::getStats(PipelineStage stage) const {
+  return stats[stage];
+}
+
+void SensorPipeline::appendCounters(std::map<String, String>& out) const {
+  for (int i = 0; i < PIPELINE_STAGE_COUNT; i++) {
+    const PipelineStageStats& s = stats[i];
+    String prefix = String("pipe_") + pipelineStageName((PipelineStage)i) + "_";
+    out[prefix + "items"] = String(s.items);
+    out[prefix + "drops"] = String(s.dropped);
+    out[prefix + "busy_avg_ms"] = String(s.items ? s.busyTotalMs / s.items : 0);
+    out[prefix + "busy_max_ms"] = String(s.busyMaxMs);
+    out[prefix + "wait_max_ms"] = String(s.waitMaxMs);
+    out[prefix + "depth_max"] = String(s.depthMax);
+  }
+  out["pipe_sample_overruns"] = String(overruns);
+  out["pipe_e2e_max_ms"] = String(endToEndMaxMs);
+  out["pipe_sensor_resets"] = String(sensorResets);
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "../configs.h"
+#include "../Database/device.h"
+#include "../Utils/ring_buffer.h"
+#include "../Utils/stage_watchdog.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <map>
+
+enum PipelineStage {
+  PIPELINE_SAMPLE = 0,
+  PIPELINE_CONDITION,
+  PIPELINE_ENCODE,
+  PIPELINE_UPLOAD,
+  PIPELINE_STAGE_COUNT
+};
+
+// One sensor read: calibrated values plus the raw readings reported with them
+struct SensorSample {
+  SampleRecord record;
+  uint16_t force0Raw;
+  uint16_t force1Raw;
+  uint16_t turbidityRaw;
+  int32_t weightRaw;
+  bool weightReady;
+  uint8_t tofStatus;
+  uint32_t queuedAtMs;
+};
+
+// Latest conditioned sample of a reporting window
+struct PipelineReport {
+  SensorSample sample;
+  uint16_t windowSamples;
+  uint32_t queuedAtMs;
+};
+
+// Serialized report waiting for the uploader; json is owned by the pipeline
+// until release() is called
+struct PipelinePayload {
+  char* json;
+  size_t length;
+  SampleRecord record;
+  uint32_t queuedAtMs;
+  uint32_t takenAtMs;
+};
+
+// Application side of each stage
+struct PipelineHooks {
+  SensorSample (*sample)();                          // Read the sensors
+  void (*condition)(const SensorSample& sample);     // Policy, flash log
+  String (*encode)(const PipelineReport& report);    // Build the upload payload
+  unsigned long (*sampleIntervalMs)();
+  unsigned long (*reportIntervalMs)();
+  void (*resetSensors)();                            // After a read the watchdog gave up on; may be null
+};
+
+struct PipelineStageStats {
+  uint32_t items;
+  uint32_t dropped;
+  uint32_t waitMaxMs;     // Time spent in the stage's input queue
+  uint32_t busyTotalMs;
+  uint32_t busyMaxMs;
+  uint32_t depthMax;      // Input queue high-water mark
+};
+
+// Sampler, conditioner and encoder run as tasks on PIPELINE_SENSOR_CORE, joined
+// by bounded queues; the loop task, which owns the modem, takes payloads off
+// the last queue. Samples, the only high-rate hop, go through a lock-free ring
+// and a task notification instead of a FreeRTOS queue. Queues never block a
+// producer: the sampler drops its newest sample if conditioning is behind, the
+// later stages drop their oldest item, so a slow upload costs stale reports
+// rather than missed samples.
+//
+// Each stats slot is written by one task only; readers may see a counter one
+// update behind, which is fine for telemetry.
+class SensorPipeline {
+private:
+  PipelineHooks hooks;
+  SpscRing<SensorSample, PIPELINE_SAMPLE_QUEUE> sampleRing;
+  TaskHandle_t samplerHandle;
+  TaskHandle_t conditionerHandle;
+  QueueHandle_t reportQueue;
+  QueueHandle_t payloadQueue;
+  PipelineStageStats stats[PIPELINE_STAGE_COUNT];
+  uint32_t overruns;          // Sensor reads that took longer than the sample period
+  uint32_t endToEndMaxMs;     // Sample capture to upload done
+  uint32_t payloadDepth;      // Payload queue depth when the current upload was taken
+  uint32_t sensorResets;      // Reads the watchdog flagged as hung, dropped once they returned
+  volatile uint32_t nextSampleMs;
+  volatile bool reportRequested;
+  bool running;
+
+  static void samplerTask(void* arg);
+  static void conditionerTask(void* arg);
+  static void encoderTask(void* arg);
+  void runSampler();
+  void runConditioner();
+  void runEncoder();
+
+  void record(PipelineStage stage, uint32_t waitMs, uint32_t busyMs, uint32_t depth);
+
+public:
+  SensorPipeline();
+
+  bool begin(const PipelineHooks& stageHooks);
+  bool isRunning() const;
+
+  // Report on the next conditioned sample regardless of the interval
+  void requestReport();
+
+  // Time until the next sensor read if no stage is working or holding an
+  // item, else 0; the chip can light-sleep that long without delaying data
+  unsigned long quietForMs() const;
+
+  // Uploader side: take the oldest payload, then release it once sent
+  bool receive(PipelinePayload& payload, TickType_t wait);
+  void release(PipelinePayload& payload, unsigned long uploadMs);
+
+  const PipelineStageStats& getStats(PipelineStage stage) const;
+  void appendCounters(std::map<String, String>& out) const;
+};
+
+extern SensorPipeline sensorPipeline;
+
+const char* pipelineStageName(PipelineStage stage);
@@ -0,0 +1,100 @@
+#include "cpu_frequency.h"
+#include <esp_sleep.h>
+
+CpuFrequencyManager cpuFrequency;
+
+static CpuClockSlot slotFor(uint32_t mhz) {
+  if (mhz >= 240) return CPU_SLOT_240MHZ;
+  if (mhz >= 160) return CPU_SLOT_160MHZ;
+  return CPU_SLOT_80MHZ;
+}
+
+CpuFrequencyManager::CpuFrequencyManager()
+  : mutex(nullptr), currentMhz(240), boostDepth(0), slotSinceMs(0), boosts(0), lightSleeps(0) {
+  for (int i = 0; i < CPU_SLOT_COUNT; i++) {
+    slotMs[i] = 0;
+  }
+}
+
+void CpuFrequencyManager::account(CpuClockSlot slot, unsigned long now) {
+  slotMs[slot] += now - slotSinceMs;
+  slotSinceMs = now;
+}
+
+void CpuFrequencyManager::switchTo(uint32_t mhz) {
+  if (mhz == currentMhz) {
+    return;
+  }
+  account(slotFor(currentMhz), millis());
+  if (setCpuFrequencyMhz(mhz)) {
+    currentMhz = mhz;
+  } else {
+    Serial.printf("Failed to set CPU frequency to %u MHz\n", mhz);
+  }
+}
+
+void CpuFrequencyManager::begin() {
+  // Not in the constructor: static initializers run before FreeRTOS is ready
+  if (!mutex) {
+    mutex = xSemaphoreCreateMutex();
+  }
+  currentMhz = getCpuFrequencyMhz();
+  slotSinceMs = millis();
+  switchTo(CPU_IDLE_MHZ);
+  Serial.printf("CPU frequency: %u MHz idle, %u MHz boost\n", CPU_IDLE_MHZ, CPU_BOOST_MHZ);
+}
+
+void CpuFrequencyManager::boost() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  if (boostDepth++ == 0) {
+    boosts++;
+    switchTo(CPU_BOOST_MHZ);
+  }
+  xSemaphoreGive(mutex);
+}
+
+void CpuFrequencyManager::release() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  if (boostDepth > 0 && --boostDepth == 0) {
+    switchTo(CPU_IDLE_MHZ);
+  }
+  xSemaphoreGive(mutex);
+}
+
+void CpuFrequencyManager::idle(unsigned long durationMs, bool allowLightSleep) {
+  if (!allowLightSleep || boostDepth > 0 || durationMs < CPU_LIGHT_SLEEP_MIN_MS) {
+    delay(durationMs);
+    return;
+  }
+
+  unsigned long start = millis();
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  account(slotFor(currentMhz), start);
+  xSemaphoreGive(mutex);
+
+  Serial.flush();
+  esp_sleep_enable_timer_wakeup((uint64_t)durationMs * 1000ULL);
+  esp_light_sleep_start();
+  lightSleeps++;
+
+  // millis() keeps counting through light sleep
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  account(CPU_SLOT_LIGHT_SLEEP, millis());
+  xSemaphoreGive(mutex);
+}
+
+uint32_t CpuFrequencyManager::getFrequencyMhz() const {
+  return currentMhz;
+}
+
+void CpuFrequencyManager::appendCounters(std::map<String, String>& out) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  account(slotFor(currentMhz), millis());
+  xSemaphoreGive(mutex);
+  out["cpu_80mhz_ms"] = String(slotMs[CPU_SLOT_80MHZ]);
+  out["cpu_160mhz_ms"] = String(slotMs[CPU_SLOT_160MHZ]);
+  out["cpu_240mhz_ms"] = String(slotMs[CPU_SLOT_240MHZ]);
+  out["cpu_light_sleep_ms"] = String(slotMs[CPU_SLOT_LIGHT_SLEEP]);
+  out["cpu_boosts"] = String(boosts);
+  out["cpu_light_sleeps"] = String(lightSleeps);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <map>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Frequencies we account time for, plus light sleep
+enum CpuClockSlot {
+  CPU_SLOT_80MHZ = 0,
+  CPU_SLOT_160MHZ,
+  CPU_SLOT_240MHZ,
+  CPU_SLOT_LIGHT_SLEEP,
+  CPU_SLOT_COUNT
+};
+
+// Keeps the core at CPU_IDLE_MHZ and boosts it only while a CpuBoostLock is held.
+// Idle periods can be spent in light sleep when nothing needs the UART or radio.
+// Boosts may come from any task; the depth count and accounting are mutex-guarded.
+class CpuFrequencyManager {
+private:
+  SemaphoreHandle_t mutex;
+  uint32_t currentMhz;
+  uint8_t boostDepth;
+  unsigned long slotSinceMs;
+  unsigned long slotMs[CPU_SLOT_COUNT];
+  uint32_t boosts;
+  uint32_t lightSleeps;
+
+  void account(CpuClockSlot slot, unsigned long now);
+  void switchTo(uint32_t mhz);
+
+public:
+  CpuFrequencyManager();
+
+  // Drop to the idle frequency; call before the first boost
+  void begin();
+
+  void boost();
+  void release();
+
+  // Wait for durationMs, in light sleep when allowed and long enough
+  void idle(unsigned long durationMs, bool allowLightSleep);
+
+  uint32_t getFrequencyMhz() const;
+  void appendCounters(std::map<String, String>& out);
+};
+
+extern CpuFrequencyManager cpuFrequency;
+
+// Scoped boost for hot sections
+class CpuBoostLock {
+public:
+  CpuBoostLock() { cpuFrequency.boost(); }
+  ~CpuBoostLock() { cpuFrequency.release(); }
+  CpuBoostLock(const CpuBoostLock&) = delete;
+  CpuBoostLock& operator=(const CpuBoostLock&) = delete;
+};
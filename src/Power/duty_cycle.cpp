@@ -0,0 +1,176 @@
+#include "duty_cycle.h"
+#include <esp_sleep.h>
+
+#define DUTY_CYCLE_MAGIC 0xD0C1C1E6  // Bump when DutyCycleState changes
+
+// Everything in here lives in RTC slow memory and survives deep sleep
+struct DutyCycleState {
+  uint32_t magic;
+  uint32_t wakeCount;
+  uint32_t elapsedMs;        // Accumulated awake + sleep time before this wake
+  uint32_t lastAwakeMs;      // Awake time of the previous cycle
+  uint32_t totalAwakeMs;
+  uint32_t lastFirstSampleMs;
+  uint32_t uploads;
+  uint32_t failedUploads;
+  uint32_t eventUploads;
+  uint32_t fullUploads;      // Uploads forced by a full buffer
+  uint32_t dropped;          // Samples lost to a full buffer
+  bool weightOffsetValid;
+  long weightOffset;
+  uint16_t head;
+  uint16_t count;
+  uint16_t persisted;        // Leading samples already written to the telemetry log
+  SampleRecord buffer[DUTY_CYCLE_BUFFER_SIZE];
+};
+
+RTC_DATA_ATTR static DutyCycleState rtcState;
+
+DutyCycle::DutyCycle()
+  : firstSampleAtMs(0), coldBoot(true) {
+}
+
+void DutyCycle::begin() {
+  coldBoot = rtcState.magic != DUTY_CYCLE_MAGIC;
+
+  if (coldBoot) {
+    memset(&rtcState, 0, sizeof(rtcState));
+    rtcState.magic = DUTY_CYCLE_MAGIC;
+    Serial.println("Duty cycle: cold boot, RTC buffer initialized");
+  }
+
+  rtcState.wakeCount++;
+  Serial.printf("Duty cycle: wake #%u, %u samples buffered\n", rtcState.wakeCount, rtcState.count);
+}
+
+bool DutyCycle::isColdBoot() const {
+  return coldBoot;
+}
+
+bool DutyCycle::isTimerWake() const {
+  return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+}
+
+void DutyCycle::markFirstSample() {
+  if (firstSampleAtMs == 0) {
+    firstSampleAtMs = millis();
+    rtcState.lastFirstSampleMs = firstSampleAtMs;
+  }
+}
+
+unsigned long DutyCycle::getTimeToFirstSampleMs() const {
+  return firstSampleAtMs;
+}
+
+unsigned long DutyCycle::getAwakeMs() const {
+  // millis() restarts from zero on every wake
+  return millis();
+}
+
+uint32_t DutyCycle::elapsedMs() const {
+  return rtcState.elapsedMs + millis();
+}
+
+bool DutyCycle::append(const SampleRecord& record) {
+  if (rtcState.count == DUTY_CYCLE_BUFFER_SIZE) {
+    // Keep the newest data: overwrite the oldest sample
+    rtcState.head = (rtcState.head + 1) % DUTY_CYCLE_BUFFER_SIZE;
+    rtcState.count--;
+    rtcState.dropped++;
+    if (rtcState.persisted > 0) rtcState.persisted--;
+  }
+
+  uint16_t tail = (rtcState.head + rtcState.count) % DUTY_CYCLE_BUFFER_SIZE;
+  rtcState.buffer[tail] = record;
+  rtcState.count++;
+  return rtcState.count < DUTY_CYCLE_BUFFER_SIZE;
+}
+
+size_t DutyCycle::count() const {
+  return rtcState.count;
+}
+
+const SampleRecord& DutyCycle::at(size_t index) const {
+  return rtcState.buffer[(rtcState.head + index) % DUTY_CYCLE_BUFFER_SIZE];
+}
+
+void DutyCycle::dropFront(size_t n) {
+  if (n > rtcState.count) n = rtcState.count;
+  rtcState.head = (rtcState.head + n) % DUTY_CYCLE_BUFFER_SIZE;
+  rtcState.count -= n;
+  rtcState.persisted = n < rtcState.persisted ? rtcState.persisted - n : 0;
+}
+
+size_t DutyCycle::persistedCount() const {
+  return rtcState.persisted;
+}
+
+void DutyCycle::markPersisted() {
+  rtcState.persisted = rtcState.count;
+}
+
+DutyCycleUpload DutyCycle::uploadReason(const SampleRecord& latest) const {
+  if (rtcState.wakeCount % DUTY_CYCLE_UPLOAD_EVERY == 0) return DC_UPLOAD_SCHEDULED;
+  if (rtcState.count >= DUTY_CYCLE_BUFFER_SIZE) return DC_UPLOAD_FULL;
+
+  // Event trigger: compare against the previous buffered sample
+  if (rtcState.count >= 2) {
+    const SampleRecord& previous = at(rtcState.count - 2);
+    if (fabsf(latest.tof - previous.tof) > DUTY_CYCLE_EVENT_TOF_MM) return DC_UPLOAD_EVENT;
+    if (fabsf(latest.turbidity - previous.turbidity) > DUTY_CYCLE_EVENT_TURBIDITY) return DC_UPLOAD_EVENT;
+  }
+  return DC_UPLOAD_NONE;
+}
+
+void DutyCycle::markUploaded(DutyCycleUpload reason, bool success) {
+  if (!success) {
+    rtcState.failedUploads++;
+    return;
+  }
+  rtcState.uploads++;
+  if (reason == DC_UPLOAD_EVENT) {
+    rtcState.eventUploads++;
+  } else if (reason == DC_UPLOAD_FULL) {
+    rtcState.fullUploads++;
+  }
+}
+
+bool DutyCycle::hasWeightOffset() const {
+  return rtcState.weightOffsetValid;
+}
+
+long DutyCycle::getWeightOffset() const {
+  return rtcState.weightOffset;
+}
+
+void DutyCycle::setWeightOffset(long offset) {
+  rtcState.weightOffset = offset;
+  rtcState.weightOffsetValid = true;
+}
+
+void DutyCycle::appendCounters(std::map<String, String>& out) const {
+  out["dc_wake_count"] = String(rtcState.wakeCount);
+  out["dc_ttfs_ms"] = String(rtcState.lastFirstSampleMs);
+  out["dc_last_awake_ms"] = String(rtcState.lastAwakeMs);
+  out["dc_avg_awake_ms"] = String(rtcState.wakeCount > 1 ? rtcState.totalAwakeMs / (rtcState.wakeCount - 1) : 0);
+  out["dc_buffered"] = String(rtcState.count);
+  out["dc_dropped"] = String(rtcState.dropped);
+  out["dc_uploads"] = String(rtcState.uploads);
+  out["dc_event_uploads"] = String(rtcState.eventUploads);
+  out["dc_full_uploads"] = String(rtcState.fullUploads);
+  out["dc_failed_uploads"] = String(rtcState.failedUploads);
+}
+
+void DutyCycle::sleep(unsigned long sleepMs) {
+  uint32_t awakeMs = millis();
+  rtcState.lastAwakeMs = awakeMs;
+  rtcState.totalAwakeMs += awakeMs;
+  rtcState.elapsedMs += awakeMs + sleepMs;
+
+  Serial.printf("Duty cycle: awake %u ms (first sample after %lu ms), sleeping %lu ms\n",
+                awakeMs, firstSampleAtMs, sleepMs);
+  Serial.flush();
+
+  esp_sleep_enable_timer_wakeup((uint64_t)sleepMs * 1000ULL);
+  esp_deep_sleep_start();
+}
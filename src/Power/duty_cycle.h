@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <map>
+#include "../Database/device.h"
+
+// Why a wake powers the modem, in priority order
+enum DutyCycleUpload {
+  DC_UPLOAD_NONE = 0,
+  DC_UPLOAD_SCHEDULED,      // Every K wakes
+  DC_UPLOAD_FULL,           // RTC buffer full before the scheduled wake
+  DC_UPLOAD_EVENT           // Large change between the last two samples
+};
+
+// Deep-sleep duty cycle: samples are buffered in RTC memory across sleeps
+// and only every K wakes (or on an event) is the modem powered for upload.
+class DutyCycle {
+private:
+  unsigned long firstSampleAtMs;
+  bool coldBoot;
+
+public:
+  DutyCycle();
+
+  // Restore RTC state; must be called first thing after wake
+  void begin();
+  bool isColdBoot() const;
+  bool isTimerWake() const;
+
+  // Instrumentation
+  void markFirstSample();
+  unsigned long getTimeToFirstSampleMs() const;
+  unsigned long getAwakeMs() const;
+
+  // Time since first boot, including time spent in deep sleep
+  uint32_t elapsedMs() const;
+
+  // RTC sample buffer
+  bool append(const SampleRecord& record);
+  size_t count() const;
+  const SampleRecord& at(size_t index) const;
+  void dropFront(size_t n);
+
+  // Samples at the front of the buffer that were already persisted to flash
+  size_t persistedCount() const;
+  void markPersisted();
+
+  // Whether this wake uploads: every K wakes, when the buffer is full or on
+  // a large change between samples
+  DutyCycleUpload uploadReason(const SampleRecord& latest) const;
+  void markUploaded(DutyCycleUpload reason, bool success);
+
+  // HX711 tare offset survives sleep so we don't re-tare every wake
+  bool hasWeightOffset() const;
+  long getWeightOffset() const;
+  void setWeightOffset(long offset);
+
+  void appendCounters(std::map<String, String>& out) const;
+
+  // Record awake time and enter deep sleep; does not return
+  void sleep(unsigned long sleepMs = DUTY_CYCLE_SLEEP_MS);
+};
@@ -0,0 +1,89 @@
+#include "energy_model.h"
+
+static const float PHASE_CURRENT_MA[ENERGY_PHASE_COUNT] = {
+  ENERGY_CPU_ACTIVE_MA, ENERGY_SENSOR_MA, MODEM_ACTIVE_MA, ENERGY_MODEM_TX_MA, MODEM_SLEEP_MA
+};
+
+const char* energyPhaseName(EnergyPhase phase) {
+  switch (phase) {
+  case ENERGY_CPU_ACTIVE:
+    return "cpu";
+  case ENERGY_SENSORS:
+    return "sensors";
+  case ENERGY_MODEM_AWAKE:
+    return "modem_awake";
+  case ENERGY_MODEM_TX:
+    return "modem_tx";
+  case ENERGY_MODEM_SLEEP:
+    return "modem_sleep";
+  default:
+    return "unknown";
+  }
+}
+
+EnergyModel::EnergyModel()
+  : cycleStartMs(millis()), samples(0), bytesSent(0), cycles(0), lastCycleMs(0), lastCycleMj(0),
+    lastSolarMj(0), lastPerSampleMj(0), lastPerByteMj(0), totalMj(0) {
+  for (int i = 0; i < ENERGY_PHASE_COUNT; i++) {
+    phaseMs[i] = 0;
+  }
+}
+
+void EnergyModel::addPhase(EnergyPhase phase, unsigned long durationMs) {
+  phaseMs[phase] += durationMs;
+}
+
+void EnergyModel::addSample(uint32_t count) {
+  samples += count;
+}
+
+void EnergyModel::addBytes(size_t bytes) {
+  bytesSent += bytes;
+}
+
+void EnergyModel::closeCycle(float supplyVoltage, float solarWatts) {
+  unsigned long now = millis();
+  unsigned long cycleMs = now - cycleStartMs;
+
+  // The CPU idles for whatever part of the cycle it was not busy
+  unsigned long idleMs = cycleMs > phaseMs[ENERGY_CPU_ACTIVE] ? cycleMs - phaseMs[ENERGY_CPU_ACTIVE] : 0;
+
+  // mJ = V * mA * ms / 1000
+  float chargeMaMs = idleMs * ENERGY_CPU_IDLE_MA;
+  for (int i = 0; i < ENERGY_PHASE_COUNT; i++) {
+    chargeMaMs += phaseMs[i] * PHASE_CURRENT_MA[i];
+  }
+
+  lastCycleMs = cycleMs;
+  lastCycleMj = supplyVoltage * chargeMaMs / 1000.0;
+  lastSolarMj = solarWatts * cycleMs;
+  lastPerSampleMj = samples ? lastCycleMj / samples : 0;
+  lastPerByteMj = bytesSent ? lastCycleMj / bytesSent : 0;
+  totalMj += lastCycleMj;
+  cycles++;
+
+  Serial.printf("ENERGY,%u,%lu,%lu,%lu,%lu,%lu,%lu,%u,%u,%.3f,%.3f\n", cycles, cycleMs,
+                phaseMs[ENERGY_CPU_ACTIVE], phaseMs[ENERGY_SENSORS], phaseMs[ENERGY_MODEM_AWAKE],
+                phaseMs[ENERGY_MODEM_TX], phaseMs[ENERGY_MODEM_SLEEP], samples, bytesSent,
+                supplyVoltage, solarWatts);
+
+  for (int i = 0; i < ENERGY_PHASE_COUNT; i++) {
+    phaseMs[i] = 0;
+  }
+  samples = 0;
+  bytesSent = 0;
+  cycleStartMs = now;
+}
+
+float EnergyModel::getLastCycleMj() const {
+  return lastCycleMj;
+}
+
+void EnergyModel::appendCounters(std::map<String, String>& out) const {
+  out["energy_cycle_ms"] = String(lastCycleMs);
+  out["energy_cycle_mj"] = String(lastCycleMj, 1);
+  out["energy_mj_per_sample"] = String(lastPerSampleMj, 2);
+  out["energy_mj_per_byte"] = String(lastPerByteMj, 4);
+  out["energy_solar_mj"] = String(lastSolarMj, 1);
+  out["energy_total_mj"] = String(totalMj, 0);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <map>
+
+// Measured phases; sensor current is drawn on top of the CPU, modem TX replaces modem awake
+enum EnergyPhase {
+  ENERGY_CPU_ACTIVE = 0,
+  ENERGY_SENSORS,
+  ENERGY_MODEM_AWAKE,
+  ENERGY_MODEM_TX,
+  ENERGY_MODEM_SLEEP,
+  ENERGY_PHASE_COUNT
+};
+
+// Estimates energy per telemetry cycle from phase times and the measured supply voltage.
+// Each closed cycle is also logged as an "ENERGY," CSV line that tools/energy_model.py
+// can replay on the host to compare scheduling and encoding strategies.
+class EnergyModel {
+private:
+  unsigned long phaseMs[ENERGY_PHASE_COUNT];
+  unsigned long cycleStartMs;
+  uint32_t samples;
+  uint32_t bytesSent;
+  uint32_t cycles;
+
+  // Results of the last closed cycle
+  unsigned long lastCycleMs;
+  float lastCycleMj;
+  float lastSolarMj;
+  float lastPerSampleMj;
+  float lastPerByteMj;
+  float totalMj;
+
+public:
+  EnergyModel();
+
+  void addPhase(EnergyPhase phase, unsigned long durationMs);
+  void addSample(uint32_t count = 1);
+  void addBytes(size_t bytes);
+
+  // Close the running cycle using the battery voltage and solar input measured now
+  void closeCycle(float supplyVoltage, float solarWatts);
+
+  float getLastCycleMj() const;
+  void appendCounters(std::map<String, String>& out) const;
+};
+
+const char* energyPhaseName(EnergyPhase phase);
@@ -0,0 +1,177 @@
+#include "sampling_policy.h"
+
+// Standard deviation above which a channel counts as "changing"
+// (tof mm, ultrasonic cm, weight kg, turbidity NTU)
+static const float CHANGE_THRESHOLD[POLICY_CHANNEL_COUNT] = { 10.0f, 1.0f, 0.2f, 20.0f };
+
+static const unsigned long SAMPLE_INTERVALS[SAMPLING_MODE_COUNT] = {
+  POLICY_FAST_SAMPLE_MS, POLICY_NORMAL_SAMPLE_MS, POLICY_SLOW_SAMPLE_MS, POLICY_SURVIVAL_SAMPLE_MS
+};
+
+static const unsigned long REPORT_INTERVALS[SAMPLING_MODE_COUNT] = {
+  POLICY_FAST_REPORT_MS, POLICY_NORMAL_REPORT_MS, POLICY_SLOW_REPORT_MS, POLICY_SURVIVAL_REPORT_MS
+};
+
+const char* samplingModeName(SamplingMode mode) {
+  switch (mode) {
+  case SAMPLING_FAST:
+    return "fast";
+  case SAMPLING_NORMAL:
+    return "normal";
+  case SAMPLING_SLOW:
+    return "slow";
+  case SAMPLING_SURVIVAL:
+    return "survival";
+  default:
+    return "unknown";
+  }
+}
+
+SamplingPolicy::SamplingPolicy()
+  : windowCount(0), windowHead(0), batteryPercentage(100.0), batteryStatus("unknown"),
+    solarWattage(0.0), signalStrength(-999), mode(SAMPLING_NORMAL), downshiftVotes(0),
+    modeEnteredAt(millis()), transitions(0) {
+  for (int i = 0; i < SAMPLING_MODE_COUNT; i++) {
+    decisions[i] = 0;
+    timeInMode[i] = 0;
+  }
+}
+
+void SamplingPolicy::addSample(const DeviceData& data) {
+  // The range sensors report -1 for a failed reading; keep those out of the
+  // window as NAN. Weight and turbidity are valid on both sides of zero.
+  float values[POLICY_CHANNEL_COUNT];
+  values[POLICY_CHANNEL_TOF] = data.tof < 0 ? NAN : data.tof;
+  values[POLICY_CHANNEL_ULTRASONIC] = data.ultrasonic < 0 ? NAN : data.ultrasonic;
+  values[POLICY_CHANNEL_WEIGHT] = data.weight;
+  values[POLICY_CHANNEL_TURBIDITY] = data.turbidity;
+
+  for (int c = 0; c < POLICY_CHANNEL_COUNT; c++) {
+    window[c][windowHead] = values[c];
+  }
+  windowHead = (windowHead + 1) % POLICY_WINDOW_SIZE;
+  if (windowCount < POLICY_WINDOW_SIZE) {
+    windowCount++;
+  }
+
+  batteryPercentage = data.batteryPercentage;
+  batteryStatus = data.batteryStatus;
+  solarWattage = data.solarWattage;
+  signalStrength = data.signalStrength;
+}
+
+float SamplingPolicy::channelStdDev(int channel) const {
+  int used = 0;
+  float mean = 0.0;
+  float m2 = 0.0;
+
+  // Welford's running variance over the valid readings
+  for (int i = 0; i < windowCount; i++) {
+    float value = window[channel][i];
+    if (isnan(value)) continue;
+    used++;
+    float delta = value - mean;
+    mean += delta / used;
+    m2 += delta * (value - mean);
+  }
+
+  if (used < 2) return 0.0;
+  return sqrtf(m2 / (used - 1));
+}
+
+bool SamplingPolicy::isSignalChanging() const {
+  for (int c = 0; c < POLICY_CHANNEL_COUNT; c++) {
+    if (channelStdDev(c) > CHANGE_THRESHOLD[c]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SamplingPolicy::isEnergyRich() const {
+  return batteryPercentage >= POLICY_RICH_BATTERY_PCT || solarWattage >= POLICY_SOLAR_MIN_W;
+}
+
+bool SamplingPolicy::isEnergyCritical() const {
+  if (batteryStatus == "critical") return true;
+  return batteryPercentage < POLICY_LOW_BATTERY_PCT && solarWattage < POLICY_SOLAR_MIN_W;
+}
+
+bool SamplingPolicy::isLinkWeak() const {
+  // getSignalStrength() reports the raw CSQ (0-31, 99 = unknown) or -999 when offline
+  return signalStrength < POLICY_WEAK_SIGNAL_CSQ || signalStrength == 99;
+}
+
+void SamplingPolicy::enterMode(SamplingMode next) {
+  unsigned long now = millis();
+  timeInMode[mode] += now - modeEnteredAt;
+  modeEnteredAt = now;
+
+  if (next != mode) {
+    Serial.printf("Sampling policy: %s -> %s (battery %.1f%%, solar %.2fW, signal %.0f)\n",
+                  samplingModeName(mode), samplingModeName(next),
+                  batteryPercentage, solarWattage, signalStrength);
+    mode = next;
+    transitions++;
+  }
+}
+
+SamplingMode SamplingPolicy::evaluate() {
+  SamplingMode target;
+
+  if (isEnergyCritical()) {
+    target = SAMPLING_SURVIVAL;
+  } else if (isSignalChanging()) {
+    target = isEnergyRich() ? SAMPLING_FAST : SAMPLING_NORMAL;
+  } else {
+    target = isEnergyRich() ? SAMPLING_NORMAL : SAMPLING_SLOW;
+  }
+
+  // Speed up immediately, but only slow down after a sustained calm period
+  if (target > mode && target != SAMPLING_SURVIVAL) {
+    downshiftVotes++;
+    if (downshiftVotes < POLICY_DOWNSHIFT_HOLD) {
+      target = mode;
+    } else {
+      downshiftVotes = 0;
+    }
+  } else {
+    downshiftVotes = 0;
+  }
+
+  decisions[target]++;
+  enterMode(target);
+  return mode;
+}
+
+SamplingMode SamplingPolicy::getMode() const {
+  return mode;
+}
+
+unsigned long SamplingPolicy::getSampleIntervalMs() const {
+  return SAMPLE_INTERVALS[mode];
+}
+
+unsigned long SamplingPolicy::getReportIntervalMs() const {
+  unsigned long interval = REPORT_INTERVALS[mode];
+  // Uploads cost more on a weak link, so batch them further apart
+  if (isLinkWeak() && mode != SAMPLING_SURVIVAL) {
+    interval *= 2;
+  }
+  return interval;
+}
+
+void SamplingPolicy::appendCounters(std::map<String, String>& out) const {
+  out["policy_mode"] = samplingModeName(mode);
+  out["policy_transitions"] = String(transitions);
+  out["policy_sample_ms"] = String(getSampleIntervalMs());
+  out["policy_report_ms"] = String(getReportIntervalMs());
+
+  unsigned long currentModeTime = millis() - modeEnteredAt;
+  for (int i = 0; i < SAMPLING_MODE_COUNT; i++) {
+    SamplingMode m = (SamplingMode)i;
+    unsigned long total = timeInMode[i] + (m == mode ? currentModeTime : 0);
+    out[String("policy_") + samplingModeName(m) + "_decisions"] = String(decisions[i]);
+    out[String("policy_") + samplingModeName(m) + "_ms"] = String(total);
+  }
+}
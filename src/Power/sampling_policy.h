@@ -0,0 +1,73 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <map>
+#include "../Database/device.h"
+
+// Operating modes, ordered from most to least energy hungry
+enum SamplingMode {
+  SAMPLING_FAST = 0,
+  SAMPLING_NORMAL,
+  SAMPLING_SLOW,
+  SAMPLING_SURVIVAL,
+  SAMPLING_MODE_COUNT
+};
+
+// Tracked signals used to decide whether conditions are changing
+enum PolicyChannel {
+  POLICY_CHANNEL_TOF = 0,
+  POLICY_CHANNEL_ULTRASONIC,
+  POLICY_CHANNEL_WEIGHT,
+  POLICY_CHANNEL_TURBIDITY,
+  POLICY_CHANNEL_COUNT
+};
+
+// Picks sampling and reporting periods from signal variance and the energy budget
+class SamplingPolicy {
+private:
+  // Recent-sample window per channel (ring buffer)
+  float window[POLICY_CHANNEL_COUNT][POLICY_WINDOW_SIZE];
+  uint8_t windowCount;
+  uint8_t windowHead;
+
+  // Latest energy/link inputs
+  float batteryPercentage;
+  String batteryStatus;
+  float solarWattage;
+  float signalStrength;
+
+  SamplingMode mode;
+  uint8_t downshiftVotes;
+  unsigned long modeEnteredAt;
+
+  // Counters
+  uint32_t decisions[SAMPLING_MODE_COUNT];
+  unsigned long timeInMode[SAMPLING_MODE_COUNT];
+  uint32_t transitions;
+
+  float channelStdDev(int channel) const;
+  bool isSignalChanging() const;
+  bool isEnergyRich() const;
+  bool isEnergyCritical() const;
+  bool isLinkWeak() const;
+  void enterMode(SamplingMode next);
+
+public:
+  SamplingPolicy();
+
+  // Feed a fresh sample into the variance window and energy inputs
+  void addSample(const DeviceData& data);
+
+  // Re-evaluate the mode; call after addSample()
+  SamplingMode evaluate();
+
+  SamplingMode getMode() const;
+  unsigned long getSampleIntervalMs() const;
+  unsigned long getReportIntervalMs() const;
+
+  // Export counters as telemetry key/values
+  void appendCounters(std::map<String, String>& out) const;
+};
+
+const char* samplingModeName(SamplingMode mode);
@@ -0,0 +1,42 @@
+#include "conversion.h"
+
+float forceFromAdc(int rawValue) {
+  // Convert to force in Newtons (adjust calibration based on your sensor)
+  // Assuming FSR sensor with voltage divider
+  float voltage = (rawValue / 4095.0) * 3.3;
+  float resistance = 10000.0 * (3.3 - voltage) / voltage; // 10k pull-down resistor
+  float force = 1.0 / (resistance / 1000.0); // Convert to approximate force
+  return force;
+}
+
+float turbidityFromAdc(int rawValue) {
+  float voltage = (rawValue / 4095.0) * 3.3;
+  // Convert voltage to NTU (adjust calibration based on your sensor)
+  float turbidity = (voltage - 2.5) * 3000.0 / 2.0; // Example conversion
+  return max(0.0f, turbidity);
+}
+
+float distanceFromEcho(long durationUs) {
+  return durationUs * 0.034 / 2; // Convert to cm
+}
+
+float getBatteryPercentage(float voltage) {
+  // Li-ion battery voltage to percentage conversion
+  if (voltage >= 4.2) return 100.0;
+  if (voltage >= 4.0) return 75.0 + ((voltage - 4.0) / 0.2) * 25.0;
+  if (voltage >= 3.8) return 50.0 + ((voltage - 3.8) / 0.2) * 25.0;
+  if (voltage >= 3.6) return 25.0 + ((voltage - 3.6) / 0.2) * 25.0;
+  if (voltage >= 3.3) return 0.0 + ((voltage - 3.3) / 0.3) * 25.0;
+  return 0.0;
+}
+
+const char* batteryStatusFor(float voltage) {
+  if (voltage > 4.0) {
+    return "good";
+  } else if (voltage > 3.7) {
+    return "medium";
+  } else if (voltage > 3.3) {
+    return "low";
+  }
+  return "critical";
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Raw reading to engineering unit conversions. Pure functions with no
+// hardware access, so they also build and run in the native environment.
+
+// FSR behind a 10k divider, 12-bit ADC count to approximate force
+float forceFromAdc(int rawValue);
+
+// Turbidity probe, 12-bit ADC count to NTU (clamped at 0)
+float turbidityFromAdc(int rawValue);
+
+// Ultrasonic echo pulse width in microseconds to distance in cm
+float distanceFromEcho(long durationUs);
+
+// Li-ion voltage to charge percentage
+float getBatteryPercentage(float voltage);
+
+const char* batteryStatusFor(float voltage);
@@ -0,0 +1,108 @@
+#include "boot_sequence.h"
+
+const char* bootPhaseName(BootPhase phase) {
+  switch (phase) {
+  case BOOT_SENSORS:
+    return "sensors";
+  case BOOT_MODEM_POWER:
+    return "modem_power";
+  case BOOT_MODEM_AT:
+    return "modem_at";
+  case BOOT_SIM:
+    return "sim";
+  case BOOT_REGISTRATION:
+    return "registration";
+  case BOOT_DATA:
+    return "data";
+  case BOOT_SETUP_CHECK:
+    return "setup_check";
+  case BOOT_READY:
+    return "ready";
+  case BOOT_FAILED:
+    return "failed";
+  default:
+    return "unknown";
+  }
+}
+
+BootSequence::BootSequence(ModemManager* modemManager_ref)
+  : modemManager(modemManager_ref), firstSampleMs(0), completed(false), timingsReported(false) {
+  for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+    durations[i] = 0;
+  }
+}
+
+void BootSequence::begin() {
+  modemManager->begin(MODEM_BOOT_MAX_ATTEMPTS);
+}
+
+BootPhase BootSequence::step() {
+  modemManager->step();
+  return getPhase();
+}
+
+bool BootSequence::runUntilReady() {
+  return modemManager->runUntilConnected();
+}
+
+BootPhase BootSequence::getPhase() const {
+  switch (modemManager->getState()) {
+  case MODEM_WAIT_AT:
+    return BOOT_MODEM_AT;
+  case MODEM_WAIT_SIM:
+    return BOOT_SIM;
+  case MODEM_REGISTERING:
+    return BOOT_REGISTRATION;
+  case MODEM_ATTACHING:
+    return BOOT_DATA;
+  case MODEM_CONNECTED:
+    return BOOT_READY;
+  case MODEM_FAILED:
+    return BOOT_FAILED;
+  default:
+    return BOOT_MODEM_POWER;
+  }
+}
+
+bool BootSequence::isModemReady() const {
+  return modemManager->isConnected();
+}
+
+bool BootSequence::isFinished() const {
+  return modemManager->isFinished();
+}
+
+void BootSequence::recordPhase(BootPhase recorded, unsigned long durationMs) {
+  durations[recorded] = durationMs;
+  Serial.printf("Boot: %s took %lu ms\n", bootPhaseName(recorded), durationMs);
+}
+
+void BootSequence::markFirstSample() {
+  if (firstSampleMs == 0) {
+    firstSampleMs = millis();
+  }
+}
+
+void BootSequence::complete() {
+  completed = true;
+}
+
+void BootSequence::appendTimings(std::map<String, String>& out) {
+  // Reported once only, so wait for the setup check to have its duration
+  if (!completed || timingsReported) {
+    return;
+  }
+
+  durations[BOOT_MODEM_POWER] = modemManager->getStateDuration(MODEM_POWERING);
+  durations[BOOT_MODEM_AT] = modemManager->getStateDuration(MODEM_WAIT_AT);
+  durations[BOOT_SIM] = modemManager->getStateDuration(MODEM_WAIT_SIM);
+  durations[BOOT_REGISTRATION] = modemManager->getStateDuration(MODEM_REGISTERING);
+  durations[BOOT_DATA] = modemManager->getStateDuration(MODEM_ATTACHING);
+
+  for (int i = BOOT_SENSORS; i <= BOOT_SETUP_CHECK; i++) {
+    out[String("boot_") + bootPhaseName((BootPhase)i) + "_ms"] = String(durations[i]);
+  }
+  out["boot_first_sample_ms"] = String(firstSampleMs);
+  out["boot_network_ready_ms"] = String(modemManager->getLastBringUpMs());
+  timingsReported = true;
+}
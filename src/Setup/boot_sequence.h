@@ -0,0 +1,60 @@
+#pragma once
+
+#include "../configs.h"
+#include "../Modem/modem_manager.h"
+#include <Arduino.h>
+#include <map>
+
+// Boot phases; modem phases mirror ModemManager, the others are recorded by the caller
+enum BootPhase {
+  BOOT_SENSORS = 0,
+  BOOT_MODEM_POWER,
+  BOOT_MODEM_AT,
+  BOOT_SIM,
+  BOOT_REGISTRATION,
+  BOOT_DATA,
+  BOOT_SETUP_CHECK,
+  BOOT_READY,
+  BOOT_FAILED,
+  BOOT_PHASE_COUNT
+};
+
+// Boot orchestration: the modem comes up through ModemManager in the background so
+// sensor init and local sampling can run meanwhile. Per-phase timings are kept for
+// the first telemetry frame.
+class BootSequence {
+private:
+  ModemManager* modemManager;
+  unsigned long firstSampleMs;
+  unsigned long durations[BOOT_PHASE_COUNT];
+  bool completed;
+  bool timingsReported;
+
+public:
+  BootSequence(ModemManager* modemManager_ref);
+
+  // Power the modem and start the reset pulse; returns immediately
+  void begin();
+
+  // Advance the modem state machine without blocking for long; returns the current phase
+  BootPhase step();
+
+  // Run step() until the modem is ready or failed
+  bool runUntilReady();
+
+  BootPhase getPhase() const;
+  bool isModemReady() const;
+  bool isFinished() const;
+
+  // Timings for phases run outside the modem state machine
+  void recordPhase(BootPhase phase, unsigned long durationMs);
+  void markFirstSample();
+
+  // The last phase was recorded or skipped; timings can be reported
+  void complete();
+
+  // Adds boot timings once, to the first counters taken after complete()
+  void appendTimings(std::map<String, String>& out);
+};
+
+const char* bootPhaseName(BootPhase phase);
@@ -23,20 +23,32 @@
 #include <ArduinoHttpClient.h>
 
 #include <Arduino.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include "../Utils/utilities.h"
 #include "../configs.h"
 #include "../Database/device_db.h"
 #include "../Database/address.h"
 #include "../Database/profile.h" // Add this include
+#include "../Modem/modem_manager.h"
+#include "setup_jobs.h"
+
+// Outcome of the setup-status check. Only NOT_FOUND is a reason to re-run setup;
+// UNREACHABLE covers network and server errors.
+enum SetupStatus {
+  SETUP_STATUS_REGISTERED,
+  SETUP_STATUS_NOT_FOUND,
+  SETUP_STATUS_UNREACHABLE
+};
 
 class DeviceSetup {
 private:
-  WebServer* server;
+  AsyncWebServer* server;
+  SetupJobQueue jobs;
   bool setupMode;
   bool setupCompleted;
   String deviceName;
   String deviceLocation;
+  String deviceOwner;
   String deviceStreet;
   String devicePostalCode;
   String deviceId;
@@ -49,34 +61,39 @@ private:
   // TinyGSM references for setup mode
   TinyGsm* modem;
   TinyGsmClientSecure* client;
-  bool modemInitialized;
+  ModemManager* modemManager;
 
-  // Web handlers
-  void handleRoot();
-  void handleSetup();
-  void handleRestart();
-  void handleAddressData();
-  void handleProfileData(); // Add this method
+  // Web handlers; these run on the web server task and never touch the modem
+  void handleRoot(AsyncWebServerRequest* request);
+  void handleDeviceInfo(AsyncWebServerRequest* request);
+  void handleModemStatus(AsyncWebServerRequest* request);
+  void handleRestart(AsyncWebServerRequest* request);
+  void handleJobStatus(AsyncWebServerRequest* request);
+  void submitJob(AsyncWebServerRequest* request, SetupJobType type, const String& payload);
 
-  
-  // Modem initialization
-  bool initializeModemForSetup();
-  void checkModemConnection();
+  // Backend calls, run from loop() by the task that owns the modem
+  void runNextJob();
+  void runJob(const SetupJob& job);
+  int runAddressData(const String& payload, String& response);
+  int runProfileData(String& response);
+  int runSetup(const String& body, String& response);
+  void checkSetupTimeout();
 
 public:
-  DeviceSetup(const String& deviceId, TinyGsm* modem_ref, TinyGsmClientSecure* client_ref);
+  DeviceSetup(const String& deviceId, TinyGsm* modem_ref, TinyGsmClientSecure* client_ref, ModemManager* modemManager_ref);
   ~DeviceSetup();
   
   bool isSetupCompleted();
   void markSetupCompleted();
   void resetSetupFlag();
   void startSetupMode();
-  void loop();
-  bool checkDeviceSetupStatus();
+  SetupStatus checkDeviceSetupStatus();
+  bool loadCachedRegistration();
   
   // Getters
   String getDeviceName() const;
   String getDeviceLocation() const;
+  String getDeviceOwner() const;
   bool isInSetupMode() const;
   bool isModemReady() const;
 };
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "live_stream.h"
+#include "web_assets.h"
+
+LiveStream liveStream;
+
+LiveStream::LiveStream()
+  : events("/events"), head(0), count(0), nextSeq(1), mutex(nullptr), attached(false),
+    sent(0), skipped(0), discarded(0) {
+}
+
+size_t LiveStream::format(const Entry& entry, char* buffer, size_t size) {
+  // Positional array keeps events small; the page knows the field order
+  const SampleRecord& r = entry.record;
+  int n = snprintf(buffer, size, "[%lu,%.1f,%.2f,%.2f,%.3f,%.1f,%.1f,%.2f,%.2f]",
+                   (unsigned long)r.timestampMs, r.tof, r.force0, r.force1, r.weight,
+                   r.turbidity, r.ultrasonic, r.batteryVoltage, r.solarWattage);
+  return n > 0 && (size_t)n < size ? n : 0;
+}
+
+void LiveStream::replay(AsyncEventSourceClient* client) {
+  uint32_t lastId = client->lastId();
+  Entry backlog[LIVE_STREAM_RING_SIZE];
+  size_t pending = 0;
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  size_t start = (head + LIVE_STREAM_RING_SIZE - count) % LIVE_STREAM_RING_SIZE;
+  for (size_t i = 0; i < count; i++) {
+    const Entry& entry = ring[(start + i) % LIVE_STREAM_RING_SIZE];
+    if (entry.seq > lastId) {
+      backlog[pending++] = entry;
+    }
+  }
+  xSemaphoreGive(mutex);
+
+  char buffer[LIVE_STREAM_EVENT_MAX];
+  for (size_t i = 0; i < pending; i++) {
+    if (format(backlog[i], buffer, sizeof(buffer))) {
+      client->send(buffer, "sample", backlog[i].seq);
+    }
+  }
+  Serial.printf("Live stream: client connected, replayed %u samples\n", pending);
+}
+
+void LiveStream::handlePage(AsyncWebServerRequest* request) {
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == LIVE_PAGE_ETAG) {
+    request->send(304);
+    return;
+  }
+
+  AsyncWebServerResponse* response = request->beginResponse(200, "text/html", LIVE_PAGE_GZ, LIVE_PAGE_GZ_LEN);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", LIVE_PAGE_ETAG);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+void LiveStream::attach(AsyncWebServer* server) {
+  if (attached) {
+    return;
+  }
+  // Created here, not in the constructor, which runs before FreeRTOS is ready
+  mutex = xSemaphoreCreateMutex();
+  attached = true;
+
+  events.onConnect([this](AsyncEventSourceClient* client) { replay(client); });
+  events.onDisconnect([this](AsyncEventSourceClient* client) {
+    Serial.printf("Live stream: client left (sent %lu, skipped %lu, discarded %lu)\n",
+                  (unsigned long)sent, (unsigned long)skipped, (unsigned long)discarded);
+  });
+  server->addHandler(&events);
+  server->on("/live", HTTP_GET, [this](AsyncWebServerRequest* request) { handlePage(request); });
+}
+
+bool LiveStream::hasClients() {
+  return attached && events.count() > 0;
+}
+
+void LiveStream::push(const SampleRecord& record) {
+  // Nobody can watch before the portal is up, so there is nothing to replay either
+  if (!attached) {
+    return;
+  }
+
+  Entry entry;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  entry.seq = nextSeq++;
+  entry.record = record;
+  ring[head] = entry;
+  head = (head + 1) % LIVE_STREAM_RING_SIZE;
+  if (count < LIVE_STREAM_RING_SIZE) {
+    count++;
+  }
+  xSemaphoreGive(mutex);
+
+  if (!hasClients()) {
+    return;
+  }
+
+  // Slow clients catch up from the ring on reconnect; don't pile more on them
+  if (events.avgPacketsWaiting() >= LIVE_STREAM_MAX_QUEUED) {
+    skipped++;
+    return;
+  }
+
+  char buffer[LIVE_STREAM_EVENT_MAX];
+  if (!format(entry, buffer, sizeof(buffer))) {
+    return;
+  }
+  if (events.send(buffer, "sample", entry.seq) == AsyncEventSource::DISCARDED) {
+    discarded++;
+  } else {
+    sent++;
+  }
+}
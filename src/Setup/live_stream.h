@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../configs.h"
+#include "../Database/device.h"
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Server-sent event stream of raw sensor samples for technicians on the setup
+// AP. Samples go into a small RAM ring; each one is formatted once and the
+// same event buffer is queued to every subscriber. New clients get the ring
+// replayed (or, on reconnect, whatever they missed since Last-Event-ID).
+class LiveStream {
+private:
+  struct Entry {
+    uint32_t seq;
+    SampleRecord record;
+  };
+
+  AsyncEventSource events;
+  Entry ring[LIVE_STREAM_RING_SIZE];
+  size_t head;
+  size_t count;
+  uint32_t nextSeq;
+  SemaphoreHandle_t mutex;
+  bool attached;
+
+  uint32_t sent;
+  uint32_t skipped;     // Held back because clients were falling behind
+  uint32_t discarded;   // Dropped by the server for at least one client
+
+  static size_t format(const Entry& entry, char* buffer, size_t size);
+  void replay(AsyncEventSourceClient* client);
+  void handlePage(AsyncWebServerRequest* request);
+
+public:
+  LiveStream();
+
+  // Register /events and the /live chart page on the portal's server
+  void attach(AsyncWebServer* server);
+  bool hasClients();
+
+  // Called at the sampling rate; ignored until attach()
+  void push(const SampleRecord& record);
+};
+
+extern LiveStream liveStream;
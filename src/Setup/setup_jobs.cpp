@@ -0,0 +1,139 @@
+#include "setup_jobs.h"
+
+const char* setupJobName(SetupJobType type) {
+  switch (type) {
+  case SETUP_JOB_ADDRESS_DATA:
+    return "address_data";
+  case SETUP_JOB_PROFILE_DATA:
+    return "profile_data";
+  case SETUP_JOB_SETUP:
+    return "setup";
+  default:
+    return "unknown";
+  }
+}
+
+SetupJobQueue::SetupJobQueue()
+  : mutex(nullptr), nextId(1), submitted(0), rejected(0), completed(0), maxWaitMs(0) {
+  for (int i = 0; i < SETUP_JOB_SLOTS; i++) {
+    slots[i].id = 0;
+    slots[i].state = SETUP_JOB_FREE;
+  }
+}
+
+void SetupJobQueue::begin() {
+  // Made on first use of the portal rather than at construction
+  if (!mutex) {
+    mutex = xSemaphoreCreateMutex();
+  }
+}
+
+SetupJob* SetupJobQueue::find(uint32_t id) {
+  for (int i = 0; i < SETUP_JOB_SLOTS; i++) {
+    if (slots[i].state != SETUP_JOB_FREE && slots[i].id == id) {
+      return &slots[i];
+    }
+  }
+  return nullptr;
+}
+
+void SetupJobQueue::expireResults() {
+  for (int i = 0; i < SETUP_JOB_SLOTS; i++) {
+    if (slots[i].state == SETUP_JOB_DONE && millis() - slots[i].doneAtMs > SETUP_JOB_RESULT_TTL_MS) {
+      slots[i].state = SETUP_JOB_FREE;
+      slots[i].result = String();
+    }
+  }
+}
+
+uint32_t SetupJobQueue::submit(SetupJobType type, const String& payload) {
+  uint32_t id = 0;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  expireResults();
+  for (int i = 0; i < SETUP_JOB_SLOTS; i++) {
+    if (slots[i].state == SETUP_JOB_FREE) {
+      id = nextId++;
+      slots[i].id = id;
+      slots[i].type = type;
+      slots[i].state = SETUP_JOB_QUEUED;
+      slots[i].payload = payload;
+      slots[i].statusCode = 0;
+      slots[i].result = String();
+      slots[i].queuedAtMs = millis();
+      submitted++;
+      break;
+    }
+  }
+  if (id == 0) {
+    rejected++;
+  }
+  xSemaphoreGive(mutex);
+  return id;
+}
+
+bool SetupJobQueue::takeNext(SetupJob& job) {
+  SetupJob* oldest = nullptr;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < SETUP_JOB_SLOTS; i++) {
+    if (slots[i].state == SETUP_JOB_QUEUED && (!oldest || slots[i].id < oldest->id)) {
+      oldest = &slots[i];
+    }
+  }
+  if (oldest) {
+    oldest->state = SETUP_JOB_RUNNING;
+    job = *oldest;
+    unsigned long waitedMs = millis() - oldest->queuedAtMs;
+    if (waitedMs > maxWaitMs) {
+      maxWaitMs = waitedMs;
+    }
+  }
+  xSemaphoreGive(mutex);
+  return oldest != nullptr;
+}
+
+void SetupJobQueue::complete(uint32_t id, int statusCode, const String& result, const String& resultPath) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  SetupJob* job = find(id);
+  if (job) {
+    job->state = SETUP_JOB_DONE;
+    job->statusCode = statusCode;
+    job->result = result;
+    job->resultPath = resultPath;
+    job->payload = String();
+    job->doneAtMs = millis();
+    completed++;
+    Serial.printf("Setup job %u (%s) -> %d after %lu ms (jobs: %u submitted, %u rejected, max wait %lu ms)\n",
+                  id, setupJobName(job->type), statusCode, job->doneAtMs - job->queuedAtMs,
+                  submitted, rejected, maxWaitMs);
+  }
+  xSemaphoreGive(mutex);
+}
+
+int SetupJobQueue::poll(uint32_t id, String& result, String& resultPath) {
+  int status = -1;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  SetupJob* job = find(id);
+  if (job && job->state == SETUP_JOB_DONE) {
+    status = job->statusCode;
+    result = job->result;
+    resultPath = job->resultPath;
+    job->state = SETUP_JOB_FREE;
+    job->result = String();
+  } else if (job) {
+    status = 0;
+  }
+  xSemaphoreGive(mutex);
+  return status;
+}
+
+size_t SetupJobQueue::pending() {
+  size_t count = 0;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < SETUP_JOB_SLOTS; i++) {
+    if (slots[i].state == SETUP_JOB_QUEUED || slots[i].state == SETUP_JOB_RUNNING) {
+      count++;
+    }
+  }
+  xSemaphoreGive(mutex);
+  return count;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+enum SetupJobType {
+  SETUP_JOB_ADDRESS_DATA,
+  SETUP_JOB_PROFILE_DATA,
+  SETUP_JOB_SETUP
+};
+
+enum SetupJobState {
+  SETUP_JOB_FREE,
+  SETUP_JOB_QUEUED,
+  SETUP_JOB_RUNNING,
+  SETUP_JOB_DONE
+};
+
+struct SetupJob {
+  uint32_t id;
+  SetupJobType type;
+  SetupJobState state;
+  String payload;
+  int statusCode;
+  String result;
+  String resultPath;   // Serve this file instead of result, for large responses
+  unsigned long queuedAtMs;
+  unsigned long doneAtMs;
+};
+
+const char* setupJobName(SetupJobType type);
+
+// Fixed-size job table between the web server task, which submits jobs and
+// polls for results, and the loop task, which owns the modem and runs them in
+// FIFO order. All access goes through a mutex.
+class SetupJobQueue {
+private:
+  SetupJob slots[SETUP_JOB_SLOTS];
+  SemaphoreHandle_t mutex;
+  uint32_t nextId;
+
+  uint32_t submitted;
+  uint32_t rejected;
+  uint32_t completed;
+  unsigned long maxWaitMs;
+
+  SetupJob* find(uint32_t id);
+  void expireResults();
+
+public:
+  SetupJobQueue();
+
+  // Create the mutex; call before the portal starts taking jobs
+  void begin();
+
+  // Returns the job ID, or 0 if every slot is busy
+  uint32_t submit(SetupJobType type, const String& payload);
+
+  // Copy the oldest queued job and mark it running
+  bool takeNext(SetupJob& job);
+  void complete(uint32_t id, int statusCode, const String& result, const String& resultPath = String());
+
+  // 0 while queued or running, -1 if unknown or expired, else the job's
+  // status code; a finished job is released once its result is taken
+  int poll(uint32_t id, String& result, String& resultPath);
+
+  size_t pending();
+};
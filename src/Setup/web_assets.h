@@ -0,0 +1,431 @@
+// Generated by tools/build_web.py from web/ -- do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+// web/setup.html: 26115 bytes, 19030 minified, 5204 gzipped
+#define SETUP_PAGE_ETAG "\"b67bbd61\""
+const size_t SETUP_PAGE_GZ_LEN = 5204;
+const uint8_t SETUP_PAGE_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3c, 0x89, 0x6e, 0xdb, 0x48,
+  0x96, 0xbf, 0xc2, 0x28, 0x88, 0x29, 0x8e, 0x29, 0x5a, 0xb2, 0x2d, 0xc7, 0xd1, 0xd5, 0x9d, 0x38,
+  0xf6, 0x8e, 0x07, 0x39, 0x8c, 0x38, 0xc1, 0x62, 0x10, 0x04, 0x01, 0x45, 0x16, 0x25, 0x76, 0x78,
+  0x2d, 0x59, 0xb2, 0xad, 0x91, 0xf5, 0x4f, 0xfb, 0x0d, 0xfb, 0x65, 0xfb, 0x5e, 0x1d, 0x64, 0x91,
+  0x22, 0x25, 0xc5, 0xe9, 0x06, 0x1a, 0x41, 0x27, 0x64, 0x1d, 0xaf, 0xde, 0x7d, 0x15, 0xd5, 0xa3,
+  0x67, 0x6f, 0x3f, 0x5e, 0x7c, 0xfe, 0xf7, 0xcd, 0xa5, 0x36, 0xa7, 0x61, 0x30, 0x19, 0x89, 0xbf,
+  0x89, 0xed, 0x4e, 0x46, 0xd4, 0xa7, 0x01, 0x99, 0xdc, 0x86, 0x76, 0x4a, 0xb5, 0x4b, 0x67, 0x1e,
+  0x6b, 0x6f, 0x53, 0xdb, 0x8f, 0xb4, 0x8e, 0xf6, 0x96, 0xdc, 0xf9, 0x0e, 0xd1, 0x6e, 0x09, 0x5d,
+  0x24, 0xa3, 0x23, 0xbe, 0x6c, 0x14, 0x12, 0x6a, 0x6b, 0x91, 0x1d, 0x92, 0x71, 0xeb, 0xce, 0x27,
+  0xf7, 0x49, 0x9c, 0xd2, 0x96, 0xe6, 0xc4, 0x11, 0x25, 0x11, 0x1d, 0xb7, 0xee, 0x7d, 0x97, 0xce,
+  0xc7, 0x2e, 0xdb, 0xd8, 0x61, 0x2f, 0xa6, 0xe6, 0x47, 0x3e, 0xf5, 0xed, 0xa0, 0x93, 0x39, 0x76,
+  0x40, 0xc6, 0xbd, 0xd6, 0x64, 0x94, 0xd1, 0x25, 0x80, 0xfa, 0xc7, 0x0a, 0x8e, 0x9c, 0xf9, 0xd1,
+  0xa0, 0x3b, 0x4c, 0x6c, 0xd7, 0xf5, 0xa3, 0x19, 0x3c, 0x4d, 0xe3, 0x87, 0x4e, 0xe6, 0xff, 0x07,
+  0x5f, 0xa6, 0x71, 0xea, 0x92, 0xb4, 0x03, 0x23, 0xeb, 0x69, 0xec, 0x2e, 0x57, 0x1e, 0x1c, 0xd2,
+  0xf1, 0xec, 0xd0, 0x0f, 0x96, 0x83, 0x8e, 0x9d, 0x24, 0x01, 0xe9, 0x64, 0xcb, 0x8c, 0x92, 0xd0,
+  0x7c, 0x13, 0xf8, 0xd1, 0x8f, 0xf7, 0xb6, 0x73, 0xcb, 0x5e, 0xaf, 0x60, 0x9d, 0xa9, 0xdf, 0x92,
+  0x59, 0x4c, 0xb4, 0x2f, 0xd7, 0xba, 0xf9, 0x29, 0x9e, 0xc6, 0x34, 0x36, 0x3f, 0x3e, 0x2c, 0x67,
+  0x24, 0x32, 0xbf, 0x4c, 0x17, 0x11, 0x5d, 0x98, 0x17, 0x76, 0x44, 0xed, 0x94, 0x04, 0x81, 0x99,
+  0xd9, 0x51, 0xd6, 0xc9, 0x48, 0xea, 0x7b, 0xc3, 0xa9, 0xed, 0xfc, 0x98, 0xa5, 0xf1, 0x22, 0x72,
+  0x07, 0x00, 0x91, 0xd8, 0x69, 0x67, 0x96, 0xda, 0xae, 0x0f, 0x94, 0xb5, 0x7b, 0x27, 0x7d, 0x97,
+  0xcc, 0xcc, 0xe7, 0x67, 0x67, 0x2f, 0x09, 0xb1, 0xb5, 0xee, 0x0b, 0xf3, 0xf9, 0xcb, 0xb3, 0xd3,
+  0xa9, 0x7d, 0xac, 0xf5, 0xba, 0xdd, 0x17, 0xc6, 0x30, 0xf4, 0xa3, 0xce, 0x9c, 0xf8, 0xb3, 0x39,
+  0x1d, 0xc0, 0xc0, 0xdd, 0x3c, 0x27, 0xa9, 0x97, 0x92, 0x70, 0xe8, 0xc4, 0x41, 0x9c, 0x0e, 0x9e,
+  0x9f, 0x9c, 0x9c, 0xac, 0x2d, 0xe4, 0x15, 0xf0, 0x97, 0xa4, 0x40, 0xfe, 0x03, 0xe7, 0x11, 0x6e,
+  0x79, 0x31, 0x54, 0x1e, 0x25, 0x63, 0x34, 0x7b, 0x41, 0x63, 0x15, 0xad, 0xe7, 0x9e, 0x07, 0x68,
+  0x72, 0xc6, 0x20, 0x6a, 0x8b, 0x6c, 0xd0, 0x3b, 0x4e, 0x1e, 0x38, 0xdb, 0xe6, 0xb6, 0x1b, 0xdf,
+  0xc3, 0xa6, 0x5e, 0x37, 0x79, 0xd0, 0x4e, 0xf1, 0xaf, 0x74, 0x36, 0xb5, 0xdb, 0x5d, 0x93, 0xfd,
+  0xb1, 0x7a, 0x7d, 0x63, 0x18, 0xdf, 0x91, 0xd4, 0x0b, 0x60, 0xd5, 0xdc, 0x77, 0x5d, 0x12, 0xad,
+  0x7f, 0x0f, 0x89, 0xeb, 0xdb, 0x6d, 0xc4, 0x9e, 0x1f, 0xff, 0xf2, 0xec, 0x3c, 0x79, 0x30, 0x56,
+  0xb5, 0x58, 0x9e, 0x77, 0x01, 0xa6, 0xc4, 0xed, 0x18, 0xe8, 0x62, 0xe8, 0xad, 0x37, 0x81, 0xf4,
+  0x8e, 0x71, 0x65, 0x03, 0x94, 0x57, 0x38, 0xb7, 0x5e, 0x5b, 0xa8, 0x7c, 0x30, 0xf1, 0x0b, 0x3c,
+  0x17, 0x5c, 0x45, 0x96, 0x48, 0x6e, 0x33, 0xac, 0x7a, 0x56, 0x1f, 0x99, 0x4e, 0xc9, 0x03, 0xed,
+  0xd8, 0x81, 0x3f, 0x8b, 0x06, 0x0e, 0x80, 0x23, 0xa9, 0x3c, 0x53, 0x9b, 0xf7, 0xb8, 0x32, 0x81,
+  0xa2, 0x91, 0x81, 0x13, 0xd8, 0x61, 0xd2, 0xe6, 0x7b, 0xcc, 0xd3, 0xbb, 0x7b, 0xf3, 0x98, 0x3d,
+  0x1a, 0x82, 0x50, 0xd0, 0x3f, 0x4a, 0xe3, 0x70, 0xd0, 0xe5, 0x40, 0xd9, 0xbe, 0x7b, 0x2e, 0xe8,
+  0x97, 0xdd, 0x6e, 0x0e, 0xd2, 0xca, 0x16, 0x53, 0x66, 0x21, 0xab, 0x38, 0xb1, 0x1d, 0x9f, 0x2e,
+  0x61, 0xc3, 0xab, 0x61, 0xf5, 0x14, 0x18, 0xc3, 0x53, 0xe0, 0x04, 0x38, 0xa7, 0x67, 0xa1, 0x6e,
+  0x18, 0x6b, 0x2b, 0x49, 0xe3, 0x59, 0x4a, 0xb2, 0xac, 0x53, 0xb0, 0x2b, 0x37, 0x08, 0x49, 0x8c,
+  0x40, 0x86, 0xc6, 0xc9, 0xa0, 0xc3, 0x51, 0x51, 0xf6, 0x4d, 0xed, 0x74, 0xa5, 0x68, 0x8f, 0xd0,
+  0xc3, 0x53, 0xd4, 0x8b, 0x82, 0xbb, 0x4c, 0x17, 0x7a, 0xdd, 0x63, 0xb3, 0x77, 0x7c, 0x66, 0x1e,
+  0x9f, 0x9c, 0x82, 0x46, 0x1c, 0x1b, 0x15, 0x5d, 0x42, 0x55, 0xaa, 0xaa, 0x48, 0x71, 0x8c, 0xe7,
+  0x07, 0xc1, 0xaa, 0x50, 0xf2, 0x17, 0xdb, 0xec, 0xe5, 0x55, 0x57, 0x11, 0x9d, 0x94, 0x9b, 0x31,
+  0xa4, 0x29, 0x58, 0x1b, 0xb8, 0x83, 0x38, 0x1a, 0x30, 0x84, 0x35, 0xa0, 0x25, 0xd3, 0x88, 0x9d,
+  0x11, 0xa1, 0xfe, 0xc0, 0xd1, 0x10, 0x58, 0xd0, 0x11, 0x1e, 0x25, 0x67, 0x04, 0x67, 0x43, 0xb3,
+  0xbe, 0xd6, 0x6e, 0x42, 0x6d, 0x00, 0x4d, 0xcb, 0xa8, 0x4d, 0x17, 0xc0, 0x5d, 0x3b, 0x75, 0x57,
+  0x25, 0xb3, 0x2c, 0x13, 0x7f, 0x9e, 0x2b, 0xb7, 0x94, 0x79, 0x4f, 0x91, 0x39, 0x93, 0x22, 0x97,
+  0xdf, 0xd0, 0xf5, 0xb3, 0x24, 0xb0, 0x97, 0x03, 0x2f, 0x20, 0x0f, 0x43, 0xa6, 0x61, 0x1d, 0x1f,
+  0x1c, 0x4f, 0x26, 0xf4, 0x6c, 0x38, 0xb3, 0x93, 0x81, 0x14, 0x92, 0x38, 0x3c, 0x05, 0x35, 0x59,
+  0xaa, 0xca, 0xfe, 0xdc, 0x3d, 0x25, 0xae, 0x6b, 0x4b, 0x25, 0xee, 0xf5, 0xfb, 0x2f, 0x8f, 0x4f,
+  0x05, 0x46, 0x83, 0x1e, 0xd8, 0x6e, 0x16, 0x07, 0xbe, 0xab, 0x3d, 0x77, 0x4e, 0xc8, 0x99, 0x33,
+  0xcd, 0xe1, 0x90, 0x34, 0x8d, 0x4b, 0x46, 0xf3, 0xdc, 0x3b, 0x77, 0x5f, 0x16, 0x70, 0x5e, 0x1e,
+  0xf7, 0x9c, 0x5a, 0x38, 0x5e, 0xdf, 0x51, 0xe1, 0x04, 0xb1, 0x8d, 0x7c, 0x58, 0x55, 0x7c, 0xcb,
+  0x89, 0xe3, 0x4a, 0x48, 0xe7, 0xfd, 0xb3, 0xd3, 0x6e, 0x2d, 0x24, 0x8f, 0xd8, 0xf6, 0xcb, 0xb5,
+  0x25, 0xbc, 0xbc, 0x1f, 0x79, 0xf1, 0x3e, 0x56, 0xec, 0x75, 0x5f, 0x9d, 0x78, 0x53, 0x66, 0xc5,
+  0x1e, 0x10, 0x7b, 0xe6, 0x34, 0x5b, 0xb1, 0xe0, 0x7b, 0xc5, 0xcf, 0x75, 0x1b, 0xe4, 0x53, 0xc2,
+  0x44, 0x9b, 0x9f, 0xac, 0x2a, 0x8b, 0xca, 0x22, 0xec, 0x59, 0xc7, 0x1b, 0x7b, 0x5c, 0xff, 0x6e,
+  0x55, 0x6b, 0xed, 0x25, 0x41, 0xe3, 0x5f, 0x9d, 0xfb, 0x14, 0x64, 0x8b, 0x7f, 0x95, 0x84, 0xac,
+  0x02, 0xcb, 0x68, 0x1a, 0x03, 0x63, 0x0b, 0x15, 0x3d, 0x47, 0x7f, 0x67, 0x79, 0x71, 0x1a, 0x42,
+  0x98, 0x71, 0x50, 0xf7, 0x2b, 0xf2, 0xf3, 0x5e, 0x79, 0xf6, 0x93, 0x69, 0x57, 0xe1, 0x36, 0x10,
+  0x5f, 0x44, 0x9f, 0x12, 0x1f, 0x7a, 0xc5, 0x7e, 0xc4, 0x25, 0xa9, 0xdb, 0x9a, 0xc4, 0xc2, 0x5a,
+  0x21, 0x54, 0xda, 0xd4, 0xbf, 0x23, 0x62, 0x43, 0x1a, 0xdf, 0xaf, 0x24, 0x73, 0x66, 0xa9, 0xef,
+  0x32, 0x6e, 0xb0, 0x1d, 0xf8, 0xd6, 0x01, 0x63, 0x80, 0x29, 0x4a, 0xc0, 0x22, 0x83, 0x45, 0x18,
+  0x01, 0x01, 0x5e, 0xba, 0x69, 0xbb, 0x67, 0x22, 0x4a, 0xe4, 0x10, 0x1b, 0xf7, 0x6a, 0xb8, 0x7f,
+  0x13, 0xc0, 0xab, 0x0a, 0x00, 0x8b, 0xa6, 0x3e, 0xa4, 0x05, 0xdb, 0xe1, 0x70, 0x58, 0x0a, 0xdd,
+  0x5a, 0x60, 0x4f, 0x49, 0x90, 0x93, 0x33, 0x0d, 0x62, 0xe7, 0xc7, 0x6e, 0xe7, 0x0f, 0xc8, 0x4b,
+  0xc6, 0xf6, 0xfb, 0xfd, 0x0d, 0x1f, 0x51, 0x3a, 0xc0, 0x8f, 0x92, 0x05, 0x35, 0xd5, 0x91, 0x8c,
+  0x04, 0x20, 0x32, 0xd5, 0x69, 0xe7, 0x1e, 0xdf, 0x7a, 0xa9, 0x28, 0x00, 0x7a, 0x64, 0x69, 0x77,
+  0xae, 0xeb, 0x56, 0xd4, 0xe2, 0x0c, 0xb4, 0x42, 0x91, 0x28, 0x0b, 0x7a, 0x85, 0x83, 0xb5, 0x83,
+  0x00, 0xdc, 0xeb, 0x89, 0x70, 0xaf, 0x15, 0x43, 0xdf, 0xc4, 0x6f, 0xe0, 0xc5, 0xce, 0x22, 0xab,
+  0xc1, 0x92, 0x4f, 0xac, 0xe2, 0x05, 0x45, 0xd3, 0x1e, 0x44, 0x71, 0x44, 0x24, 0x1e, 0x82, 0x01,
+  0xdc, 0xcb, 0x97, 0x93, 0x10, 0xfc, 0x73, 0x22, 0x53, 0x90, 0x72, 0xd8, 0xe9, 0x19, 0x35, 0xa7,
+  0x03, 0xfb, 0xed, 0x69, 0x40, 0xdc, 0x3a, 0x04, 0xe4, 0x5c, 0xd9, 0x6e, 0xfa, 0xf8, 0x47, 0xca,
+  0xe0, 0xd5, 0xab, 0x57, 0x43, 0x67, 0x91, 0x66, 0xf0, 0x1c, 0xc5, 0x18, 0xf6, 0x21, 0x82, 0x11,
+  0x77, 0x6d, 0x09, 0x3f, 0xd7, 0xc9, 0x12, 0x3f, 0x62, 0x81, 0x55, 0x2a, 0xb4, 0x3d, 0x05, 0xb6,
+  0x2e, 0x28, 0x19, 0xa6, 0x3c, 0x9e, 0x61, 0xe8, 0xc3, 0xe8, 0xda, 0x07, 0x59, 0x30, 0x26, 0x22,
+  0x1a, 0x03, 0xf6, 0x84, 0x5a, 0xf4, 0xef, 0x76, 0xa7, 0x8f, 0xde, 0x8a, 0x4b, 0xec, 0x18, 0xed,
+  0x51, 0x44, 0x42, 0xf6, 0xbc, 0x29, 0x2d, 0xef, 0x04, 0xff, 0x54, 0x04, 0x86, 0xc0, 0xc5, 0x08,
+  0x9e, 0xa5, 0x2c, 0x17, 0x2c, 0xb4, 0x23, 0x3f, 0xb4, 0x19, 0x7e, 0x88, 0xb0, 0xd6, 0xcb, 0x34,
+  0xee, 0x4e, 0x81, 0x49, 0x1e, 0xe6, 0xd1, 0x24, 0x77, 0x49, 0x28, 0x86, 0x0d, 0xf2, 0xac, 0x6c,
+  0xae, 0x18, 0x26, 0xd3, 0x64, 0x95, 0xd5, 0x72, 0xb9, 0x54, 0x3f, 0xa1, 0x73, 0x1d, 0xce, 0x82,
+  0xd3, 0x3e, 0xf8, 0xa9, 0xdf, 0x7f, 0x90, 0xa5, 0x97, 0x42, 0x7a, 0x9f, 0x69, 0x08, 0x73, 0xd5,
+  0x7d, 0xb1, 0x6a, 0xe6, 0x86, 0x96, 0xc6, 0x10, 0x4d, 0x48, 0x1b, 0x63, 0xbd, 0xb1, 0x46, 0x35,
+  0xde, 0x63, 0xf1, 0xc9, 0x19, 0x5f, 0xbe, 0xb6, 0xa6, 0x34, 0xaa, 0xb3, 0x00, 0x1e, 0x9a, 0xff,
+  0x94, 0xb4, 0x50, 0x88, 0x45, 0x55, 0x59, 0x25, 0xd8, 0x57, 0x9d, 0xe1, 0xa6, 0x7d, 0x73, 0x85,
+  0x4a, 0x62, 0x9f, 0x85, 0xf5, 0x46, 0xdb, 0xda, 0xf0, 0x92, 0x9b, 0x49, 0x14, 0xd0, 0x3a, 0x98,
+  0xe3, 0x28, 0xaa, 0x67, 0x3b, 0xd7, 0x68, 0xa3, 0x81, 0x61, 0xa0, 0x19, 0x46, 0xd9, 0x9e, 0x40,
+  0x38, 0x5a, 0xaf, 0x5f, 0x6f, 0x50, 0xa7, 0x06, 0x3f, 0x20, 0xb7, 0x93, 0x22, 0x07, 0x3d, 0xab,
+  0xb1, 0x0a, 0x45, 0xbf, 0xb9, 0x16, 0xa9, 0x7b, 0x39, 0x96, 0x2b, 0xe5, 0xec, 0x7c, 0x4d, 0x9e,
+  0x34, 0x6c, 0xd2, 0xcb, 0x79, 0xce, 0xe0, 0x26, 0x50, 0x56, 0x45, 0xb4, 0xb4, 0x61, 0x30, 0x25,
+  0x70, 0x1a, 0x59, 0x89, 0xfc, 0x6c, 0xa0, 0xeb, 0xc3, 0x4d, 0x3b, 0x94, 0xc6, 0x17, 0x10, 0x8f,
+  0xb2, 0x87, 0x06, 0x53, 0x13, 0xf5, 0x47, 0x87, 0x55, 0x39, 0xe8, 0x65, 0xd8, 0xd3, 0xa6, 0x05,
+  0x2a, 0xc8, 0x34, 0xd8, 0xdc, 0x66, 0x2d, 0x85, 0xc7, 0xee, 0x34, 0x41, 0x99, 0x43, 0xed, 0x99,
+  0x4b, 0xe2, 0xa1, 0x4d, 0x15, 0xc9, 0x86, 0xc6, 0x95, 0xad, 0x3b, 0x5b, 0x38, 0x0e, 0x24, 0xde,
+  0xbf, 0x92, 0x36, 0xfe, 0x72, 0xbe, 0xf8, 0x27, 0x24, 0x8a, 0xcc, 0x01, 0xd5, 0xe8, 0x66, 0x7f,
+  0x28, 0x2c, 0xab, 0x43, 0xee, 0x80, 0x1d, 0x19, 0xb7, 0xd3, 0x26, 0x2b, 0x5b, 0x5b, 0x29, 0xf1,
+  0xa0, 0x0e, 0x99, 0x77, 0xd0, 0x6f, 0x08, 0xe6, 0x32, 0x65, 0x11, 0xd1, 0xb9, 0x88, 0xa0, 0xc7,
+  0xf8, 0xae, 0x75, 0x37, 0xb3, 0xf7, 0xf3, 0x8a, 0x6b, 0x91, 0x6e, 0x97, 0x53, 0x72, 0x3f, 0x47,
+  0x07, 0xdb, 0xec, 0x33, 0xb0, 0xa0, 0x2a, 0xbb, 0x84, 0x12, 0x4e, 0xd2, 0x72, 0x14, 0xf0, 0x7d,
+  0xfb, 0xcc, 0x73, 0xcf, 0xd7, 0xa3, 0x23, 0xde, 0xf1, 0x18, 0x1d, 0xf1, 0x8e, 0x0b, 0xb6, 0x33,
+  0x26, 0x23, 0xc8, 0x3a, 0x35, 0x28, 0x0b, 0xb3, 0x6c, 0xdc, 0xca, 0x0b, 0xbf, 0x56, 0x69, 0x98,
+  0xd7, 0x96, 0x30, 0x36, 0xef, 0x6d, 0xf4, 0x67, 0x00, 0x56, 0x6f, 0x32, 0x4a, 0xe4, 0x52, 0x59,
+  0x7e, 0xb6, 0x26, 0xa2, 0x6b, 0x73, 0x11, 0x83, 0xba, 0xce, 0x16, 0x29, 0x53, 0x65, 0xed, 0x40,
+  0x76, 0x71, 0x12, 0x40, 0x02, 0x4e, 0x28, 0x1d, 0xb3, 0x59, 0x7f, 0xb6, 0xea, 0xe7, 0xa1, 0xce,
+  0x6c, 0x98, 0xc1, 0xd2, 0xb0, 0xa5, 0xf9, 0x6e, 0x31, 0x74, 0x85, 0x23, 0xf2, 0x30, 0xf5, 0x6f,
+  0x65, 0xbb, 0x5a, 0xb4, 0x09, 0xc0, 0x08, 0x22, 0x8c, 0x5d, 0x12, 0xde, 0x32, 0x1b, 0x6b, 0xe5,
+  0xf4, 0x15, 0x35, 0x9c, 0xa6, 0x96, 0x42, 0xad, 0xc9, 0x35, 0x6f, 0x2f, 0xb1, 0x9e, 0x91, 0xe6,
+  0x90, 0x20, 0x58, 0x04, 0x60, 0xac, 0x00, 0x35, 0xe2, 0x49, 0xb1, 0x65, 0x59, 0xda, 0x4d, 0x80,
+  0x1a, 0xa4, 0xdd, 0xdb, 0x3e, 0xb5, 0x36, 0xd1, 0x50, 0xb2, 0x77, 0xe4, 0xf5, 0x89, 0x64, 0xe1,
+  0x75, 0x84, 0x9a, 0xcb, 0x18, 0x08, 0xdc, 0x3e, 0x61, 0x7b, 0xb0, 0x79, 0x85, 0xf9, 0x7d, 0xbe,
+  0xe6, 0xed, 0x00, 0xa5, 0xcb, 0x86, 0x46, 0xe0, 0x6e, 0x22, 0x46, 0x01, 0x87, 0x78, 0xed, 0xb6,
+  0x26, 0x1d, 0x98, 0x85, 0x51, 0x85, 0xf8, 0x1c, 0xc2, 0x95, 0x9f, 0x86, 0xf7, 0xe0, 0x9f, 0xea,
+  0x00, 0x78, 0x62, 0x6e, 0x2b, 0x80, 0x8b, 0xb9, 0x9f, 0xd4, 0x6d, 0x76, 0x60, 0x7c, 0xeb, 0xc6,
+  0xcf, 0x90, 0x1a, 0x13, 0xd0, 0x8c, 0x45, 0xfd, 0xe1, 0xb4, 0x98, 0xae, 0x07, 0x63, 0x6b, 0x73,
+  0xd0, 0xfb, 0x71, 0xeb, 0x28, 0x00, 0xdf, 0xdf, 0xd2, 0x98, 0x72, 0xa3, 0x12, 0xcb, 0xb8, 0xdb,
+  0x9a, 0xbc, 0x83, 0x09, 0xc8, 0x32, 0x22, 0xb0, 0x15, 0x0d, 0xdb, 0x84, 0xa3, 0x23, 0xbb, 0xac,
+  0x05, 0xc8, 0x59, 0x76, 0x58, 0x86, 0x7a, 0x79, 0x05, 0x6f, 0xb9, 0xa8, 0x4b, 0xee, 0xa2, 0xac,
+  0x6f, 0x45, 0x2a, 0x03, 0xe3, 0x2c, 0x6d, 0xd7, 0x60, 0x48, 0xf2, 0xfb, 0x3b, 0xb6, 0x25, 0x73,
+  0x03, 0xf8, 0x00, 0x2f, 0x40, 0x1d, 0x5b, 0x35, 0x19, 0xb1, 0x24, 0x53, 0xa3, 0xcb, 0x84, 0x20,
+  0x7d, 0x0f, 0xb4, 0xa5, 0xc8, 0x89, 0xef, 0x13, 0x4d, 0xcd, 0xd2, 0x50, 0x4a, 0xfe, 0x67, 0xe1,
+  0xa7, 0xc4, 0xd5, 0xc0, 0x29, 0x3b, 0x64, 0x1e, 0x07, 0x60, 0x8e, 0xe3, 0x16, 0xb1, 0x66, 0x96,
+  0xa9, 0xb6, 0x4a, 0x6f, 0x39, 0xa1, 0xdd, 0x6e, 0xaf, 0xa5, 0x85, 0xf6, 0x43, 0x40, 0xa2, 0x19,
+  0x9d, 0x8f, 0x5b, 0xfd, 0x6e, 0xab, 0x46, 0xe9, 0xd5, 0x82, 0xad, 0xa4, 0x6e, 0x1f, 0xef, 0xc1,
+  0xf2, 0xb4, 0xf6, 0xc7, 0x04, 0x67, 0xec, 0xc0, 0xc8, 0x75, 0x6e, 0x17, 0xf5, 0xf1, 0x3d, 0x33,
+  0xd9, 0x5b, 0x96, 0xd4, 0x71, 0x30, 0x83, 0xd1, 0x74, 0x01, 0x95, 0x4b, 0x24, 0x28, 0xe6, 0x2f,
+  0x39, 0x87, 0x15, 0xa7, 0xc5, 0xf9, 0x20, 0x06, 0xd8, 0x56, 0xb0, 0x39, 0xe6, 0x49, 0xc6, 0xad,
+  0x4f, 0x7c, 0x54, 0x63, 0xf0, 0x21, 0x0a, 0x66, 0x60, 0xa4, 0x62, 0x6c, 0x74, 0xc4, 0x41, 0x4e,
+  0x72, 0x06, 0xf3, 0x94, 0x92, 0x41, 0xe3, 0xf8, 0x08, 0x7e, 0x0a, 0xe4, 0x46, 0x31, 0x23, 0x4b,
+  0xbb, 0xb3, 0x83, 0x05, 0x8c, 0xb6, 0x26, 0x1f, 0xa0, 0x52, 0x4e, 0x88, 0xe3, 0x7b, 0xbe, 0x23,
+  0x0e, 0x68, 0xdf, 0x2c, 0xa6, 0x01, 0xbc, 0x71, 0x09, 0x00, 0xf9, 0x7c, 0x0b, 0x1c, 0xc1, 0x61,
+  0x97, 0x78, 0x51, 0x49, 0x7c, 0x5b, 0xc5, 0xc1, 0xb7, 0x62, 0x64, 0x87, 0xef, 0x69, 0x14, 0xc3,
+  0xbb, 0xd8, 0x29, 0x9b, 0x7c, 0x69, 0x07, 0x54, 0x99, 0xfb, 0xa9, 0xa4, 0x03, 0x11, 0x80, 0xa6,
+  0xcb, 0xd6, 0xe4, 0x82, 0x3f, 0xec, 0x52, 0x45, 0xb9, 0x5e, 0xb0, 0x2d, 0x7f, 0x15, 0x0c, 0xbb,
+  0xf9, 0xe7, 0xf5, 0xbb, 0xeb, 0x9b, 0x9b, 0xeb, 0x0f, 0x97, 0xb7, 0xa8, 0x96, 0x90, 0x98, 0x45,
+  0xc1, 0xb2, 0x89, 0xac, 0x1a, 0x74, 0x52, 0x32, 0x63, 0x84, 0x7e, 0x62, 0xff, 0x0e, 0xea, 0xc4,
+  0x26, 0x96, 0x08, 0x04, 0xe4, 0x9b, 0x34, 0x81, 0x4d, 0x09, 0x0a, 0x7d, 0xe3, 0x10, 0xc1, 0xcb,
+  0x3e, 0x41, 0x60, 0xfc, 0x90, 0x9f, 0x91, 0xd8, 0xde, 0xfc, 0x87, 0x38, 0x74, 0xe7, 0x47, 0x0e,
+  0xf8, 0x83, 0x1b, 0xf1, 0x54, 0x4b, 0x74, 0xbe, 0x4c, 0x90, 0x5d, 0xbc, 0xe7, 0xb6, 0x2f, 0x5d,
+  0x51, 0x23, 0x07, 0xe4, 0x01, 0x4f, 0xe3, 0x81, 0x3c, 0xb1, 0x9e, 0x0b, 0x7b, 0x50, 0x1a, 0x2e,
+  0x22, 0xdf, 0xf1, 0x13, 0x08, 0x81, 0x14, 0xd5, 0x0d, 0xfe, 0x3e, 0x7a, 0xaf, 0x0c, 0xd5, 0x92,
+  0x5d, 0xda, 0x23, 0x48, 0x2f, 0x8f, 0xed, 0x4f, 0xfe, 0xc6, 0x89, 0x4f, 0xe3, 0x83, 0x7a, 0xfc,
+  0x5f, 0xa2, 0x11, 0x90, 0xbd, 0xd8, 0xd1, 0xcc, 0x06, 0x1e, 0xbd, 0x11, 0x4f, 0xb5, 0xac, 0xc9,
+  0x97, 0x09, 0xb6, 0x14, 0xef, 0xfb, 0xb3, 0x44, 0x1e, 0xf0, 0x34, 0x4e, 0xc8, 0x13, 0x9f, 0xac,
+  0x11, 0x50, 0x5c, 0x51, 0x3b, 0xf8, 0xee, 0x40, 0x1e, 0x05, 0xea, 0xcf, 0x5e, 0x20, 0x1f, 0x74,
+  0x77, 0x86, 0x43, 0x75, 0x9f, 0xb4, 0x07, 0x75, 0x68, 0x5b, 0x38, 0x84, 0xda, 0xbb, 0xdb, 0xd2,
+  0x12, 0x9b, 0x42, 0x5a, 0x1c, 0x8d, 0x5b, 0x5f, 0xbb, 0x9d, 0x57, 0xdf, 0x56, 0xa7, 0x66, 0x7f,
+  0x5d, 0x0e, 0x89, 0x3f, 0x4f, 0x0c, 0xa4, 0x27, 0x84, 0x40, 0xe4, 0xb9, 0x65, 0xff, 0x6a, 0xaf,
+  0x5d, 0x17, 0xd3, 0xcb, 0x5d, 0xa4, 0x88, 0x5d, 0x82, 0x0a, 0xf9, 0xb6, 0x95, 0x80, 0xe3, 0x13,
+  0xed, 0xd6, 0x0e, 0x93, 0x80, 0x68, 0xfc, 0x28, 0x53, 0xbb, 0x5d, 0x4c, 0x01, 0x41, 0x3f, 0x43,
+  0x11, 0xbf, 0x7e, 0x73, 0x51, 0xa2, 0x04, 0xe8, 0x6d, 0xfd, 0x04, 0x15, 0xde, 0x22, 0x08, 0x04,
+  0xea, 0xad, 0xc9, 0x15, 0xbc, 0x48, 0x42, 0xb4, 0xf6, 0xeb, 0x05, 0x8d, 0x3b, 0x33, 0x12, 0x61,
+  0xca, 0x45, 0x5c, 0x63, 0x17, 0x65, 0x2a, 0x24, 0x41, 0x5e, 0x69, 0x48, 0x06, 0x87, 0x32, 0x8d,
+  0x17, 0x31, 0x52, 0x46, 0x89, 0x66, 0x8b, 0x63, 0xef, 0x21, 0x3f, 0xd7, 0xec, 0x24, 0xc1, 0xca,
+  0x76, 0x4e, 0x52, 0x74, 0x5e, 0xad, 0x9f, 0x08, 0x96, 0xaf, 0xdd, 0x10, 0x8a, 0x61, 0xe0, 0xab,
+  0x4d, 0x21, 0xf3, 0x79, 0xed, 0xb0, 0x78, 0xb5, 0x77, 0xc6, 0x42, 0x20, 0xf3, 0x87, 0xea, 0x80,
+  0x01, 0xd1, 0x2e, 0xf1, 0xa5, 0x9e, 0x6a, 0xbe, 0x8e, 0x91, 0x2d, 0x1e, 0x39, 0xc1, 0xe2, 0xa5,
+  0x5e, 0x9c, 0x36, 0x42, 0xfd, 0x9d, 0x3c, 0x30, 0x59, 0x5a, 0x4e, 0x1c, 0xfe, 0x8a, 0xdc, 0x12,
+  0x98, 0xbd, 0x87, 0x2a, 0x50, 0x22, 0x7b, 0x23, 0xde, 0xeb, 0xf1, 0xcd, 0x57, 0x73, 0x73, 0xca,
+  0xdf, 0x84, 0x2d, 0xe5, 0xef, 0xf5, 0x88, 0xbf, 0x07, 0x8e, 0x86, 0x8b, 0x50, 0x3b, 0xd7, 0x9c,
+  0x39, 0xb8, 0x00, 0x87, 0xb2, 0x64, 0x0c, 0x4e, 0x95, 0xb8, 0x9f, 0x57, 0x24, 0x54, 0xca, 0xf1,
+  0xa0, 0x02, 0x0c, 0x7d, 0xa9, 0xfd, 0xec, 0xf9, 0x0d, 0x2d, 0x52, 0x3e, 0x96, 0xea, 0xe5, 0x7e,
+  0x2b, 0xd7, 0x06, 0x51, 0x15, 0xe6, 0xc9, 0x1c, 0xb2, 0xa1, 0x28, 0xc4, 0xb2, 0xba, 0x1a, 0xac,
+  0xd6, 0x29, 0x67, 0x4e, 0xea, 0x27, 0x74, 0x02, 0x30, 0xa5, 0x82, 0xbd, 0xb5, 0xa9, 0x3d, 0x5e,
+  0xf1, 0x00, 0x9f, 0x0d, 0xbe, 0x7e, 0x33, 0x65, 0x9c, 0x63, 0x2f, 0x0e, 0xd4, 0x6c, 0xfc, 0x49,
+  0x3a, 0x3b, 0x7c, 0x59, 0x0f, 0x11, 0x00, 0x77, 0x93, 0xc4, 0x45, 0x8f, 0x95, 0x49, 0x10, 0x03,
+  0x5d, 0xcf, 0x21, 0xe0, 0xb3, 0x1a, 0x2d, 0xf0, 0x5d, 0x82, 0x81, 0x67, 0x0e, 0x85, 0x15, 0x91,
+  0x9f, 0xf0, 0xd6, 0x6d, 0xec, 0xd9, 0x41, 0x46, 0xd8, 0x20, 0x4b, 0x10, 0xb3, 0x77, 0xe0, 0x74,
+  0x89, 0x5b, 0x3b, 0x7c, 0x05, 0x7a, 0x95, 0x4f, 0x79, 0x8b, 0x88, 0x5f, 0xab, 0x60, 0x57, 0xf5,
+  0x1d, 0xf7, 0xd4, 0x6d, 0x8e, 0xdd, 0xb5, 0x6b, 0x60, 0x37, 0x2b, 0xa3, 0xa8, 0x25, 0xe1, 0x7f,
+  0xa1, 0xde, 0x8c, 0xdd, 0xd8, 0x59, 0x84, 0x50, 0xc9, 0x5a, 0x33, 0x42, 0x2f, 0x03, 0x82, 0x8f,
+  0x6f, 0x96, 0xd7, 0x6e, 0xb1, 0xc3, 0xe2, 0xdd, 0x28, 0x31, 0x37, 0xe4, 0xfb, 0x85, 0xe7, 0xdf,
+  0xb9, 0xfb, 0x50, 0x17, 0xe1, 0x40, 0x37, 0x86, 0xf9, 0x99, 0x16, 0x93, 0xcc, 0x3b, 0xb0, 0x43,
+  0x0b, 0xd8, 0xde, 0xd6, 0x45, 0x38, 0x81, 0x25, 0xb2, 0x21, 0x5c, 0x59, 0x80, 0x94, 0xe8, 0xc6,
+  0x3a, 0xa7, 0x6c, 0xee, 0xbb, 0xe4, 0xef, 0x4e, 0x59, 0x4a, 0xc2, 0xf8, 0x8e, 0x6c, 0x27, 0x4e,
+  0xae, 0x11, 0xf4, 0xd9, 0xd9, 0x32, 0x72, 0xb4, 0x9c, 0x4a, 0x3b, 0xf1, 0xdb, 0x8b, 0x34, 0x30,
+  0x79, 0x24, 0xce, 0x8c, 0x15, 0x0a, 0x1d, 0x94, 0x34, 0x81, 0x17, 0x32, 0xb6, 0xb1, 0x2d, 0xa0,
+  0x79, 0x84, 0x3a, 0xf3, 0xd2, 0xaa, 0xe1, 0xfd, 0x1c, 0x94, 0xa1, 0x2d, 0xd7, 0x89, 0xae, 0xdf,
+  0x78, 0x3c, 0x3e, 0xee, 0x1e, 0x4b, 0x1e, 0xfd, 0x11, 0x4f, 0xc5, 0xfe, 0x7c, 0xd9, 0x1f, 0x59,
+  0x1c, 0xb5, 0x8d, 0x21, 0x1f, 0x8d, 0xc8, 0x3d, 0xa6, 0x87, 0xa1, 0x9f, 0x31, 0x40, 0x71, 0x70,
+  0x47, 0xc6, 0x13, 0x28, 0x79, 0x3f, 0xfb, 0x21, 0x89, 0x17, 0x54, 0x8e, 0x99, 0xfd, 0x6e, 0xd7,
+  0x30, 0x86, 0xb5, 0x28, 0xe9, 0x47, 0x70, 0xc8, 0x6f, 0x60, 0x8e, 0xfa, 0x21, 0x3c, 0x58, 0xf0,
+  0x9f, 0xb1, 0x4e, 0xc1, 0x6c, 0xd3, 0x28, 0x3f, 0xb3, 0x90, 0x27, 0xf2, 0x88, 0xd7, 0x31, 0xd8,
+  0xbc, 0x68, 0x1b, 0x2b, 0x09, 0x43, 0x94, 0xb5, 0xd8, 0xe3, 0xd0, 0x0d, 0x8b, 0xce, 0x49, 0x94,
+  0x13, 0x36, 0x9e, 0x54, 0x70, 0x17, 0xf3, 0xb8, 0x76, 0x3c, 0x59, 0x35, 0x89, 0x4f, 0x97, 0x4d,
+  0x0e, 0x84, 0x07, 0xd1, 0xe9, 0x42, 0x7c, 0x03, 0x84, 0xdb, 0x2c, 0x79, 0x9c, 0x3b, 0x6c, 0xdc,
+  0x2e, 0x5b, 0x1c, 0x75, 0xdb, 0xe5, 0x5c, 0xf3, 0x6e, 0xec, 0x71, 0xd4, 0xed, 0xc4, 0xf1, 0xe6,
+  0x5d, 0x4a, 0x67, 0xa3, 0x6e, 0xb3, 0x32, 0x6d, 0xd1, 0xf8, 0xca, 0x7f, 0x20, 0x6e, 0xbb, 0x67,
+  0x1c, 0xea, 0xff, 0xf7, 0xbf, 0x17, 0xfa, 0xda, 0xb0, 0xa0, 0x2e, 0x04, 0x5e, 0xb2, 0xb6, 0x13,
+  0xf0, 0x05, 0x15, 0x20, 0x86, 0x00, 0xc3, 0xde, 0xdb, 0xfa, 0x25, 0xfe, 0xa3, 0xc9, 0x0b, 0x16,
+  0x4e, 0x3f, 0xb6, 0x8c, 0xe3, 0x81, 0x6e, 0xb2, 0x25, 0xc6, 0x5a, 0xb1, 0x3b, 0x67, 0x4e, 0x9c,
+  0x1f, 0xef, 0x8b, 0x3e, 0x97, 0x22, 0x29, 0xe6, 0xb8, 0xbe, 0x73, 0x65, 0xdb, 0x57, 0x54, 0x2e,
+  0x3a, 0xdb, 0x89, 0xd0, 0x49, 0xbe, 0xf5, 0xad, 0x7f, 0xd7, 0x68, 0x79, 0xba, 0xd2, 0x61, 0xd3,
+  0x0d, 0x69, 0xae, 0xb2, 0x11, 0xd3, 0xbc, 0x2d, 0x5f, 0x52, 0x6c, 0x92, 0x81, 0x66, 0xcb, 0x26,
+  0xb9, 0x04, 0x36, 0xf9, 0x1e, 0x43, 0xd5, 0x62, 0x5f, 0x43, 0x18, 0xab, 0x1c, 0x53, 0x6e, 0xc9,
+  0xd8, 0xb1, 0x19, 0xeb, 0x35, 0x9d, 0x3e, 0xb6, 0x5c, 0x1f, 0x16, 0xcb, 0x99, 0xf9, 0xff, 0xf3,
+  0xf3, 0xfb, 0x77, 0x63, 0xfd, 0x62, 0xb3, 0xe3, 0xa7, 0x11, 0x58, 0x39, 0x0d, 0xfc, 0x6c, 0x4e,
+  0x5c, 0x4b, 0x63, 0x31, 0x00, 0x9d, 0x19, 0xa7, 0xd0, 0x02, 0x38, 0x92, 0x8c, 0x1a, 0x07, 0x52,
+  0x6a, 0x3e, 0x01, 0xc6, 0x4a, 0x18, 0xa1, 0xe9, 0x82, 0x20, 0x05, 0xcf, 0x94, 0x08, 0x67, 0x89,
+  0x00, 0x67, 0xf1, 0x10, 0x0d, 0x9e, 0x05, 0x14, 0x80, 0x57, 0xc4, 0x20, 0xd3, 0x35, 0xae, 0x56,
+  0x63, 0xce, 0xc1, 0xc1, 0xb3, 0x6a, 0xac, 0xe1, 0x5b, 0x78, 0xe7, 0x05, 0x76, 0x2c, 0x12, 0x60,
+  0x10, 0xb9, 0xe5, 0x3c, 0x63, 0x51, 0x19, 0x06, 0x09, 0x44, 0xa3, 0xbd, 0x99, 0xc5, 0x94, 0xad,
+  0x9e, 0x59, 0x9c, 0xf9, 0x21, 0xe0, 0x6e, 0xcf, 0xc8, 0xe3, 0xa3, 0x7e, 0x29, 0xf9, 0xd4, 0xdc,
+  0x3a, 0x45, 0x6f, 0x5b, 0xc3, 0x2e, 0x16, 0x4c, 0xb6, 0xf0, 0x8a, 0x07, 0xd0, 0x5c, 0xf4, 0x96,
+  0x5c, 0xc5, 0x98, 0xb8, 0xde, 0xcf, 0x96, 0x98, 0x8d, 0x20, 0x66, 0x0c, 0xae, 0x20, 0x4f, 0xb5,
+  0xa6, 0x8a, 0x97, 0x57, 0xf8, 0x08, 0x98, 0x39, 0xe4, 0x13, 0xc1, 0x11, 0x8e, 0x8a, 0xb1, 0x42,
+  0x51, 0x14, 0x08, 0x1a, 0xdc, 0x83, 0xa2, 0x38, 0x2b, 0xf2, 0x51, 0xb6, 0xca, 0x45, 0x6a, 0xf8,
+  0xd7, 0xd9, 0x72, 0x1d, 0xbf, 0x64, 0x5a, 0x0a, 0x7b, 0xab, 0x78, 0x6d, 0x0c, 0x36, 0xfa, 0x11,
+  0xe4, 0x2a, 0x1e, 0x88, 0xf7, 0x3b, 0x72, 0x9c, 0x2b, 0xfe, 0xb3, 0xdc, 0x74, 0xe3, 0x1f, 0xc6,
+  0x8a, 0xce, 0xa1, 0x6e, 0x65, 0xe1, 0xe1, 0x92, 0xd3, 0xcc, 0xb5, 0x41, 0xa3, 0x31, 0x77, 0xfb,
+  0x9a, 0x00, 0xa0, 0x71, 0x00, 0x6b, 0x7e, 0x94, 0x18, 0xcc, 0x1a, 0x62, 0x0e, 0x5f, 0xc4, 0xbb,
+  0x60, 0x2c, 0xb8, 0x36, 0x5b, 0xa5, 0x24, 0x43, 0x59, 0xac, 0x5a, 0xd5, 0x2f, 0xb4, 0xeb, 0x74,
+  0x24, 0x56, 0x22, 0x7a, 0x70, 0x20, 0x9f, 0x84, 0x85, 0x4c, 0xba, 0xc6, 0x2a, 0x1f, 0x02, 0x5e,
+  0x5f, 0xda, 0xa0, 0x06, 0x62, 0x20, 0xf7, 0x60, 0x1c, 0x52, 0x81, 0xbc, 0x03, 0x0e, 0x80, 0x12,
+  0x81, 0x3f, 0xe0, 0xce, 0xa6, 0x11, 0x79, 0xf6, 0x60, 0x71, 0x24, 0x05, 0x10, 0x6b, 0xb1, 0x80,
+  0xa8, 0x23, 0x66, 0x54, 0x0f, 0x2f, 0xe7, 0xc5, 0x15, 0x1b, 0xeb, 0xf0, 0x3e, 0x3e, 0xca, 0x51,
+  0x2c, 0xa1, 0xaa, 0x43, 0x7e, 0x9a, 0x51, 0x36, 0x76, 0xa8, 0x6b, 0xfa, 0xa1, 0x1c, 0x06, 0x1b,
+  0xa0, 0x95, 0x95, 0xac, 0x1c, 0x29, 0xb1, 0x12, 0x0b, 0xab, 0xc8, 0xbd, 0x80, 0x04, 0xc2, 0x6d,
+  0x73, 0x5c, 0x40, 0x61, 0x87, 0xa5, 0xf4, 0x93, 0xb9, 0x93, 0x86, 0xcc, 0x53, 0xda, 0x43, 0x10,
+  0x83, 0xc6, 0xf1, 0xf5, 0x05, 0x06, 0x92, 0x95, 0x80, 0x15, 0x97, 0x84, 0x1c, 0xd7, 0x85, 0xa7,
+  0x28, 0xed, 0x06, 0xc1, 0x95, 0x57, 0x69, 0xf6, 0x1d, 0x1c, 0x85, 0xd6, 0xa8, 0xef, 0x8f, 0xd1,
+  0x7a, 0xad, 0x18, 0xac, 0xb1, 0x3d, 0xf6, 0x71, 0x08, 0xb9, 0xa1, 0x6e, 0x42, 0xac, 0x9c, 0x93,
+  0x9f, 0xe1, 0xf9, 0x91, 0x1d, 0x04, 0xcb, 0x95, 0x9a, 0x94, 0x4a, 0x45, 0x5d, 0xaf, 0x73, 0x6d,
+  0x00, 0xdf, 0x73, 0x89, 0xf7, 0x85, 0xe8, 0x88, 0xb0, 0x6a, 0x6e, 0xeb, 0x6f, 0x3f, 0xbe, 0x17,
+  0x52, 0xe6, 0xf0, 0x74, 0x53, 0x3a, 0x05, 0x88, 0xab, 0xdc, 0xa3, 0xde, 0x88, 0x6b, 0x29, 0xb0,
+  0x92, 0x6a, 0x8e, 0x84, 0x0e, 0xee, 0x1a, 0x6f, 0xf3, 0x40, 0x8f, 0xda, 0xd5, 0xc0, 0x8c, 0x99,
+  0x59, 0x17, 0x2c, 0x6b, 0x23, 0x5e, 0x37, 0x27, 0x19, 0x3c, 0x24, 0x40, 0xe8, 0xde, 0x44, 0x14,
+  0xea, 0xba, 0x68, 0x46, 0x74, 0x13, 0xfe, 0x71, 0x03, 0xc2, 0xe3, 0xc4, 0x05, 0x1b, 0xdb, 0x02,
+  0x4f, 0x96, 0x3d, 0x7b, 0x40, 0x94, 0x9d, 0xc8, 0x9d, 0x30, 0xd5, 0xf2, 0x69, 0x0f, 0xb8, 0x6a,
+  0x77, 0x6f, 0x27, 0x6c, 0x59, 0x8a, 0xed, 0x01, 0x57, 0xf6, 0xc9, 0x76, 0xc2, 0xe4, 0x0d, 0x9c,
+  0x5a, 0x88, 0xac, 0xfe, 0xd6, 0x4d, 0x2e, 0xe6, 0xab, 0xa2, 0x13, 0xb2, 0x8d, 0xa3, 0x45, 0x53,
+  0xeb, 0xcf, 0x02, 0x59, 0xba, 0x41, 0xa9, 0xa7, 0x1c, 0x9c, 0xe5, 0x8f, 0x92, 0x66, 0xd6, 0x54,
+  0xa3, 0x0d, 0xfe, 0x40, 0x09, 0x6d, 0x68, 0x3c, 0x18, 0xfc, 0xa0, 0xc2, 0xd8, 0x0c, 0x7f, 0xaf,
+  0x8b, 0xcc, 0x04, 0x72, 0xc6, 0x19, 0x56, 0xd0, 0x63, 0x51, 0x38, 0xcb, 0x67, 0xbc, 0x7b, 0x07,
+  0x71, 0x8a, 0x57, 0xfc, 0xfe, 0x44, 0xc6, 0x31, 0xa8, 0xe1, 0xec, 0x30, 0x1b, 0x63, 0x4c, 0xfa,
+  0xf2, 0xe9, 0xdd, 0x2d, 0xb1, 0x53, 0x67, 0x7e, 0xc3, 0xc6, 0xda, 0x2c, 0x80, 0x09, 0x80, 0x06,
+  0x5f, 0x27, 0x5c, 0x1c, 0x53, 0x77, 0xce, 0x49, 0x53, 0x2e, 0x10, 0x01, 0xe0, 0xae, 0x6e, 0x35,
+  0x8e, 0x8b, 0xe5, 0xf9, 0x12, 0x5c, 0xaf, 0xa0, 0x55, 0xdd, 0x82, 0x53, 0xa0, 0xaf, 0x62, 0x97,
+  0xba, 0x70, 0xb8, 0x25, 0x00, 0x8b, 0x24, 0x8d, 0x05, 0xe0, 0xdf, 0xc0, 0x77, 0x72, 0x98, 0x34,
+  0xbe, 0xa5, 0x29, 0xfa, 0x15, 0xe3, 0x29, 0x31, 0x59, 0xf6, 0xce, 0x4a, 0x31, 0x99, 0xe5, 0xde,
+  0x0d, 0x35, 0x60, 0x5d, 0x2b, 0xc4, 0x55, 0xd2, 0xc6, 0xc7, 0xc7, 0x52, 0x63, 0x84, 0x4d, 0xe5,
+  0xaf, 0x6c, 0x52, 0x34, 0x4a, 0xd8, 0x0c, 0x7f, 0x66, 0xc3, 0x45, 0xd7, 0x84, 0xcd, 0xe4, 0xaf,
+  0x38, 0xb9, 0x1e, 0x8a, 0xf2, 0x10, 0xa7, 0x7e, 0xc2, 0x6f, 0xab, 0xd4, 0x15, 0xde, 0x9b, 0xc3,
+  0xfa, 0xd9, 0x46, 0xce, 0xba, 0x2e, 0x39, 0xcb, 0xf3, 0xe2, 0x86, 0x64, 0xac, 0x94, 0x67, 0x49,
+  0x2f, 0xaa, 0x24, 0x5a, 0x0a, 0xa7, 0xab, 0xca, 0x6e, 0x0c, 0x93, 0x38, 0x59, 0xe0, 0xc7, 0x53,
+  0x3c, 0x00, 0xe7, 0xfb, 0x4d, 0x95, 0xdd, 0xa6, 0xa2, 0xac, 0xec, 0xd1, 0x25, 0x99, 0x83, 0xed,
+  0x90, 0xba, 0xc0, 0x23, 0x11, 0xd8, 0x20, 0x65, 0xd3, 0x79, 0xb7, 0x8d, 0x3c, 0x15, 0x64, 0xf7,
+  0x59, 0x3b, 0x72, 0xaf, 0x9c, 0xb4, 0x7c, 0x13, 0xb3, 0x46, 0x75, 0x33, 0xcf, 0x69, 0x86, 0xa5,
+  0x56, 0x98, 0xa0, 0x62, 0x2c, 0xd6, 0xab, 0x26, 0xb9, 0x2a, 0xb1, 0xae, 0x08, 0x18, 0xfb, 0x31,
+  0x2f, 0xb7, 0xdb, 0x2a, 0x0f, 0x73, 0x40, 0x66, 0x59, 0x33, 0x4d, 0xd5, 0x8c, 0xf9, 0x33, 0xe7,
+  0xe4, 0x5e, 0x41, 0x2c, 0xaf, 0x05, 0xb6, 0x44, 0xfd, 0x62, 0xf9, 0x1a, 0xd0, 0x24, 0x54, 0x62,
+  0x54, 0x8e, 0x5b, 0xc3, 0xd2, 0x5c, 0x11, 0x77, 0x78, 0x1a, 0x54, 0x9a, 0x54, 0x78, 0xf2, 0x14,
+  0x80, 0x1b, 0xa1, 0x00, 0x34, 0xae, 0x9a, 0x58, 0xd4, 0xeb, 0x49, 0x39, 0x24, 0xe7, 0x9a, 0x92,
+  0xdf, 0xfa, 0xed, 0xd0, 0x15, 0x05, 0xef, 0x62, 0x23, 0x53, 0x97, 0x32, 0x84, 0x5a, 0x85, 0x91,
+  0x4b, 0xc6, 0x72, 0x53, 0xc9, 0x33, 0x97, 0x95, 0xa6, 0xc2, 0x88, 0xbd, 0x14, 0x47, 0x57, 0x9d,
+  0x78, 0x55, 0x79, 0x4a, 0x00, 0x4d, 0xc5, 0x81, 0x99, 0x15, 0x8f, 0x9e, 0xbf, 0xee, 0xd2, 0xa1,
+  0x4a, 0xd2, 0xb2, 0x8f, 0x1e, 0x95, 0xb7, 0xac, 0xf7, 0xd7, 0x97, 0xbf, 0x5c, 0x2f, 0x36, 0x53,
+  0xaa, 0x5c, 0x37, 0x4a, 0x37, 0xa1, 0x3b, 0xf4, 0xa3, 0x82, 0x27, 0x07, 0xa0, 0xc6, 0xf8, 0x4d,
+  0x60, 0xb5, 0xaa, 0xa2, 0x2e, 0x1b, 0x2b, 0xfb, 0xab, 0xb1, 0xb9, 0xac, 0x34, 0x05, 0x27, 0xf6,
+  0x56, 0x18, 0xbd, 0x12, 0xc2, 0xab, 0x6a, 0x93, 0x83, 0x34, 0xcb, 0x91, 0xcd, 0xd4, 0xa7, 0xe9,
+  0x6c, 0x29, 0x55, 0x86, 0x3d, 0xef, 0xd2, 0x17, 0x25, 0x11, 0xdd, 0x47, 0x57, 0x14, 0xb1, 0xd6,
+  0x28, 0xc4, 0xcf, 0x0a, 0xbd, 0x22, 0xee, 0x72, 0xa6, 0x0b, 0xa2, 0x2e, 0xb3, 0x5f, 0x42, 0x1f,
+  0xef, 0x43, 0x0c, 0x97, 0xdf, 0xcf, 0x61, 0x51, 0x61, 0xb3, 0xec, 0xbd, 0x33, 0x26, 0x9b, 0xc8,
+  0xd4, 0x2b, 0x9f, 0x04, 0xf0, 0x0a, 0x2c, 0x65, 0x4f, 0x52, 0x17, 0xb3, 0xed, 0xfa, 0x97, 0xdf,
+  0x00, 0x08, 0x75, 0xda, 0xda, 0x43, 0x10, 0x97, 0xe3, 0xfa, 0xa1, 0xdc, 0x65, 0xe1, 0x3d, 0xd7,
+  0x6b, 0xda, 0xee, 0x1a, 0x90, 0x98, 0x7d, 0x81, 0x74, 0x2f, 0xbd, 0xb0, 0x33, 0x60, 0x4e, 0xb1,
+  0x20, 0x83, 0xa4, 0x99, 0xb0, 0x1e, 0xac, 0x7a, 0x95, 0xae, 0x0f, 0x99, 0x6e, 0xc8, 0xf6, 0x01,
+  0xfe, 0xf6, 0xea, 0xd7, 0x7a, 0x07, 0x08, 0xe1, 0x6b, 0xce, 0x85, 0x6f, 0x75, 0xed, 0x03, 0xb6,
+  0x24, 0x67, 0xcf, 0x37, 0x49, 0x6f, 0x6d, 0xa1, 0x5f, 0xb0, 0x5d, 0x55, 0xa1, 0xea, 0xfd, 0xca,
+  0xdf, 0x94, 0xb5, 0xe2, 0xb4, 0x72, 0xc7, 0x2e, 0x27, 0xa8, 0x46, 0xeb, 0xf2, 0xb6, 0x33, 0x96,
+  0x68, 0xe3, 0xdd, 0x25, 0x1c, 0x57, 0x5f, 0xbe, 0x49, 0x6a, 0xf5, 0x67, 0xe0, 0xf4, 0x5e, 0xba,
+  0x2f, 0xcd, 0x86, 0x7f, 0x25, 0x97, 0x7d, 0xed, 0x7e, 0xfb, 0x8d, 0x89, 0xe9, 0xf1, 0x51, 0xd7,
+  0x87, 0x9b, 0xee, 0x73, 0x3b, 0xdc, 0x4a, 0x40, 0xd9, 0x03, 0xb6, 0x8c, 0xa8, 0xdb, 0xe1, 0x2a,
+  0xc9, 0xce, 0x1e, 0x30, 0x79, 0x5a, 0xb7, 0x1d, 0x62, 0xde, 0x53, 0xd8, 0x07, 0x47, 0x56, 0xdd,
+  0x32, 0xe7, 0xbf, 0x67, 0x05, 0xac, 0x4a, 0x44, 0x54, 0x01, 0x50, 0xf8, 0xd1, 0x6c, 0xfc, 0x95,
+  0x0b, 0xcd, 0x54, 0xc5, 0x84, 0xf7, 0x60, 0x30, 0xf7, 0xdf, 0x3e, 0x9d, 0xb7, 0x75, 0xae, 0x77,
+  0xba, 0xf1, 0x9b, 0xae, 0x0f, 0xd4, 0x45, 0x66, 0x55, 0x08, 0x8d, 0xbb, 0xaa, 0x0b, 0x4d, 0x95,
+  0xc5, 0x8d, 0xbb, 0xd4, 0x45, 0x66, 0xc1, 0xc0, 0xc6, 0xf5, 0xc5, 0x12, 0x53, 0x57, 0x3e, 0xa5,
+  0x83, 0xfc, 0x25, 0x67, 0xd6, 0x37, 0xcb, 0xf3, 0x03, 0x0a, 0x95, 0x3a, 0x94, 0x8a, 0x74, 0x3c,
+  0xc1, 0xbf, 0x0f, 0x0e, 0xf0, 0x6f, 0xfc, 0x55, 0x59, 0xd8, 0x36, 0x9e, 0x8d, 0xb1, 0x5e, 0xde,
+  0x72, 0x9f, 0x55, 0xd8, 0x84, 0x64, 0xe9, 0x58, 0x65, 0xa6, 0xf5, 0x47, 0xec, 0x47, 0x6d, 0xdd,
+  0xd4, 0xf4, 0x6d, 0x7e, 0xba, 0x3a, 0x93, 0x17, 0x16, 0xfc, 0x83, 0x01, 0xe6, 0x7c, 0x40, 0x2e,
+  0xba, 0xf2, 0x99, 0x2a, 0xaf, 0x65, 0x58, 0xb1, 0xa3, 0x64, 0xec, 0x95, 0xfc, 0x4b, 0x89, 0xab,
+  0xd2, 0x12, 0xcd, 0x92, 0x16, 0x98, 0x3a, 0xeb, 0x62, 0xe2, 0xa8, 0xf8, 0x4c, 0x41, 0xff, 0x26,
+  0x54, 0x02, 0x3f, 0xee, 0xce, 0x8f, 0x2e, 0x63, 0x22, 0x79, 0xe6, 0xe1, 0xdb, 0xb5, 0x9b, 0x7b,
+  0x61, 0xf6, 0xde, 0xa8, 0x7e, 0x62, 0xb5, 0x2c, 0x2e, 0xf9, 0xea, 0x83, 0x03, 0xf6, 0x0f, 0xe7,
+  0x9c, 0xca, 0xf3, 0xb5, 0x92, 0xfa, 0x32, 0xae, 0x8c, 0xdb, 0x2a, 0x46, 0xa2, 0x1b, 0x7a, 0x54,
+  0x41, 0x4c, 0x5c, 0xc8, 0xfc, 0xa3, 0x87, 0xbf, 0xaa, 0xd8, 0x62, 0xa8, 0xf9, 0xc7, 0xea, 0x68,
+  0x5c, 0xf8, 0x21, 0xb3, 0xc5, 0xff, 0x1f, 0x06, 0x72, 0xea, 0x50, 0x7f, 0xa1, 0x0f, 0x6b, 0x6f,
+  0x65, 0x2a, 0x32, 0x2b, 0xcf, 0xae, 0x9e, 0x74, 0x3f, 0xf6, 0x37, 0x10, 0x36, 0xe4, 0x45, 0xfc,
+  0xdc, 0x2b, 0xc6, 0xe3, 0xaa, 0xbc, 0xc9, 0x1d, 0x49, 0x97, 0x7f, 0xb5, 0xb8, 0x6b, 0xee, 0x8d,
+  0x94, 0x76, 0xc1, 0xe3, 0xe3, 0xb3, 0x0a, 0x92, 0x85, 0x28, 0xf8, 0x07, 0xfb, 0x9f, 0xfd, 0x10,
+  0x32, 0xba, 0xac, 0x4d, 0x79, 0xa7, 0x81, 0x8a, 0x06, 0x03, 0x78, 0x48, 0xf1, 0x30, 0x9a, 0xa6,
+  0x93, 0x51, 0x16, 0x02, 0x98, 0xc9, 0x05, 0xbf, 0xed, 0x82, 0xd0, 0x49, 0x2d, 0x71, 0xf3, 0xf5,
+  0x3d, 0x04, 0xa9, 0x6b, 0x61, 0x66, 0x42, 0xfe, 0x3a, 0xf3, 0x23, 0x36, 0x65, 0x2f, 0xe8, 0xbc,
+  0x18, 0x47, 0x11, 0x64, 0xa0, 0xf7, 0x7c, 0x17, 0xcb, 0x30, 0xe4, 0xa4, 0x7e, 0xd8, 0xc6, 0xdb,
+  0xc4, 0x45, 0x46, 0xdc, 0xef, 0xc5, 0x4d, 0xda, 0x6f, 0xba, 0xd6, 0x8e, 0x23, 0xa2, 0xdc, 0xad,
+  0x19, 0xfa, 0x00, 0xdc, 0xc9, 0xa1, 0x3e, 0x3a, 0xe2, 0x78, 0xe8, 0xdb, 0x1a, 0xdc, 0xa5, 0x86,
+  0xa4, 0x74, 0x0e, 0xdb, 0xda, 0xa5, 0xc5, 0x45, 0x6d, 0x0d, 0x34, 0xce, 0x5e, 0xdd, 0x2c, 0xd7,
+  0x25, 0x6d, 0x48, 0xee, 0x09, 0x94, 0x8c, 0xec, 0xb7, 0x38, 0x6f, 0x89, 0x67, 0x2f, 0x02, 0xca,
+  0x1b, 0x7f, 0x6a, 0xab, 0x66, 0x65, 0x07, 0x24, 0x85, 0x3c, 0x4a, 0xf9, 0x45, 0x05, 0xbb, 0x5b,
+  0xad, 0xb9, 0x3d, 0xc4, 0xbe, 0xd9, 0x94, 0x94, 0x2e, 0x63, 0x75, 0xa9, 0x03, 0xeb, 0xe2, 0x13,
+  0x13, 0xd6, 0x1d, 0xc3, 0xa6, 0xdb, 0x95, 0x78, 0x69, 0x83, 0x3a, 0xd8, 0x29, 0x90, 0xf4, 0xc4,
+  0x4b, 0xe6, 0xbd, 0x6f, 0xc1, 0xe5, 0x1d, 0xfb, 0x50, 0xa2, 0xa1, 0xf6, 0x34, 0x81, 0x00, 0x61,
+  0x2b, 0x75, 0x4d, 0x98, 0x9a, 0x3d, 0xd2, 0x1a, 0x6b, 0x77, 0xc9, 0xc9, 0x9a, 0x7d, 0xaa, 0xe9,
+  0xd6, 0xee, 0x55, 0x17, 0xd4, 0xec, 0x97, 0xb6, 0x5e, 0xbb, 0x57, 0x4e, 0x4a, 0xae, 0xb0, 0xda,
+  0xec, 0xe3, 0xf4, 0x0f, 0xcc, 0xf0, 0xbc, 0x34, 0x0e, 0x2f, 0x23, 0xb0, 0x3c, 0xc2, 0x2e, 0x4c,
+  0x39, 0x54, 0x22, 0x06, 0x0c, 0xa3, 0xe9, 0xf6, 0x56, 0x19, 0x57, 0x2e, 0xa2, 0xa7, 0x34, 0xd2,
+  0x94, 0x5f, 0xfc, 0xe9, 0xca, 0x2a, 0x35, 0x8b, 0x86, 0xa0, 0x4c, 0x29, 0x36, 0x1b, 0x17, 0x89,
+  0xb8, 0x38, 0xc4, 0x3b, 0x66, 0xe5, 0xb2, 0x9a, 0xbb, 0x60, 0x71, 0x47, 0x37, 0xd6, 0xf1, 0x57,
+  0x58, 0xfa, 0xae, 0xbb, 0x56, 0xa6, 0xed, 0xba, 0xb9, 0x0a, 0x09, 0x9d, 0xc7, 0xee, 0x40, 0xbf,
+  0xf9, 0x78, 0xfb, 0x59, 0x37, 0xf9, 0x8f, 0xa7, 0xb2, 0xc1, 0x4a, 0x17, 0x87, 0x77, 0x3e, 0x2f,
+  0x13, 0x02, 0x56, 0x87, 0xff, 0xeb, 0x18, 0x9f, 0x7f, 0xe3, 0x7f, 0x84, 0x8d, 0x5a, 0x7d, 0x6d,
+  0xe2, 0x0f, 0xb2, 0x06, 0xff, 0xba, 0xfd, 0xf8, 0x01, 0xce, 0xc7, 0xf6, 0xb0, 0xef, 0x2d, 0xd9,
+  0x5d, 0xb9, 0xb1, 0x56, 0x7a, 0xcc, 0x60, 0x0f, 0x0d, 0x7d, 0xde, 0x46, 0xf4, 0xd9, 0x2f, 0x70,
+  0x75, 0xde, 0xa9, 0xcb, 0x1b, 0xcd, 0x07, 0x07, 0x1c, 0x98, 0xfc, 0x79, 0xdf, 0xd6, 0xef, 0x20,
+  0x34, 0xb1, 0xa8, 0xe1, 0xeb, 0x07, 0xf6, 0xfd, 0x1e, 0xd8, 0x1c, 0xff, 0x9c, 0xcf, 0x95, 0xab,
+  0x31, 0x17, 0x59, 0x3e, 0x93, 0xff, 0x03, 0x1f, 0xf6, 0xa9, 0x67, 0x4a, 0x58, 0x6e, 0xa4, 0x41,
+  0x35, 0x0a, 0x56, 0x89, 0x6e, 0x2d, 0x8c, 0x23, 0x9f, 0xc6, 0x48, 0xae, 0xa5, 0x1f, 0x96, 0x1d,
+  0xa7, 0x40, 0x90, 0xf2, 0x57, 0x76, 0x43, 0x26, 0xbf, 0x58, 0x6a, 0x1b, 0xe0, 0xf5, 0xef, 0xfd,
+  0xc8, 0x8d, 0xef, 0xad, 0x40, 0xfc, 0x54, 0xc2, 0x62, 0x3f, 0x07, 0xd2, 0x8f, 0xc4, 0x19, 0xc0,
+  0xd0, 0x13, 0xbc, 0x35, 0xdb, 0xf9, 0xdd, 0x82, 0xb6, 0xe5, 0x5b, 0x05, 0x41, 0x9a, 0xc7, 0x5a,
+  0xf0, 0x03, 0x70, 0xb4, 0x12, 0xa9, 0xe2, 0xf3, 0x85, 0x2f, 0xd1, 0x8f, 0x28, 0xbe, 0x8f, 0x04,
+  0x14, 0x63, 0x17, 0x0d, 0x9b, 0xea, 0x5c, 0xfd, 0x4a, 0xa1, 0xac, 0xcf, 0x8d, 0x3a, 0x5c, 0xfe,
+  0x7a, 0x52, 0xaf, 0xdc, 0x8d, 0xee, 0x52, 0x86, 0xa7, 0xf2, 0xe3, 0x03, 0xa1, 0x10, 0xa8, 0x7f,
+  0xf0, 0x35, 0xc8, 0x10, 0xf6, 0x20, 0xd9, 0xf1, 0x57, 0x92, 0x67, 0x0c, 0x21, 0x48, 0xf1, 0x0f,
+  0x3c, 0x47, 0x47, 0xfc, 0xb7, 0x8b, 0x47, 0xec, 0x7f, 0x20, 0xf5, 0xff, 0x61, 0xbd, 0x7b, 0xb6,
+  0x56, 0x4a, 0x00, 0x00,
+};
+
+// web/live.html: 3814 bytes, 2688 minified, 1421 gzipped
+#define LIVE_PAGE_ETAG "\"50c87c34\""
+const size_t LIVE_PAGE_GZ_LEN = 1421;
+const uint8_t LIVE_PAGE_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x56, 0xfb, 0x6f, 0xdb, 0x36,
+  0x10, 0xfe, 0x57, 0x58, 0x07, 0x05, 0xa5, 0x46, 0x92, 0x25, 0x3b, 0x4e, 0x32, 0xcb, 0xd2, 0x86,
+  0xa4, 0x09, 0xd6, 0xa1, 0x2f, 0xd4, 0xe9, 0x8a, 0xc1, 0xf0, 0x0f, 0xb4, 0x44, 0x59, 0x4c, 0x24,
+  0xd1, 0x23, 0xe9, 0xd7, 0x0c, 0xff, 0xef, 0x3b, 0x92, 0x7e, 0xae, 0xe8, 0x80, 0x0d, 0x01, 0x1c,
+  0xdd, 0xf1, 0x74, 0x8f, 0xef, 0xbb, 0x3b, 0x6a, 0xf0, 0xea, 0xed, 0xa7, 0xfb, 0xa7, 0x3f, 0x3e,
+  0x3f, 0xa0, 0x52, 0xd5, 0x55, 0x3a, 0xd8, 0xfd, 0x52, 0x92, 0xa7, 0x03, 0xc5, 0x54, 0x45, 0xd3,
+  0x61, 0x4d, 0x84, 0x42, 0x0f, 0x59, 0xc9, 0xd1, 0x5b, 0x41, 0x58, 0x83, 0x7c, 0xf4, 0x9e, 0x2d,
+  0x28, 0x1a, 0xd2, 0x46, 0x72, 0x21, 0x07, 0x6d, 0x6b, 0x36, 0xa8, 0xa9, 0x22, 0xa8, 0x21, 0x35,
+  0x4d, 0x5a, 0x0b, 0x46, 0x97, 0x33, 0x2e, 0x54, 0x0b, 0x65, 0xbc, 0x51, 0xb4, 0x51, 0x49, 0x6b,
+  0xc9, 0x72, 0x55, 0x26, 0x39, 0x5d, 0xb0, 0x8c, 0xfa, 0x46, 0xf0, 0x10, 0x6b, 0x98, 0x62, 0xa4,
+  0xf2, 0x65, 0x46, 0x2a, 0x9a, 0x44, 0xad, 0x74, 0x20, 0xd5, 0x1a, 0x5c, 0xbd, 0xd9, 0x40, 0xc8,
+  0x29, 0x6b, 0xfa, 0x61, 0x3c, 0x23, 0x79, 0xce, 0x9a, 0x29, 0x3c, 0x4d, 0xf8, 0xca, 0x97, 0xec,
+  0x2f, 0x2d, 0x4c, 0xb8, 0xc8, 0xa9, 0xf0, 0x41, 0xb3, 0x9d, 0xf0, 0x7c, 0xbd, 0x29, 0x20, 0x88,
+  0x5f, 0x90, 0x9a, 0x55, 0xeb, 0xbe, 0x4f, 0x66, 0xb3, 0x8a, 0xfa, 0x72, 0x2d, 0x15, 0xad, 0xbd,
+  0xbb, 0x8a, 0x35, 0x2f, 0x1f, 0x48, 0x36, 0x34, 0xe2, 0x23, 0xd8, 0x79, 0x78, 0x48, 0xa7, 0x9c,
+  0xa2, 0xaf, 0xef, 0xb0, 0xf7, 0x85, 0x4f, 0xb8, 0xe2, 0x9e, 0x24, 0x8d, 0xf4, 0x25, 0x15, 0xac,
+  0x88, 0x27, 0x24, 0x7b, 0x99, 0x0a, 0x3e, 0x6f, 0xf2, 0xfe, 0x45, 0x71, 0x55, 0xf4, 0x8a, 0x49,
+  0x9c, 0xf1, 0x8a, 0x8b, 0xfe, 0x45, 0xb7, 0xdb, 0x3d, 0x24, 0x13, 0x09, 0x5a, 0x6f, 0x03, 0x8d,
+  0x11, 0x15, 0x9b, 0x93, 0x57, 0x20, 0x18, 0x25, 0xc2, 0x9f, 0x0a, 0x92, 0x33, 0x28, 0xda, 0x89,
+  0xba, 0xbd, 0x9c, 0x4e, 0xbd, 0x8b, 0xeb, 0xeb, 0x1b, 0x4a, 0x09, 0x0a, 0x5f, 0x7b, 0x17, 0x37,
+  0xd7, 0x57, 0x13, 0xd2, 0x41, 0x51, 0x18, 0xbe, 0x76, 0xf7, 0xae, 0x8b, 0xa2, 0x38, 0x73, 0x8d,
+  0xa2, 0xa0, 0x07, 0xff, 0xe2, 0x5d, 0x99, 0xda, 0xdb, 0x5c, 0xf6, 0xa3, 0xce, 0x6c, 0x15, 0x5b,
+  0x5c, 0xa0, 0x72, 0xa5, 0x78, 0x6d, 0x8c, 0xe3, 0x9c, 0xc9, 0x59, 0x45, 0xd6, 0xfd, 0xa2, 0xa2,
+  0xab, 0xf8, 0x79, 0x2e, 0x15, 0x2b, 0xd6, 0xfe, 0x0e, 0xf6, 0xbe, 0x9c, 0x11, 0x80, 0x7b, 0x42,
+  0xd5, 0x92, 0xd2, 0x26, 0x26, 0x15, 0x9b, 0x36, 0x3e, 0x03, 0x24, 0x64, 0x3f, 0x83, 0x63, 0x2a,
+  0x62, 0xfd, 0x96, 0xbf, 0x14, 0x64, 0xd6, 0xd7, 0x3f, 0xf1, 0x14, 0x1e, 0x42, 0x13, 0x7d, 0x5f,
+  0x1f, 0x2a, 0x23, 0x8b, 0x2f, 0x60, 0x4f, 0xfb, 0x51, 0xd0, 0x3d, 0x3d, 0x23, 0x9b, 0x93, 0x12,
+  0x8e, 0x56, 0x61, 0xf0, 0x93, 0xb6, 0xba, 0x90, 0x8a, 0x28, 0xba, 0x39, 0xd5, 0xdf, 0x9a, 0xc2,
+  0x38, 0x64, 0xc5, 0xd4, 0x5a, 0xdb, 0x6d, 0x83, 0xa9, 0x60, 0xf9, 0x66, 0x5f, 0x84, 0x16, 0x4c,
+  0x12, 0xa6, 0x34, 0x2d, 0xf9, 0x90, 0x2d, 0x1c, 0x29, 0x0a, 0x35, 0x55, 0xf3, 0xba, 0x01, 0x20,
+  0x0a, 0xb1, 0xfd, 0xa5, 0xa6, 0x39, 0x23, 0x4e, 0x0d, 0x58, 0x98, 0x5e, 0xea, 0xdf, 0x5c, 0xdf,
+  0xce, 0x56, 0xee, 0xc6, 0x7a, 0xfb, 0xe1, 0x7b, 0x48, 0xbf, 0xbb, 0x0d, 0x32, 0x22, 0xf2, 0xcd,
+  0x19, 0xd5, 0x90, 0xfe, 0x3f, 0xd0, 0x0e, 0x01, 0xed, 0x53, 0x52, 0x6c, 0xff, 0x95, 0x24, 0xe7,
+  0xcb, 0x7e, 0x88, 0x80, 0x0b, 0xa4, 0x4d, 0x90, 0x98, 0x4e, 0x88, 0x13, 0x7a, 0xe6, 0x2f, 0x08,
+  0x6f, 0x5d, 0xeb, 0x1c, 0x95, 0xdd, 0xb3, 0xb2, 0x7f, 0x32, 0x65, 0xef, 0xb0, 0xea, 0xf5, 0x7a,
+  0xff, 0x81, 0xb4, 0x83, 0x43, 0x04, 0xea, 0x66, 0x8f, 0xb7, 0xed, 0x28, 0x0b, 0xf9, 0x92, 0xb2,
+  0x69, 0xa9, 0xfa, 0x37, 0x61, 0xb8, 0xcd, 0x48, 0xb3, 0x20, 0x72, 0x63, 0x21, 0xd1, 0x3d, 0x16,
+  0x97, 0xf6, 0x30, 0xea, 0x84, 0xc7, 0xee, 0x51, 0xfc, 0x40, 0xf2, 0xa0, 0x6d, 0x27, 0x6e, 0xd0,
+  0xb6, 0x13, 0xaf, 0xc7, 0x29, 0x1d, 0xe4, 0x6c, 0x81, 0xb2, 0x8a, 0x48, 0x99, 0xb4, 0x2c, 0xd1,
+  0x30, 0x99, 0x65, 0x94, 0x9e, 0x4f, 0x3d, 0x28, 0x06, 0x3a, 0x25, 0xc4, 0xf2, 0xa4, 0x65, 0x98,
+  0x6e, 0xa5, 0xf7, 0xbc, 0x69, 0x68, 0xa6, 0x00, 0xb3, 0x20, 0x08, 0xc0, 0x37, 0x1c, 0xa7, 0x03,
+  0x82, 0x4a, 0x41, 0x8b, 0xa4, 0xd5, 0x6e, 0xa5, 0x77, 0x80, 0x39, 0x52, 0x1c, 0x49, 0xaa, 0xe6,
+  0xb3, 0x41, 0x9b, 0x40, 0x5c, 0x88, 0x75, 0x16, 0x50, 0x73, 0xd7, 0x32, 0x3e, 0xcd, 0xd3, 0xde,
+  0x42, 0x66, 0x82, 0xcd, 0x54, 0x0a, 0x10, 0x49, 0x85, 0x0a, 0x46, 0xab, 0x5c, 0x26, 0xa3, 0x11,
+  0x7e, 0xfa, 0xf4, 0x88, 0x3d, 0x5c, 0xd7, 0xd8, 0x8b, 0xc6, 0xde, 0x08, 0x3f, 0x72, 0x91, 0x51,
+  0x14, 0x82, 0xea, 0x23, 0xf6, 0x3a, 0x47, 0x4d, 0x64, 0x35, 0x5d, 0xad, 0xf9, 0x66, 0x10, 0x01,
+  0xc5, 0xcb, 0x14, 0x7b, 0x57, 0x5a, 0xf3, 0x34, 0x17, 0x13, 0x96, 0x43, 0x43, 0x6a, 0xab, 0xa7,
+  0xaf, 0xd8, 0xeb, 0x69, 0xed, 0xd7, 0x4a, 0x09, 0x22, 0x79, 0xc3, 0x32, 0x50, 0x67, 0x10, 0xe1,
+  0x5a, 0x6b, 0xef, 0x88, 0x82, 0xb1, 0xd1, 0x96, 0xbf, 0x63, 0xef, 0x46, 0x6b, 0x86, 0xbc, 0x22,
+  0x02, 0xe4, 0x6f, 0xd8, 0xbb, 0x1d, 0x8f, 0x63, 0x9b, 0xe1, 0x0b, 0xa5, 0xb3, 0xa4, 0x1b, 0x86,
+  0x3b, 0x51, 0x2f, 0x17, 0x2a, 0x13, 0x9b, 0x77, 0x50, 0x93, 0x99, 0xe3, 0xb8, 0x49, 0x3a, 0x1a,
+  0xbb, 0xbb, 0x73, 0x5d, 0x6a, 0x92, 0xf3, 0x6c, 0x5e, 0x03, 0xff, 0xc1, 0x94, 0xaa, 0x87, 0x8a,
+  0xea, 0xc7, 0xbb, 0xf5, 0xbb, 0xdc, 0xc1, 0xfa, 0x14, 0xef, 0x4d, 0x75, 0x37, 0x9c, 0x79, 0x2a,
+  0x92, 0x74, 0xb3, 0x3b, 0x3a, 0xba, 0xc8, 0x04, 0x05, 0x42, 0x76, 0x5e, 0x1c, 0x0c, 0x10, 0x6a,
+  0x07, 0x81, 0xc1, 0xf8, 0xa3, 0x5e, 0xd1, 0x58, 0xfb, 0xc1, 0xa0, 0x62, 0xc0, 0x98, 0xf8, 0xf5,
+  0xe9, 0xc3, 0xfb, 0x04, 0x0f, 0xca, 0x6e, 0x8a, 0x2f, 0x8b, 0x51, 0x38, 0xbe, 0xc4, 0x86, 0xda,
+  0xd4, 0xdf, 0x73, 0xd8, 0x86, 0xa3, 0x81, 0xed, 0x2e, 0x64, 0x37, 0x79, 0xeb, 0x3a, 0x0c, 0x5b,
+  0xc8, 0xb6, 0x57, 0xd2, 0x82, 0xfe, 0xd2, 0x54, 0x59, 0x8b, 0x14, 0x9b, 0xc9, 0x0d, 0x60, 0x13,
+  0xd3, 0x26, 0xbf, 0x2f, 0x59, 0x95, 0x3b, 0x99, 0x1b, 0x0b, 0x20, 0x5d, 0x34, 0x9b, 0x05, 0xa9,
+  0xe6, 0xb4, 0x9f, 0x05, 0x7f, 0xce, 0x01, 0xc7, 0x21, 0xad, 0xa0, 0x5f, 0xb8, 0x70, 0xb0, 0x8e,
+  0x83, 0x5d, 0xcf, 0x7a, 0xf8, 0xfe, 0xd8, 0xea, 0xb1, 0xbb, 0xdd, 0xba, 0x71, 0x45, 0x15, 0xca,
+  0x99, 0x50, 0xeb, 0xa4, 0x20, 0x95, 0xa4, 0x71, 0x31, 0x6f, 0xa0, 0xe7, 0x78, 0x83, 0x72, 0x41,
+  0x96, 0x8e, 0xbb, 0x61, 0x85, 0xf3, 0xca, 0x9c, 0xbb, 0x36, 0x64, 0x7c, 0x66, 0x6c, 0x91, 0x2b,
+  0xb8, 0x78, 0x20, 0x59, 0xe9, 0x38, 0x85, 0xc7, 0xdc, 0x03, 0x82, 0x39, 0x51, 0x24, 0xb1, 0x64,
+  0x8d, 0xd8, 0x9e, 0xcb, 0x4c, 0xad, 0x12, 0x83, 0x3a, 0xa8, 0x02, 0x9b, 0x87, 0xa6, 0xe8, 0x5e,
+  0x4f, 0xeb, 0x0a, 0xc0, 0xed, 0x1c, 0xc9, 0x59, 0x7e, 0x67, 0x68, 0x6f, 0xba, 0xf2, 0x3b, 0xbd,
+  0x05, 0x2e, 0x06, 0xdf, 0x40, 0x0a, 0x5c, 0x1a, 0x5f, 0xa0, 0x4e, 0xb3, 0x47, 0x96, 0x5e, 0xe9,
+  0xc6, 0xa6, 0x02, 0xc8, 0x25, 0xa8, 0x68, 0x33, 0x55, 0xe5, 0xbe, 0x0e, 0x5d, 0x78, 0xc5, 0x93,
+  0x0f, 0x44, 0x95, 0x01, 0xac, 0x3e, 0x07, 0x86, 0x4c, 0x5b, 0xb9, 0x5e, 0xc9, 0x76, 0x4a, 0xb2,
+  0x3a, 0x28, 0xb5, 0x13, 0xd0, 0x27, 0x49, 0xc5, 0xdd, 0x4d, 0xc9, 0x2e, 0x93, 0x28, 0xae, 0xb8,
+  0x9f, 0x44, 0x5b, 0x1d, 0x53, 0x2a, 0xc1, 0x5f, 0xe8, 0x50, 0xcf, 0x7e, 0x82, 0x77, 0xdb, 0x04,
+  0x9b, 0x6c, 0xf4, 0x1d, 0xf6, 0xcd, 0x30, 0xdc, 0x31, 0xf2, 0x84, 0xc2, 0xca, 0xf8, 0x0c, 0xce,
+  0x1d, 0x37, 0x36, 0x29, 0x1d, 0x90, 0x5b, 0x78, 0xcf, 0x47, 0xe4, 0x56, 0xc9, 0xf3, 0x9b, 0x65,
+  0xdb, 0xd1, 0x7d, 0xef, 0x47, 0xae, 0xb7, 0x4e, 0x4a, 0xff, 0xca, 0x77, 0x16, 0x3e, 0x04, 0x7f,
+  0xe3, 0x94, 0xfe, 0xad, 0xdb, 0x86, 0x64, 0xb4, 0x14, 0x3f, 0xff, 0xbc, 0x0f, 0xf3, 0xc4, 0x9d,
+  0x95, 0xb7, 0x76, 0xfb, 0x5a, 0xae, 0xf9, 0x62, 0x2f, 0x03, 0xc3, 0xc7, 0x14, 0x21, 0xea, 0x01,
+  0x3a, 0xd3, 0x39, 0x81, 0x06, 0xfd, 0x7e, 0xf7, 0x55, 0xa1, 0x13, 0x1a, 0x9d, 0x00, 0xe5, 0x47,
+  0xe3, 0x40, 0xf1, 0x47, 0xb6, 0xa2, 0xb9, 0xd3, 0x71, 0x2f, 0x31, 0xd2, 0xed, 0x1c, 0x8d, 0xb7,
+  0xee, 0x16, 0x36, 0xce, 0x3b, 0x7d, 0xe1, 0x81, 0x0f, 0x47, 0xb7, 0x89, 0xd7, 0xe9, 0x85, 0x7b,
+  0xd6, 0x24, 0x9f, 0xc3, 0x92, 0x48, 0x1a, 0xba, 0x44, 0x0f, 0x0b, 0x70, 0x3b, 0x34, 0xb2, 0x83,
+  0xdb, 0x54, 0x4b, 0xd0, 0x74, 0xb1, 0xb5, 0x08, 0x78, 0xc3, 0xa1, 0xa3, 0x13, 0x3d, 0xbb, 0x9b,
+  0x1f, 0x4e, 0xab, 0x59, 0x85, 0xd8, 0x3d, 0xcb, 0x13, 0x0f, 0x15, 0x0c, 0x24, 0x50, 0x36, 0xc5,
+  0xdb, 0xa3, 0x33, 0x2a, 0x04, 0x17, 0xff, 0xc7, 0x1b, 0x34, 0xcb, 0xe9, 0xa2, 0x3d, 0xfa, 0x84,
+  0xfb, 0xca, 0x54, 0xf0, 0x9e, 0xc1, 0xe7, 0x0e, 0xf8, 0x87, 0xf7, 0x09, 0xdc, 0x82, 0x14, 0x7b,
+  0xf4, 0xc0, 0x94, 0x4c, 0x7e, 0x1b, 0x7e, 0xfa, 0x18, 0xcc, 0x88, 0x90, 0xd4, 0xa1, 0xbb, 0x5e,
+  0xf9, 0xf7, 0xa9, 0x38, 0x19, 0x89, 0x3c, 0x98, 0xcd, 0x65, 0xe9, 0xc8, 0x51, 0x31, 0xea, 0x8c,
+  0xc7, 0xa6, 0xc9, 0xf2, 0x1d, 0xf8, 0xa9, 0x26, 0xdf, 0xcd, 0x03, 0x59, 0xb2, 0x42, 0x39, 0x9a,
+  0x46, 0x3b, 0x77, 0x4a, 0xcc, 0x29, 0x08, 0xb0, 0x4a, 0xec, 0x0e, 0x1f, 0xb4, 0xed, 0x2d, 0xd3,
+  0x36, 0x9f, 0x9a, 0x7f, 0x03, 0x34, 0x7c, 0xc8, 0x50, 0x80, 0x0a, 0x00, 0x00,
+};
@@ -0,0 +1,250 @@
+#include "address_cache.h"
+#include "../Utils/crc32.h"
+#include <LittleFS.h>
+
+#define ADDRESS_CACHE_MAGIC 0x50534743 // "PSGC"
+
+struct AddressCacheHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t keyLength;
+  uint32_t storedAt;
+  uint32_t bodyLength;
+  uint32_t crc;  // CRC-32 over key and body
+};
+
+AddressCache addressCache;
+
+// Days since 1970-01-01 for a proleptic Gregorian date
+static int32_t daysFromCivil(int year, unsigned month, unsigned day) {
+  year -= month <= 2;
+  int32_t era = (year >= 0 ? year : year - 399) / 400;
+  unsigned yoe = (unsigned)(year - era * 400);
+  unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int32_t)doe - 719468;
+}
+
+AddressCache::AddressCache()
+  : useCounter(0), mounted(false), epochBase(0),
+    ramHits(0), fileHits(0), misses(0), expired(0), stores(0) {
+}
+
+bool AddressCache::begin() {
+  if (mounted) {
+    return true;
+  }
+  if (!LittleFS.begin(true)) {
+    Serial.println("✗ Failed to mount LittleFS, address cache is RAM only");
+    return false;
+  }
+  if (!LittleFS.exists(ADDRESS_CACHE_DIR)) {
+    LittleFS.mkdir(ADDRESS_CACHE_DIR);
+  }
+  mounted = true;
+  return true;
+}
+
+String AddressCache::makeKey(const String& regCode, const String& provCode, const String& cityMunCode) {
+  return regCode + "|" + provCode + "|" + cityMunCode;
+}
+
+String AddressCache::pathFor(const String& key) const {
+  char path[32];
+  uint32_t hash = crc32Update(0, (const uint8_t*)key.c_str(), key.length());
+  snprintf(path, sizeof(path), ADDRESS_CACHE_DIR "/%08lx.bin", (unsigned long)hash);
+  return String(path);
+}
+
+void AddressCache::noteServerDate(const String& httpDate) {
+  // RFC 7231 IMF-fixdate: "Tue, 15 Nov 1994 08:12:31 GMT"
+  static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  char monthName[4] = {0};
+  int day, year, hour, minute, second;
+  if (sscanf(httpDate.c_str(), "%*3s, %d %3s %d %d:%d:%d", &day, monthName, &year, &hour, &minute, &second) != 6) {
+    return;
+  }
+  const char* found = strstr(months, monthName);
+  if (!found || year < 2024) {
+    return;
+  }
+  unsigned month = (found - months) / 3 + 1;
+  uint32_t epoch = (uint32_t)daysFromCivil(year, month, day) * 86400UL + hour * 3600UL + minute * 60UL + second;
+  epochBase = epoch - millis() / 1000;
+}
+
+uint32_t AddressCache::now() const {
+  return epochBase ? epochBase + millis() / 1000 : 0;
+}
+
+bool AddressCache::isFresh(uint32_t storedAt) const {
+  // Without a server clock on either side the age is unknown; trust the entry
+  if (storedAt == 0 || now() == 0) {
+    return true;
+  }
+  return now() - storedAt <= ADDRESS_CACHE_TTL_S;
+}
+
+void AddressCache::putRam(const String& key, const String& body, uint32_t storedAt) {
+  if (body.length() > ADDRESS_CACHE_RAM_MAX_BYTES) {
+    return;
+  }
+
+  for (RamEntry& entry : ram) {
+    if (entry.key == key) {
+      entry.body = body;
+      entry.storedAt = storedAt;
+      entry.lastUsed = ++useCounter;
+      return;
+    }
+  }
+
+  if (ram.size() >= ADDRESS_CACHE_RAM_ENTRIES) {
+    size_t oldest = 0;
+    for (size_t i = 1; i < ram.size(); i++) {
+      if (ram[i].lastUsed < ram[oldest].lastUsed) {
+        oldest = i;
+      }
+    }
+    ram.erase(ram.begin() + oldest);
+  }
+  ram.push_back({key, body, storedAt, ++useCounter});
+}
+
+bool AddressCache::readFile(const String& key, String& body, uint32_t& storedAt) {
+  if (!begin()) {
+    return false;
+  }
+
+  String path = pathFor(key);
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    return false;
+  }
+
+  AddressCacheHeader header;
+  bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+               header.magic == ADDRESS_CACHE_MAGIC && header.version == ADDRESS_CACHE_VERSION &&
+               header.keyLength == key.length() &&
+               file.size() == sizeof(header) + header.keyLength + header.bodyLength;
+
+  if (valid) {
+    size_t length = header.keyLength + header.bodyLength;
+    std::vector<uint8_t> data(length + 1, 0);
+    valid = file.read(data.data(), length) == length &&
+            crc32Update(0, data.data(), length) == header.crc &&
+            memcmp(data.data(), key.c_str(), header.keyLength) == 0;
+    if (valid) {
+      body = String((const char*)data.data() + header.keyLength);
+      storedAt = header.storedAt;
+    }
+  }
+  file.close();
+
+  if (!valid) {
+    // Old cache version, hash collision or a torn write
+    LittleFS.remove(path);
+  }
+  return valid;
+}
+
+AddressCacheResult AddressCache::lookup(const String& key, String& body) {
+  for (RamEntry& entry : ram) {
+    if (entry.key == key) {
+      entry.lastUsed = ++useCounter;
+      body = entry.body;
+      if (isFresh(entry.storedAt)) {
+        ramHits++;
+        return ADDRESS_CACHE_FRESH;
+      }
+      expired++;
+      return ADDRESS_CACHE_STALE;
+    }
+  }
+
+  uint32_t storedAt = 0;
+  if (readFile(key, body, storedAt)) {
+    putRam(key, body, storedAt);
+    if (isFresh(storedAt)) {
+      fileHits++;
+      return ADDRESS_CACHE_FRESH;
+    }
+    expired++;
+    return ADDRESS_CACHE_STALE;
+  }
+
+  misses++;
+  return ADDRESS_CACHE_MISS;
+}
+
+void AddressCache::store(const String& key, const String& body) {
+  uint32_t storedAt = now();
+  putRam(key, body, storedAt);
+  stores++;
+
+  if (!begin()) {
+    return;
+  }
+
+  AddressCacheHeader header;
+  header.magic = ADDRESS_CACHE_MAGIC;
+  header.version = ADDRESS_CACHE_VERSION;
+  header.keyLength = key.length();
+  header.storedAt = storedAt;
+  header.bodyLength = body.length();
+  header.crc = crc32Update(0, (const uint8_t*)key.c_str(), key.length());
+  header.crc = crc32Update(header.crc, (const uint8_t*)body.c_str(), body.length());
+
+  File file = LittleFS.open(pathFor(key), "w");
+  if (!file) {
+    Serial.println("✗ Failed to write address cache entry");
+    return;
+  }
+  file.write((const uint8_t*)&header, sizeof(header));
+  file.write((const uint8_t*)key.c_str(), key.length());
+  file.write((const uint8_t*)body.c_str(), body.length());
+  file.close();
+
+  trimFiles();
+}
+
+void AddressCache::trimFiles() {
+  // Evict the oldest entries once the directory grows past its budget
+  struct FileAge {
+    String path;
+    uint32_t storedAt;
+  };
+  std::vector<FileAge> files;
+
+  File dir = LittleFS.open(ADDRESS_CACHE_DIR);
+  File entry = dir.openNextFile();
+  while (entry) {
+    AddressCacheHeader header;
+    uint32_t storedAt = 0;
+    if (entry.read((uint8_t*)&header, sizeof(header)) == sizeof(header) && header.magic == ADDRESS_CACHE_MAGIC) {
+      storedAt = header.storedAt;
+    }
+    const char* name = entry.name();
+    const char* slash = strrchr(name, '/');
+    files.push_back({String(ADDRESS_CACHE_DIR "/") + (slash ? slash + 1 : name), storedAt});
+    entry.close();
+    entry = dir.openNextFile();
+  }
+  dir.close();
+
+  while (files.size() > ADDRESS_CACHE_MAX_FILES) {
+    size_t oldest = 0;
+    for (size_t i = 1; i < files.size(); i++) {
+      if (files[i].storedAt < files[oldest].storedAt) {
+        oldest = i;
+      }
+    }
+    LittleFS.remove(files[oldest].path);
+    files.erase(files.begin() + oldest);
+  }
+}
+
+void AddressCache::printStats() const {
+  Serial.printf("Address cache: %u RAM hits, %u flash hits, %u misses, %u expired, %u stores\n",
+                ramHits, fileHits, misses, expired, stores);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <vector>
+
+enum AddressCacheResult {
+  ADDRESS_CACHE_MISS,
+  ADDRESS_CACHE_FRESH,
+  ADDRESS_CACHE_STALE   // Past its TTL; only used if the server can't be reached
+};
+
+// Two-level cache for /api/address responses keyed by (reg_code, prov_code, citymun_code):
+// a small LRU in RAM in front of one file per key on LittleFS. Entries carry the cache
+// version and the server time they were stored at, taken from the HTTP Date header.
+class AddressCache {
+private:
+  struct RamEntry {
+    String key;
+    String body;
+    uint32_t storedAt;
+    uint32_t lastUsed;
+  };
+
+  std::vector<RamEntry> ram;
+  uint32_t useCounter;
+  bool mounted;
+
+  // Server clock: epoch seconds at millis() == 0, or 0 if not known yet
+  uint32_t epochBase;
+
+  uint32_t ramHits;
+  uint32_t fileHits;
+  uint32_t misses;
+  uint32_t expired;
+  uint32_t stores;
+
+  String pathFor(const String& key) const;
+  bool isFresh(uint32_t storedAt) const;
+  void putRam(const String& key, const String& body, uint32_t storedAt);
+  bool readFile(const String& key, String& body, uint32_t& storedAt);
+  void trimFiles();
+
+public:
+  AddressCache();
+
+  bool begin();
+
+  static String makeKey(const String& regCode, const String& provCode, const String& cityMunCode);
+
+  AddressCacheResult lookup(const String& key, String& body);
+  void store(const String& key, const String& body);
+
+  // Feed the Date header of a server response so TTLs survive reboots
+  void noteServerDate(const String& httpDate);
+  uint32_t now() const;
+
+  void printStats() const;
+};
+
+extern AddressCache addressCache;
@@ -0,0 +1,230 @@
+#include "config_store.h"
+#include <Preferences.h>
+#include <EEPROM.h>
+#include "../Utils/crc32.h"
+
+#define CONFIG_RECORD_MAGIC 0x53454443 // "SEDC"
+
+// On-flash layout: header followed by the config bytes the header describes
+struct ConfigHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t length;
+  uint32_t crc;
+};
+
+struct ConfigRecord {
+  ConfigHeader header;
+  DeviceConfig config;
+};
+
+ConfigStore configStore;
+
+ConfigStore::ConfigStore()
+  : loaded(false), dirty(false), dirtySinceMs(0), commits(0) {
+  memset(&cache, 0, sizeof(cache));
+}
+
+bool ConfigStore::begin() {
+  if (loaded) {
+    return true;
+  }
+
+  if (!load()) {
+    Serial.println("Config store empty or invalid, checking legacy EEPROM...");
+    memset(&cache, 0, sizeof(cache));
+    if (migrateLegacyEeprom()) {
+      commit();
+    }
+  }
+
+  loaded = true;
+  Serial.printf("Config loaded (schema v%d): setup %s, device ID %s\n", CONFIG_SCHEMA_VERSION,
+                cache.setupCompleted ? "COMPLETED" : "NOT COMPLETED",
+                cache.deviceId[0] ? cache.deviceId : "<none>");
+  return true;
+}
+
+bool ConfigStore::load() {
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NAMESPACE, true)) {
+    return false;
+  }
+
+  ConfigRecord record;
+  memset(&record, 0, sizeof(record));
+  size_t stored = prefs.getBytesLength(CONFIG_KEY);
+  size_t read = 0;
+  if (stored >= sizeof(ConfigHeader) && stored <= sizeof(record)) {
+    read = prefs.getBytes(CONFIG_KEY, &record, stored);
+  }
+  prefs.end();
+
+  if (read < sizeof(ConfigHeader) || record.header.magic != CONFIG_RECORD_MAGIC) {
+    return false;
+  }
+  if (record.header.length > sizeof(DeviceConfig) || sizeof(ConfigHeader) + record.header.length > read) {
+    Serial.println("Config record truncated");
+    return false;
+  }
+
+  uint32_t crc = crc32Update(0, (const uint8_t*)&record.config, record.header.length);
+  if (crc != record.header.crc) {
+    Serial.printf("Config CRC mismatch: 0x%08X != 0x%08X\n", crc, record.header.crc);
+    return false;
+  }
+
+  // Fields added after the stored version stay zeroed
+  memset(&cache, 0, sizeof(cache));
+  memcpy(&cache, &record.config, record.header.length);
+  cache.deviceId[DEVICE_ID_LENGTH] = '\0';
+  cache.deviceName[CONFIG_NAME_LENGTH] = '\0';
+  cache.location[CONFIG_LOCATION_LENGTH] = '\0';
+  cache.ownerUuid[CONFIG_OWNER_LENGTH] = '\0';
+
+  if (record.header.version != CONFIG_SCHEMA_VERSION) {
+    Serial.printf("Migrating config schema v%d -> v%d\n", record.header.version, CONFIG_SCHEMA_VERSION);
+    dirty = true;
+    commit();
+  }
+  return true;
+}
+
+bool ConfigStore::migrateLegacyEeprom() {
+  EEPROM.begin(EEPROM_SIZE);
+
+  uint16_t magic = (EEPROM.read(SETUP_FLAG_ADDR) << 8) | EEPROM.read(SETUP_FLAG_ADDR + 1);
+  bool hasValidId = true;
+  char deviceIdBuffer[DEVICE_ID_LENGTH + 1];
+  for (int i = 0; i < DEVICE_ID_LENGTH; i++) {
+    deviceIdBuffer[i] = EEPROM.read(DEVICE_ID_ADDR + i);
+    if (deviceIdBuffer[i] == (char)0xFF || deviceIdBuffer[i] == 0x00) {
+      hasValidId = false;
+      break;
+    }
+  }
+  deviceIdBuffer[DEVICE_ID_LENGTH] = '\0';
+
+  EEPROM.end();
+
+  if (magic != SETUP_MAGIC_NUMBER && !hasValidId) {
+    return false;
+  }
+
+  cache.setupCompleted = magic == SETUP_MAGIC_NUMBER;
+  if (hasValidId) {
+    memcpy(cache.deviceId, deviceIdBuffer, sizeof(cache.deviceId));
+  }
+  dirty = true;
+  Serial.printf("Migrated legacy EEPROM config (setup flag 0x%04X)\n", magic);
+  return true;
+}
+
+const DeviceConfig& ConfigStore::get() const {
+  return cache;
+}
+
+DeviceConfig& ConfigStore::edit() {
+  if (!dirty) {
+    dirtySinceMs = millis();
+  }
+  dirty = true;
+  return cache;
+}
+
+bool ConfigStore::commit() {
+  if (!dirty) {
+    return true;
+  }
+
+  ConfigRecord record;
+  record.header.magic = CONFIG_RECORD_MAGIC;
+  record.header.version = CONFIG_SCHEMA_VERSION;
+  record.header.length = sizeof(DeviceConfig);
+  record.config = cache;
+  record.header.crc = crc32Update(0, (const uint8_t*)&record.config, sizeof(DeviceConfig));
+
+  // A single blob write is atomic in NVS: the old entry is only erased
+  // once the new one is fully written
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NAMESPACE, false)) {
+    Serial.println("✗ Failed to open config store");
+    return false;
+  }
+  size_t written = prefs.putBytes(CONFIG_KEY, &record, sizeof(record));
+  prefs.end();
+
+  if (written != sizeof(record)) {
+    Serial.println("✗ Failed to commit config");
+    return false;
+  }
+
+  dirty = false;
+  commits++;
+  Serial.printf("✓ Config committed (%u writes this boot)\n", commits);
+  return true;
+}
+
+void ConfigStore::loop() {
+  if (dirty && millis() - dirtySinceMs >= CONFIG_WRITEBACK_DELAY_MS) {
+    commit();
+  }
+}
+
+bool ConfigStore::isSetupCompleted() const {
+  return cache.setupCompleted;
+}
+
+void ConfigStore::setSetupCompleted(bool completed) {
+  if (cache.setupCompleted == completed) {
+    return;
+  }
+  edit().setupCompleted = completed;
+  // The device restarts right after setup, so this one is written through
+  commit();
+}
+
+String ConfigStore::getDeviceId() const {
+  return String(cache.deviceId);
+}
+
+void ConfigStore::setDeviceId(const String& deviceId) {
+  DeviceConfig& config = edit();
+  strncpy(config.deviceId, deviceId.c_str(), DEVICE_ID_LENGTH);
+  config.deviceId[DEVICE_ID_LENGTH] = '\0';
+  // Losing a freshly generated ID would orphan the device record
+  commit();
+}
+
+bool ConfigStore::hasRegistration() const {
+  return cache.registrationCached;
+}
+
+void ConfigStore::setRegistration(const String& name, const String& location, const String& ownerUuid) {
+  if (cache.registrationCached && name == cache.deviceName && location == cache.location &&
+      ownerUuid == cache.ownerUuid) {
+    return;
+  }
+
+  DeviceConfig& config = edit();
+  config.registrationCached = true;
+  strncpy(config.deviceName, name.c_str(), CONFIG_NAME_LENGTH);
+  config.deviceName[CONFIG_NAME_LENGTH] = '\0';
+  strncpy(config.location, location.c_str(), CONFIG_LOCATION_LENGTH);
+  config.location[CONFIG_LOCATION_LENGTH] = '\0';
+  strncpy(config.ownerUuid, ownerUuid.c_str(), CONFIG_OWNER_LENGTH);
+  config.ownerUuid[CONFIG_OWNER_LENGTH] = '\0';
+  commit();
+}
+
+void ConfigStore::clearRegistration() {
+  if (!cache.registrationCached) {
+    return;
+  }
+  DeviceConfig& config = edit();
+  config.registrationCached = false;
+  config.deviceName[0] = '\0';
+  config.location[0] = '\0';
+  config.ownerUuid[0] = '\0';
+  commit();
+}
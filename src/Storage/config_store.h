@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../configs.h"
+#include "../Utils/device_id.h"
+#include <Arduino.h>
+
+// Typed persistent configuration. Append new fields at the end and bump
+// CONFIG_SCHEMA_VERSION; older records load with the new fields zeroed.
+#define CONFIG_NAME_LENGTH 50
+#define CONFIG_LOCATION_LENGTH 200
+#define CONFIG_OWNER_LENGTH 36
+
+struct DeviceConfig {
+  bool setupCompleted;
+  char deviceId[DEVICE_ID_LENGTH + 1];
+
+  // v2: registration from the last successful setup-status check
+  bool registrationCached;
+  char deviceName[CONFIG_NAME_LENGTH + 1];
+  char location[CONFIG_LOCATION_LENGTH + 1];
+  char ownerUuid[CONFIG_OWNER_LENGTH + 1];
+};
+
+// Versioned, CRC-protected config kept in a single NVS blob. It is loaded once into a
+// RAM cache at boot, so reads are free; writes go to the cache and are written back
+// lazily, or immediately for changes that must survive a crash.
+class ConfigStore {
+private:
+  DeviceConfig cache;
+  bool loaded;
+  bool dirty;
+  unsigned long dirtySinceMs;
+  uint32_t commits;
+
+  bool load();
+  bool migrateLegacyEeprom();
+
+public:
+  ConfigStore();
+
+  // Load the cache; falls back to the legacy EEPROM layout on first boot
+  bool begin();
+
+  const DeviceConfig& get() const;
+
+  // Mutable access; the change is written back after CONFIG_WRITEBACK_DELAY_MS
+  DeviceConfig& edit();
+
+  // Write the cache to flash now if it changed
+  bool commit();
+
+  // Lazy write-back; call from loop()
+  void loop();
+
+  // Convenience accessors
+  bool isSetupCompleted() const;
+  void setSetupCompleted(bool completed);
+  String getDeviceId() const;
+  void setDeviceId(const String& deviceId);
+
+  // Cached registration; only written when it actually changes
+  bool hasRegistration() const;
+  void setRegistration(const String& name, const String& location, const String& ownerUuid);
+  void clearRegistration();
+};
+
+extern ConfigStore configStore;
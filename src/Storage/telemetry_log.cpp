@@ -0,0 +1,487 @@
+#include "telemetry_log.h"
+#include "../Utils/crc32.h"
+#include <LittleFS.h>
+#include <algorithm>
+
+#define TELEMETRY_INDEX_MAGIC 0x544C4F47 // "TLOG"
+#define TELEMETRY_INDEX_PATH TELEMETRY_LOG_DIR "/index.bin"
+#define TELEMETRY_TMP_PATH TELEMETRY_LOG_DIR "/compact.tmp"
+
+struct TelemetryIndexHeader {
+  uint32_t magic;
+  uint32_t count;
+  uint32_t nextId;
+  uint32_t crc;
+};
+
+TelemetryLog telemetryLog;
+
+static bool segmentTimeLess(const TelemetrySegment& a, const TelemetrySegment& b) {
+  return a.firstMs < b.firstMs;
+}
+
+TelemetryLog::TelemetryLog()
+  : pendingCount(0), nextId(1), timeOffsetMs(0), lastLoggedMs(0), mounted(false),
+    appends(0), flushes(0), bytesWritten(0), droppedSegments(0), compactions(0), crcErrors(0) {
+}
+
+String TelemetryLog::segmentPath(uint32_t id) const {
+  char path[32];
+  snprintf(path, sizeof(path), TELEMETRY_LOG_DIR "/seg_%08lu.bin", (unsigned long)id);
+  return String(path);
+}
+
+bool TelemetryLog::begin() {
+  if (mounted) {
+    return true;
+  }
+
+  if (!LittleFS.begin(true)) {
+    Serial.println("✗ Failed to mount LittleFS, telemetry log disabled");
+    return false;
+  }
+  if (!LittleFS.exists(TELEMETRY_LOG_DIR)) {
+    LittleFS.mkdir(TELEMETRY_LOG_DIR);
+  }
+  mounted = true;
+
+  unsigned long startMs = millis();
+  if (!loadIndex()) {
+    Serial.println("Telemetry index missing or invalid, rebuilding from segments");
+    segments.clear();
+  }
+  reconcile();
+
+  if (segments.empty() || segments.back().sealed) {
+    openNewSegment();
+  }
+  for (const TelemetrySegment& segment : segments) {
+    if (segment.count > 0) {
+      lastLoggedMs = std::max(lastLoggedMs, segment.lastMs);
+    }
+  }
+
+  Serial.printf("Telemetry log: %u segments, %u records, recovered in %lu ms\n",
+                (unsigned)segments.size(), (unsigned)totalRecords(), millis() - startMs);
+  return true;
+}
+
+bool TelemetryLog::isReady() const {
+  return mounted;
+}
+
+bool TelemetryLog::loadIndex() {
+  File file = LittleFS.open(TELEMETRY_INDEX_PATH, "r");
+  if (!file) {
+    return false;
+  }
+
+  TelemetryIndexHeader header;
+  bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+               header.magic == TELEMETRY_INDEX_MAGIC &&
+               header.count <= TELEMETRY_MAX_SEGMENTS + 1;
+  if (valid) {
+    segments.resize(header.count);
+    size_t bytes = header.count * sizeof(TelemetrySegment);
+    valid = file.read((uint8_t*)segments.data(), bytes) == bytes &&
+            crc32Update(0, (const uint8_t*)segments.data(), bytes) == header.crc;
+    nextId = header.nextId;
+  }
+  file.close();
+  return valid;
+}
+
+bool TelemetryLog::saveIndex() {
+  // Only sealed segments are persisted; the active one is rescanned on boot
+  std::vector<TelemetrySegment> sealedSegments;
+  for (const TelemetrySegment& segment : segments) {
+    if (segment.sealed) {
+      sealedSegments.push_back(segment);
+    }
+  }
+
+  TelemetryIndexHeader header;
+  header.magic = TELEMETRY_INDEX_MAGIC;
+  header.count = sealedSegments.size();
+  header.nextId = nextId;
+  header.crc = crc32Update(0, (const uint8_t*)sealedSegments.data(), sealedSegments.size() * sizeof(TelemetrySegment));
+
+  File file = LittleFS.open(TELEMETRY_INDEX_PATH, "w");
+  if (!file) {
+    Serial.println("✗ Failed to write telemetry index");
+    return false;
+  }
+  file.write((const uint8_t*)&header, sizeof(header));
+  file.write((const uint8_t*)sealedSegments.data(), sealedSegments.size() * sizeof(TelemetrySegment));
+  file.close();
+  return true;
+}
+
+bool TelemetryLog::scanSegment(uint32_t id, TelemetrySegment& info) {
+  File file = LittleFS.open(segmentPath(id), "r");
+  if (!file) {
+    return false;
+  }
+
+  info.id = id;
+  info.firstMs = 0;
+  info.lastMs = 0;
+  info.count = 0;
+  info.crc = 0;
+  // A torn final write leaves a partial record; it is ignored and the segment sealed
+  info.sealed = (file.size() % sizeof(SampleRecord)) != 0 ||
+                file.size() >= TELEMETRY_SEGMENT_RECORDS * sizeof(SampleRecord);
+
+  SampleRecord record;
+  while (info.count < TELEMETRY_SEGMENT_RECORDS &&
+         file.read((uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+    if (info.count == 0) {
+      info.firstMs = record.timestampMs;
+    }
+    info.lastMs = record.timestampMs;
+    info.crc = crc32Update(info.crc, (const uint8_t*)&record, sizeof(record));
+    info.count++;
+  }
+  file.close();
+  return true;
+}
+
+void TelemetryLog::reconcile() {
+  // An interrupted compaction never renamed its output
+  if (LittleFS.exists(TELEMETRY_TMP_PATH)) {
+    LittleFS.remove(TELEMETRY_TMP_PATH);
+  }
+
+  // Segments on disk that the index doesn't know about (the active segment,
+  // or a compaction that finished but didn't save the index) are scanned
+  std::vector<TelemetrySegment> found;
+  File dir = LittleFS.open(TELEMETRY_LOG_DIR);
+  File entry = dir.openNextFile();
+  while (entry) {
+    // name() points into the file handle, so copy it before closing
+    String name = entry.name();
+    int slash = name.lastIndexOf('/');
+    unsigned long id = 0;
+    size_t size = entry.size();
+    entry.close();
+
+    if (sscanf(name.c_str() + slash + 1, "seg_%lu.bin", &id) == 1) {
+      auto known = std::find_if(segments.begin(), segments.end(),
+                                [id](const TelemetrySegment& s) { return s.id == id; });
+      if (known != segments.end() && size == known->count * sizeof(SampleRecord)) {
+        found.push_back(*known);
+      } else {
+        TelemetrySegment info;
+        if (scanSegment(id, info)) {
+          found.push_back(info);
+        }
+      }
+      nextId = std::max(nextId, (uint32_t)id + 1);
+    }
+    entry = dir.openNextFile();
+  }
+  dir.close();
+
+  // Drop empty files and index entries whose files are gone
+  segments.clear();
+  for (const TelemetrySegment& segment : found) {
+    if (segment.count > 0) {
+      segments.push_back(segment);
+    } else {
+      LittleFS.remove(segmentPath(segment.id));
+    }
+  }
+  std::sort(segments.begin(), segments.end(), segmentTimeLess);
+
+  // Log time never overlaps between genuine segments, so an overlap is the
+  // original of a compaction that was interrupted before it was removed
+  for (size_t i = 0; i + 1 < segments.size();) {
+    if (segments[i + 1].firstMs <= segments[i].lastMs) {
+      size_t contained = segments[i].count <= segments[i + 1].count ? i : i + 1;
+      LittleFS.remove(segmentPath(segments[contained].id));
+      segments.erase(segments.begin() + contained);
+    } else {
+      i++;
+    }
+  }
+
+  // Only the newest segment may stay open for appends
+  for (size_t i = 0; i + 1 < segments.size(); i++) {
+    segments[i].sealed = 1;
+  }
+  saveIndex();
+}
+
+void TelemetryLog::openNewSegment() {
+  TelemetrySegment segment;
+  segment.id = nextId++;
+  segment.firstMs = 0;
+  segment.lastMs = 0;
+  segment.count = 0;
+  segment.sealed = 0;
+  segment.crc = 0;
+  segments.push_back(segment);
+}
+
+void TelemetryLog::sealActive() {
+  segments.back().sealed = 1;
+  applyRetention();
+  openNewSegment();
+  saveIndex();
+}
+
+bool TelemetryLog::append(SampleRecord record) {
+  if (!mounted) {
+    return false;
+  }
+
+  // Rebase timestamps that went backwards (reboot, power loss) so log time stays monotonic
+  if (record.timestampMs + timeOffsetMs <= lastLoggedMs) {
+    timeOffsetMs = lastLoggedMs + 1 - record.timestampMs;
+  }
+  record.timestampMs += timeOffsetMs;
+  lastLoggedMs = record.timestampMs;
+
+  pending[pendingCount++] = record;
+  appends++;
+
+  if (pendingCount >= TELEMETRY_WRITE_BATCH ||
+      segments.back().count + pendingCount >= TELEMETRY_SEGMENT_RECORDS) {
+    return flush();
+  }
+  return true;
+}
+
+bool TelemetryLog::flush() {
+  if (!mounted || pendingCount == 0) {
+    return true;
+  }
+
+  TelemetrySegment& active = segments.back();
+  File file = LittleFS.open(segmentPath(active.id), "a");
+  if (!file) {
+    Serial.println("✗ Failed to open telemetry segment");
+    return false;
+  }
+  size_t bytes = pendingCount * sizeof(SampleRecord);
+  size_t written = file.write((const uint8_t*)pending, bytes);
+  file.close();
+
+  if (written != bytes) {
+    // Partial writes are discarded on the next boot scan
+    Serial.println("✗ Short write to telemetry segment");
+    pendingCount = 0;
+    sealActive();
+    return false;
+  }
+
+  if (active.count == 0) {
+    active.firstMs = pending[0].timestampMs;
+  }
+  active.lastMs = pending[pendingCount - 1].timestampMs;
+  active.count += pendingCount;
+  active.crc = crc32Update(active.crc, (const uint8_t*)pending, bytes);
+  pendingCount = 0;
+  flushes++;
+  bytesWritten += bytes;
+
+  if (active.count >= TELEMETRY_SEGMENT_RECORDS) {
+    sealActive();
+  }
+  return true;
+}
+
+size_t TelemetryLog::readRange(uint32_t fromMs, uint32_t toMs, SampleRecord* out, size_t maxRecords) {
+  size_t copied = 0;
+  if (!mounted) {
+    return 0;
+  }
+
+  for (const TelemetrySegment& segment : segments) {
+    if (copied >= maxRecords) {
+      break;
+    }
+    if (segment.count == 0 || segment.lastMs < fromMs || segment.firstMs > toMs) {
+      continue;
+    }
+
+    File file = LittleFS.open(segmentPath(segment.id), "r");
+    if (!file) {
+      continue;
+    }
+
+    // Records are fixed-size and time-ordered: binary search for the first one in range
+    size_t low = 0;
+    size_t high = segment.count;
+    SampleRecord record;
+    while (low < high) {
+      size_t mid = (low + high) / 2;
+      file.seek(mid * sizeof(SampleRecord));
+      file.read((uint8_t*)&record, sizeof(record));
+      if (record.timestampMs < fromMs) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+
+    file.seek(low * sizeof(SampleRecord));
+    for (size_t i = low; i < segment.count && copied < maxRecords; i++) {
+      if (file.read((uint8_t*)&record, sizeof(record)) != sizeof(record) || record.timestampMs > toMs) {
+        break;
+      }
+      out[copied++] = record;
+    }
+    file.close();
+  }
+
+  // Records still waiting in the write batch
+  for (size_t i = 0; i < pendingCount && copied < maxRecords; i++) {
+    if (pending[i].timestampMs >= fromMs && pending[i].timestampMs <= toMs) {
+      out[copied++] = pending[i];
+    }
+  }
+  return copied;
+}
+
+bool TelemetryLog::verifySegment(size_t index) {
+  if (index >= segments.size()) {
+    return false;
+  }
+
+  TelemetrySegment info;
+  if (!scanSegment(segments[index].id, info) || info.count != segments[index].count ||
+      info.crc != segments[index].crc) {
+    crcErrors++;
+    Serial.printf("✗ Telemetry segment %u failed verification\n", segments[index].id);
+    return false;
+  }
+  return true;
+}
+
+size_t TelemetryLog::compact() {
+  if (!mounted) {
+    return 0;
+  }
+
+  size_t merged = 0;
+  size_t i = 0;
+  while (i + 1 < segments.size()) {
+    // Find a run of sealed segments that fits into one
+    size_t end = i;
+    size_t records = 0;
+    while (end < segments.size() && segments[end].sealed &&
+           records + segments[end].count <= TELEMETRY_SEGMENT_RECORDS) {
+      records += segments[end].count;
+      end++;
+    }
+    if (end - i < 2) {
+      i++;
+      continue;
+    }
+
+    File out = LittleFS.open(TELEMETRY_TMP_PATH, "w");
+    if (!out) {
+      return merged;
+    }
+    TelemetrySegment combined;
+    combined.id = nextId++;
+    combined.firstMs = segments[i].firstMs;
+    combined.lastMs = segments[end - 1].lastMs;
+    combined.count = 0;
+    combined.sealed = 1;
+    combined.crc = 0;
+
+    SampleRecord record;
+    bool ok = true;
+    for (size_t j = i; j < end && ok; j++) {
+      File in = LittleFS.open(segmentPath(segments[j].id), "r");
+      if (!in) {
+        ok = false;
+        break;
+      }
+      for (uint16_t k = 0; k < segments[j].count; k++) {
+        if (in.read((uint8_t*)&record, sizeof(record)) != sizeof(record) ||
+            out.write((const uint8_t*)&record, sizeof(record)) != sizeof(record)) {
+          ok = false;
+          break;
+        }
+        combined.crc = crc32Update(combined.crc, (const uint8_t*)&record, sizeof(record));
+        combined.count++;
+      }
+      in.close();
+    }
+    out.close();
+
+    if (!ok || !LittleFS.rename(TELEMETRY_TMP_PATH, segmentPath(combined.id))) {
+      LittleFS.remove(TELEMETRY_TMP_PATH);
+      Serial.println("✗ Telemetry compaction failed");
+      return merged;
+    }
+
+    // The merged segment is durable; originals can go
+    for (size_t j = i; j < end; j++) {
+      LittleFS.remove(segmentPath(segments[j].id));
+    }
+    segments.erase(segments.begin() + i, segments.begin() + end);
+    segments.insert(segments.begin() + i, combined);
+    merged += end - i;
+    compactions++;
+    i++;
+  }
+
+  if (merged > 0) {
+    saveIndex();
+    Serial.printf("Telemetry log compacted %u segments\n", (unsigned)merged);
+  }
+  return merged;
+}
+
+size_t TelemetryLog::applyRetention() {
+  size_t dropped = 0;
+  while (segments.size() > 1 && segments.front().sealed &&
+         (segments.size() > TELEMETRY_MAX_SEGMENTS ||
+          lastLoggedMs - segments.front().lastMs > TELEMETRY_RETENTION_MS)) {
+    removeSegment(0);
+    dropped++;
+  }
+  return dropped;
+}
+
+bool TelemetryLog::removeSegment(size_t index) {
+  bool removed = LittleFS.remove(segmentPath(segments[index].id));
+  segments.erase(segments.begin() + index);
+  droppedSegments++;
+  return removed;
+}
+
+size_t TelemetryLog::totalRecords() const {
+  size_t records = pendingCount;
+  for (const TelemetrySegment& segment : segments) {
+    records += segment.count;
+  }
+  return records;
+}
+
+uint32_t TelemetryLog::getLastLoggedMs() const {
+  return lastLoggedMs;
+}
+
+size_t TelemetryLog::getSegmentCount() const {
+  return segments.size();
+}
+
+const TelemetrySegment& TelemetryLog::getSegment(size_t index) const {
+  return segments[index];
+}
+
+void TelemetryLog::appendCounters(std::map<String, String>& out) const {
+  out["tlog_segments"] = String(segments.size());
+  out["tlog_records"] = String(totalRecords());
+  out["tlog_appends"] = String(appends);
+  out["tlog_flushes"] = String(flushes);
+  out["tlog_bytes_written"] = String(bytesWritten);
+  out["tlog_dropped_segments"] = String(droppedSegments);
+  out["tlog_compactions"] = String(compactions);
+  out["tlog_crc_errors"] = String(crcErrors);
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../configs.h"
+#include "../Database/device.h"
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+// Index entry for one segment file
+struct TelemetrySegment {
+  uint32_t id;
+  uint32_t firstMs;
+  uint32_t lastMs;
+  uint16_t count;
+  uint16_t sealed;
+  uint32_t crc;   // CRC-32 over the segment's records
+};
+
+// Append-only log of SampleRecords on LittleFS, split into fixed-size segment files.
+// Appends are batched in RAM and written to the active segment; full segments are
+// sealed and indexed by time range, so range reads only open overlapping segments.
+// Log time is kept monotonic across reboots by rebasing incoming timestamps.
+class TelemetryLog {
+private:
+  std::vector<TelemetrySegment> segments;  // Sorted by time; last entry is the active segment
+  SampleRecord pending[TELEMETRY_WRITE_BATCH];
+  size_t pendingCount;
+  uint32_t nextId;
+  uint32_t timeOffsetMs;
+  uint32_t lastLoggedMs;
+  bool mounted;
+
+  uint32_t appends;
+  uint32_t flushes;
+  uint32_t bytesWritten;
+  uint32_t droppedSegments;
+  uint32_t compactions;
+  uint32_t crcErrors;
+
+  String segmentPath(uint32_t id) const;
+  bool loadIndex();
+  bool saveIndex();
+  bool scanSegment(uint32_t id, TelemetrySegment& info);
+  void reconcile();
+  void openNewSegment();
+  void sealActive();
+  bool removeSegment(size_t index);
+  size_t totalRecords() const;
+
+public:
+  TelemetryLog();
+
+  // Mount the filesystem and recover the index
+  bool begin();
+  bool isReady() const;
+
+  // O(1): buffered in RAM, written every TELEMETRY_WRITE_BATCH records
+  bool append(SampleRecord record);
+  bool flush();
+
+  // Copy up to maxRecords records with fromMs <= timestampMs <= toMs, oldest first
+  size_t readRange(uint32_t fromMs, uint32_t toMs, SampleRecord* out, size_t maxRecords);
+
+  // Recompute a sealed segment's checksum
+  bool verifySegment(size_t index);
+
+  // Merge adjacent under-filled sealed segments (left behind by reboots)
+  size_t compact();
+
+  // Drop segments beyond TELEMETRY_MAX_SEGMENTS or older than TELEMETRY_RETENTION_MS
+  size_t applyRetention();
+
+  uint32_t getLastLoggedMs() const;
+  size_t getSegmentCount() const;
+  const TelemetrySegment& getSegment(size_t index) const;
+
+  void appendCounters(std::map<String, String>& out) const;
+};
+
+extern TelemetryLog telemetryLog;
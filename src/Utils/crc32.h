@@ -0,0 +1,6 @@
+#pragma once
+
+#include <Arduino.h>
+
+// CRC-32 (IEEE 802.3). Chainable: pass the previous result as crc, starting from 0.
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length);
@@ -1,5 +1,5 @@
 #include "device_id.h"
-#include <EEPROM.h>
+#include "../Storage/config_store.h"
 #include <esp_random.h>
 
 String generateUUID() {
@@ -24,51 +24,23 @@ String generateUUID() {
 }
 
 String getOrGenerateDeviceId() {
-  EEPROM.begin(512);
+  String deviceId = configStore.getDeviceId();
   
-  // Check if device ID exists
-  char deviceIdBuffer[DEVICE_ID_LENGTH + 1];
-  bool hasValidId = true;
-  
-  for (int i = 0; i < DEVICE_ID_LENGTH; i++) {
-    deviceIdBuffer[i] = EEPROM.read(DEVICE_ID_ADDR + i);
-    if (deviceIdBuffer[i] == 0xFF || deviceIdBuffer[i] == 0x00) {
-      hasValidId = false;
-      break;
-    }
-  }
-  deviceIdBuffer[DEVICE_ID_LENGTH] = '\0';
-  
-  String deviceId;
-  
-  if (hasValidId && strlen(deviceIdBuffer) == DEVICE_ID_LENGTH) {
-    deviceId = String(deviceIdBuffer);
+  if (deviceId.length() == DEVICE_ID_LENGTH) {
     Serial.println("Loaded existing Device ID: " + deviceId);
   } else {
     // Generate new UUID
     deviceId = generateUUID();
     Serial.println("Generated new Device ID: " + deviceId);
-    
-    // Store in EEPROM
-    for (int i = 0; i < DEVICE_ID_LENGTH; i++) {
-      EEPROM.write(DEVICE_ID_ADDR + i, deviceId[i]);
-    }
-    EEPROM.commit();
+    configStore.setDeviceId(deviceId);
   }
   
-  EEPROM.end();
   return deviceId;
 }
 
 void generateNewDeviceId() {
   String newId = generateUUID();
-  
-  EEPROM.begin(512);
-  for (int i = 0; i < DEVICE_ID_LENGTH; i++) {
-    EEPROM.write(DEVICE_ID_ADDR + i, newId[i]);
-  }
-  EEPROM.commit();
-  EEPROM.end();
+  configStore.setDeviceId(newId);
   
   Serial.println("Generated and stored new Device ID: " + newId);
 }
\ No newline at end of file
@@ -3,8 +3,6 @@
 
 #include <Arduino.h>
 
-// EEPROM addresses for device ID storage
-#define DEVICE_ID_ADDR 100
 #define DEVICE_ID_LENGTH 36  // UUID length
 
 String getOrGenerateDeviceId();
@@ -0,0 +1,243 @@
+#include "net_timing.h"
+
+NetTiming netTiming;
+
+// Upper bounds of all but the last (open-ended) bucket
+static const uint16_t phaseBoundsMs[NET_TIMING_HIST_BUCKETS - 1] = {50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000};
+
+const char* netEndpointName(NetEndpoint endpoint) {
+  switch (endpoint) {
+  case NET_AUTH:
+    return "auth";
+  case NET_DEVICE_CREATE:
+    return "dev_create";
+  case NET_DEVICE_UPDATE:
+    return "dev_update";
+  case NET_DEVICE_READ:
+    return "dev_read";
+  case NET_DEVICE_DATA:
+    return "data";
+  case NET_HEARTBEAT:
+    return "heartbeat";
+  case NET_SETUP_STATUS:
+    return "setup";
+  case NET_ADDRESS:
+    return "address";
+  case NET_PROFILES:
+    return "profiles";
+  default:
+    return "unknown";
+  }
+}
+
+const char* netPhaseName(NetPhase phase) {
+  switch (phase) {
+  case NET_PHASE_CONNECT:
+    return "connect";
+  case NET_PHASE_WRITE:
+    return "write";
+  case NET_PHASE_TTFB:
+    return "ttfb";
+  case NET_PHASE_BODY:
+    return "body";
+  case NET_PHASE_TOTAL:
+    return "total";
+  default:
+    return "unknown";
+  }
+}
+
+MeteredClient::MeteredClient(Client& client)
+  : inner(client), bytesOut(0), bytesIn(0), connects(0), connectMs(0) {
+}
+
+int MeteredClient::connect(IPAddress ip, uint16_t port) {
+  unsigned long start = millis();
+  int result = inner.connect(ip, port);
+  connects++;
+  connectMs += millis() - start;
+  return result;
+}
+
+int MeteredClient::connect(const char* host, uint16_t port) {
+  unsigned long start = millis();
+  int result = inner.connect(host, port);
+  connects++;
+  connectMs += millis() - start;
+  return result;
+}
+
+size_t MeteredClient::write(uint8_t c) {
+  size_t n = inner.write(c);
+  bytesOut += n;
+  return n;
+}
+
+size_t MeteredClient::write(const uint8_t* buffer, size_t size) {
+  size_t n = inner.write(buffer, size);
+  bytesOut += n;
+  return n;
+}
+
+int MeteredClient::available() {
+  return inner.available();
+}
+
+int MeteredClient::read() {
+  int c = inner.read();
+  if (c >= 0) {
+    bytesIn++;
+  }
+  return c;
+}
+
+int MeteredClient::read(uint8_t* buffer, size_t size) {
+  int n = inner.read(buffer, size);
+  if (n > 0) {
+    bytesIn += n;
+  }
+  return n;
+}
+
+int MeteredClient::peek() {
+  return inner.peek();
+}
+
+void MeteredClient::flush() {
+  inner.flush();
+}
+
+void MeteredClient::stop() {
+  inner.stop();
+}
+
+uint8_t MeteredClient::connected() {
+  return inner.connected();
+}
+
+MeteredClient::operator bool() {
+  return (bool)inner;
+}
+
+NetTrace::NetTrace(MeteredClient& client_ref, NetEndpoint endpoint_ref)
+  : client(client_ref), endpoint(endpoint_ref), startMs(millis()), sentMs(0), firstByteMs(0),
+    bytesOutStart(client_ref.bytesOut), bytesInStart(client_ref.bytesIn),
+    connectsStart(client_ref.connects), connectMsStart(client_ref.connectMs), finished(false) {
+}
+
+NetTrace::~NetTrace() {
+  if (!finished) {
+    finish(0);
+  }
+}
+
+void NetTrace::sent() {
+  sentMs = millis();
+}
+
+void NetTrace::firstByte() {
+  firstByteMs = millis();
+}
+
+void NetTrace::finish(int statusCode) {
+  if (finished) {
+    return;
+  }
+  finished = true;
+
+  unsigned long endMs = millis();
+  uint32_t connectMs = client.connectMs - connectMsStart;
+  bool reused = client.connects == connectsStart;
+
+  // Missing marks collapse their phase to 0 and leave the time in the next one
+  unsigned long sentAt = sentMs ? sentMs : (firstByteMs ? firstByteMs : endMs);
+  unsigned long firstByteAt = firstByteMs ? firstByteMs : endMs;
+  uint32_t phaseMs[NET_PHASE_COUNT];
+  phaseMs[NET_PHASE_CONNECT] = connectMs;
+  phaseMs[NET_PHASE_TOTAL] = endMs - startMs;
+  uint32_t beforeSent = sentAt - startMs;
+  phaseMs[NET_PHASE_WRITE] = beforeSent > connectMs ? beforeSent - connectMs : 0;
+  phaseMs[NET_PHASE_TTFB] = firstByteAt >= sentAt ? firstByteAt - sentAt : 0;
+  phaseMs[NET_PHASE_BODY] = endMs - firstByteAt;
+
+#if NET_TIMING_ENABLED
+  netTiming.record(endpoint, phaseMs, reused, client.bytesOut - bytesOutStart, client.bytesIn - bytesInStart,
+                   statusCode <= 0 || statusCode >= 400);
+#endif
+}
+
+NetTiming::NetTiming()
+  : lock(portMUX_INITIALIZER_UNLOCKED), lastReportMs(0), reported(false) {
+  memset(stats, 0, sizeof(stats));
+}
+
+void NetTiming::record(NetEndpoint endpoint, const uint32_t phaseMs[NET_PHASE_COUNT], bool reused,
+                       uint32_t bytesOut, uint32_t bytesIn, bool failed) {
+  if (endpoint >= NET_ENDPOINT_COUNT) {
+    return;
+  }
+
+  portENTER_CRITICAL(&lock);
+  EndpointStats& entry = stats[endpoint];
+  entry.requests++;
+  entry.failures += failed;
+  entry.reused += reused;
+  entry.bytesOut += bytesOut;
+  entry.bytesIn += bytesIn;
+  if (phaseMs[NET_PHASE_TOTAL] > entry.maxTotalMs) {
+    entry.maxTotalMs = phaseMs[NET_PHASE_TOTAL];
+  }
+  for (int phase = 0; phase < NET_PHASE_COUNT; phase++) {
+    int bucket = 0;
+    while (bucket < NET_TIMING_HIST_BUCKETS - 1 && phaseMs[phase] >= phaseBoundsMs[bucket]) {
+      bucket++;
+    }
+    if (entry.hist[phase][bucket] < UINT16_MAX) {
+      entry.hist[phase][bucket]++;
+    }
+  }
+  portEXIT_CRITICAL(&lock);
+}
+
+void NetTiming::appendCounters(std::map<String, String>& out) {
+  if (reported && millis() - lastReportMs < NET_TIMING_REPORT_MS) {
+    return;
+  }
+
+  // Copy out under the lock; building Strings allocates
+  EndpointStats snapshot[NET_ENDPOINT_COUNT];
+  portENTER_CRITICAL(&lock);
+  memcpy(snapshot, stats, sizeof(stats));
+  portEXIT_CRITICAL(&lock);
+
+  bool any = false;
+  for (int i = 0; i < NET_ENDPOINT_COUNT; i++) {
+    const EndpointStats& entry = snapshot[i];
+    if (entry.requests == 0) {
+      continue;
+    }
+    any = true;
+    String prefix = String("net_") + netEndpointName((NetEndpoint)i) + "_";
+    out[prefix + "requests"] = String(entry.requests);
+    out[prefix + "failures"] = String(entry.failures);
+    out[prefix + "reused"] = String(entry.reused);
+    out[prefix + "bytes_out"] = String(entry.bytesOut);
+    out[prefix + "bytes_in"] = String(entry.bytesIn);
+    out[prefix + "max_ms"] = String(entry.maxTotalMs);
+
+    // Counts per bucket: <50, <100, <200, <500 ms, <1, <2, <5, <10, <20 s, >=20 s
+    for (int phase = 0; phase < NET_PHASE_COUNT; phase++) {
+      String histogram;
+      for (int b = 0; b < NET_TIMING_HIST_BUCKETS; b++) {
+        if (b > 0) histogram += "/";
+        histogram += String(entry.hist[phase][b]);
+      }
+      out[prefix + netPhaseName((NetPhase)phase) + "_hist"] = histogram;
+    }
+  }
+
+  if (any) {
+    reported = true;
+    lastReportMs = millis();
+  }
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <Client.h>
+#include <freertos/FreeRTOS.h>
+#include <map>
+
+// API endpoints timed separately
+enum NetEndpoint {
+  NET_AUTH = 0,
+  NET_DEVICE_CREATE,
+  NET_DEVICE_UPDATE,        // Device, status and location updates; removal
+  NET_DEVICE_READ,          // Device and device data lookups
+  NET_DEVICE_DATA,          // Telemetry posts and updates
+  NET_HEARTBEAT,
+  NET_SETUP_STATUS,
+  NET_ADDRESS,
+  NET_PROFILES,
+  NET_ENDPOINT_COUNT
+};
+
+// Phases of one request. The A76XX opens the TCP socket and runs the TLS
+// handshake in a single command, so connect covers both; it is 0 when the
+// request reused an open connection.
+enum NetPhase {
+  NET_PHASE_CONNECT = 0,
+  NET_PHASE_WRITE,          // Request line, headers and body
+  NET_PHASE_TTFB,           // Request sent until the status line arrived
+  NET_PHASE_BODY,           // Headers and body read
+  NET_PHASE_TOTAL,
+  NET_PHASE_COUNT
+};
+
+// Client wrapper that counts bytes and times connects for NetTrace. Wrap the
+// modem client for the lifetime of one HttpClient.
+class MeteredClient : public Client {
+private:
+  Client& inner;
+
+public:
+  uint32_t bytesOut;
+  uint32_t bytesIn;
+  uint32_t connects;
+  uint32_t connectMs;       // Sum over all connects
+
+  explicit MeteredClient(Client& client);
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char* host, uint16_t port) override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  int available() override;
+  int read() override;
+  int read(uint8_t* buffer, size_t size) override;
+  int peek() override;
+  void flush() override;
+  void stop() override;
+  uint8_t connected() override;
+  operator bool() override;
+};
+
+// Times one request on a MeteredClient. Mark sent() once the body is written
+// and firstByte() once the status code is in, then finish() with the status;
+// a trace that is never finished is recorded as a failure.
+class NetTrace {
+private:
+  MeteredClient& client;
+  NetEndpoint endpoint;
+  unsigned long startMs;
+  unsigned long sentMs;
+  unsigned long firstByteMs;
+  uint32_t bytesOutStart;
+  uint32_t bytesInStart;
+  uint32_t connectsStart;
+  uint32_t connectMsStart;
+  bool finished;
+
+public:
+  NetTrace(MeteredClient& client, NetEndpoint endpoint);
+  ~NetTrace();
+
+  void sent();
+  void firstByte();
+  void finish(int statusCode);
+};
+
+// Per-endpoint request counts, bytes and phase histograms since boot
+class NetTiming {
+private:
+  struct EndpointStats {
+    uint32_t requests;
+    uint32_t failures;          // No connection, no status or status >= 400
+    uint32_t reused;            // Served on an already open connection
+    uint32_t bytesOut;
+    uint32_t bytesIn;
+    uint32_t maxTotalMs;
+    uint16_t hist[NET_PHASE_COUNT][NET_TIMING_HIST_BUCKETS];
+  };
+
+  EndpointStats stats[NET_ENDPOINT_COUNT];
+  portMUX_TYPE lock;
+  unsigned long lastReportMs;
+  bool reported;
+
+public:
+  NetTiming();
+
+  void record(NetEndpoint endpoint, const uint32_t phaseMs[NET_PHASE_COUNT], bool reused,
+              uint32_t bytesOut, uint32_t bytesIn, bool failed);
+
+  // Adds net_<endpoint>_* counters for endpoints with traffic, at most once
+  // every NET_TIMING_REPORT_MS; histograms are cumulative so nothing is lost
+  void appendCounters(std::map<String, String>& out);
+};
+
+extern NetTiming netTiming;
+
+const char* netEndpointName(NetEndpoint endpoint);
+const char* netPhaseName(NetPhase phase);
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-capacity lock-free rings for passing small POD records between tasks
+// and ISRs without a FreeRTOS queue's critical sections. Capacity must be a
+// power of two. Neither ring blocks: pair them with a task notification when
+// the consumer needs to sleep until data arrives.
+
+#if defined(ESP_PLATFORM)
+#define RING_BUFFER_CACHE_LINE 32
+#else
+#define RING_BUFFER_CACHE_LINE 64
+#endif
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "ring buffers need lock-free 32-bit atomics");
+
+// One producer, one consumer. Each side owns one index and keeps a cached copy
+// of the other's, so the common case touches no line the other core writes.
+// push() is ISR-safe when the ISR is the only producer.
+template <typename T, size_t Capacity>
+class SpscRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+private:
+  static const uint32_t Mask = Capacity - 1;
+
+  alignas(RING_BUFFER_CACHE_LINE) std::atomic<uint32_t> tail;   // Written by the producer
+  uint32_t headCache;
+  alignas(RING_BUFFER_CACHE_LINE) std::atomic<uint32_t> head;   // Written by the consumer
+  uint32_t tailCache;
+  alignas(RING_BUFFER_CACHE_LINE) T slots[Capacity];
+
+public:
+  SpscRing() : tail(0), headCache(0), head(0), tailCache(0) {}
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  // Producer side; false if full
+  bool push(const T& item) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t - headCache == Capacity) {
+      headCache = head.load(std::memory_order_acquire);
+      if (t - headCache == Capacity) {
+        return false;
+      }
+    }
+    slots[t & Mask] = item;
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side; false if empty
+  bool pop(T& item) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h == tailCache) {
+      tailCache = tail.load(std::memory_order_acquire);
+      if (h == tailCache) {
+        return false;
+      }
+    }
+    item = slots[h & Mask];
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Approximate when called concurrently with push() or pop()
+  size_t size() const {
+    return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+  }
+
+  bool empty() const { return size() == 0; }
+  static size_t capacity() { return Capacity; }
+};
+
+// Many producers, one consumer (bounded Vyukov queue). Each slot carries a
+// sequence number that says whose turn it is, so producers only contend on
+// the claim of a position and never wait for each other to finish writing.
+// push() is ISR-safe: a producer preempted mid-write stalls only the consumer,
+// which sees that slot as not ready yet and retries later.
+template <typename T, size_t Capacity>
+class MpscRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+private:
+  static const uint32_t Mask = Capacity - 1;
+
+  struct Slot {
+    std::atomic<uint32_t> sequence;
+    T item;
+  };
+
+  alignas(RING_BUFFER_CACHE_LINE) std::atomic<uint32_t> tail;   // Claimed by producers
+  alignas(RING_BUFFER_CACHE_LINE) uint32_t head;                // Consumer only
+  alignas(RING_BUFFER_CACHE_LINE) Slot slots[Capacity];
+
+public:
+  MpscRing() : tail(0), head(0) {
+    for (uint32_t i = 0; i < Capacity; i++) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+  MpscRing(const MpscRing&) = delete;
+  MpscRing& operator=(const MpscRing&) = delete;
+
+  // Any producer; false if full
+  bool push(const T& item) {
+    uint32_t pos = tail.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot& slot = slots[pos & Mask];
+      int32_t diff = (int32_t)(slot.sequence.load(std::memory_order_acquire) - pos);
+      if (diff == 0) {
+        if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          slot.item = item;
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+        // pos now holds the current tail; retry there
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Consumer side; false if empty or the next slot is still being written
+  bool pop(T& item) {
+    Slot& slot = slots[head & Mask];
+    if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+      return false;
+    }
+    item = slot.item;
+    slot.sequence.store(head + Capacity, std::memory_order_release);
+    head++;
+    return true;
+  }
+
+  // Consumer side: claimed positions not yet consumed
+  size_t size() const {
+    return tail.load(std::memory_order_acquire) - head;
+  }
+
+  bool empty() const { return size() == 0; }
+  static size_t capacity() { return Capacity; }
+};
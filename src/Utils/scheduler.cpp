@@ -0,0 +1,322 @@
+#include "scheduler.h"
+
+Scheduler scheduler;
+
+static const uint16_t latenessBoundsMs[SCHEDULER_HIST_BUCKETS - 1] = {1, 2, 5, 10, 20, 50, 100, 200, 500};
+
+Scheduler::Scheduler() : lastTick(0), mutex(nullptr), owner(nullptr) {
+  for (int i = 0; i < SCHEDULER_WHEEL_SLOTS; i++) {
+    wheel[i] = -1;
+  }
+  for (int i = 0; i < SCHEDULER_MAX_JOBS; i++) {
+    jobs[i].active = false;
+    jobs[i].linked = false;
+    jobs[i].generation = 0;
+  }
+}
+
+void Scheduler::begin() {
+  // Not in the constructor: static initializers run before FreeRTOS is ready
+  if (!mutex) {
+    mutex = xSemaphoreCreateMutex();
+  }
+  owner = xTaskGetCurrentTaskHandle();
+  lastTick = millis() / SCHEDULER_TICK_MS;
+}
+
+Scheduler::Job* Scheduler::find(int id) {
+  if (id < 0) {
+    return nullptr;
+  }
+  Job& job = jobs[id % SCHEDULER_MAX_JOBS];
+  if (!job.active || job.generation != id / SCHEDULER_MAX_JOBS) {
+    return nullptr;
+  }
+  return &job;
+}
+
+void Scheduler::link(int index) {
+  Job& job = jobs[index];
+  uint32_t tick = (uint32_t)job.dueMs / SCHEDULER_TICK_MS;
+  if ((int32_t)(tick - (uint32_t)lastTick) < 0) {
+    // Already overdue: the current slot is walked again on the next pass
+    tick = lastTick;
+  }
+  job.slot = tick % SCHEDULER_WHEEL_SLOTS;
+  job.next = wheel[job.slot];
+  wheel[job.slot] = index;
+  job.linked = true;
+}
+
+void Scheduler::unlink(int index) {
+  Job& job = jobs[index];
+  if (!job.linked) {
+    return;
+  }
+  int8_t* prev = &wheel[job.slot];
+  while (*prev >= 0) {
+    if (*prev == index) {
+      *prev = job.next;
+      break;
+    }
+    prev = &jobs[*prev].next;
+  }
+  job.linked = false;
+}
+
+void Scheduler::wake() {
+  if (owner && xTaskGetCurrentTaskHandle() != owner) {
+    xTaskNotifyGive(owner);
+  }
+}
+
+int Scheduler::add(const char* name, unsigned long delayMs, unsigned long periodMs, SchedulerCallback callback,
+                   uint8_t priority, unsigned long deadlineMs) {
+  int id = -1;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < SCHEDULER_MAX_JOBS; i++) {
+    Job& job = jobs[i];
+    if (job.active) {
+      continue;
+    }
+    job.name = name;
+    job.callback = callback;
+    job.periodMs = periodMs;
+    job.dueMs = millis() + delayMs;
+    job.deadlineMs = deadlineMs;
+    job.priority = priority;
+    job.active = true;
+    job.rearmed = false;
+    job.generation++;
+    job.runs = 0;
+    job.misses = 0;
+    job.latenessMaxMs = 0;
+    job.runMaxMs = 0;
+    memset(job.lateness, 0, sizeof(job.lateness));
+    link(i);
+    id = job.generation * SCHEDULER_MAX_JOBS + i;
+    break;
+  }
+  xSemaphoreGive(mutex);
+
+  if (id < 0) {
+    Serial.printf("✗ Scheduler: no free slot for %s\n", name);
+  } else {
+    wake();
+  }
+  return id;
+}
+
+int Scheduler::every(const char* name, unsigned long periodMs, SchedulerCallback callback,
+                     uint8_t priority, unsigned long deadlineMs) {
+  return add(name, periodMs, periodMs, callback, priority, deadlineMs);
+}
+
+int Scheduler::after(const char* name, unsigned long delayMs, SchedulerCallback callback,
+                     uint8_t priority, unsigned long deadlineMs) {
+  return add(name, delayMs, 0, callback, priority, deadlineMs);
+}
+
+bool Scheduler::reschedule(int id, unsigned long delayMs) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  Job* job = find(id);
+  if (job) {
+    job->dueMs = millis() + delayMs;
+    if (job->linked) {
+      int index = job - jobs;
+      unlink(index);
+      link(index);
+    } else {
+      // Running right now; runDue() links it again afterwards
+      job->rearmed = true;
+    }
+  }
+  xSemaphoreGive(mutex);
+
+  if (job) {
+    wake();
+  }
+  return job != nullptr;
+}
+
+void Scheduler::cancel(int id) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  Job* job = find(id);
+  if (job) {
+    unlink(job - jobs);
+    job->active = false;
+    job->callback = nullptr;
+  }
+  xSemaphoreGive(mutex);
+}
+
+void Scheduler::record(Job& job, unsigned long latenessMs, unsigned long runMs) {
+  job.runs++;
+  if (latenessMs > job.latenessMaxMs) job.latenessMaxMs = latenessMs;
+  if (runMs > job.runMaxMs) job.runMaxMs = runMs;
+  if (job.deadlineMs != 0 && latenessMs > job.deadlineMs) {
+    job.misses++;
+  }
+
+  int bucket = 0;
+  while (bucket < SCHEDULER_HIST_BUCKETS - 1 && latenessMs >= latenessBoundsMs[bucket]) {
+    bucket++;
+  }
+  if (job.lateness[bucket] < UINT16_MAX) {
+    job.lateness[bucket]++;
+  }
+}
+
+unsigned long Scheduler::runDue() {
+  int8_t due[SCHEDULER_MAX_JOBS];
+  int dueCount = 0;
+  unsigned long now = millis();
+
+  // Walk every slot passed since the last call, at most one full turn. A slot
+  // also holds jobs for later turns, so each entry's due time is checked.
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  uint32_t nowTick = now / SCHEDULER_TICK_MS;
+  uint32_t span = nowTick - (uint32_t)lastTick;
+  if (span >= SCHEDULER_WHEEL_SLOTS) {
+    span = SCHEDULER_WHEEL_SLOTS - 1;
+  }
+  for (uint32_t i = 0; i <= span; i++) {
+    int8_t* prev = &wheel[(nowTick - span + i) % SCHEDULER_WHEEL_SLOTS];
+    while (*prev >= 0) {
+      int index = *prev;
+      Job& job = jobs[index];
+      if ((long)(now - job.dueMs) >= 0) {
+        *prev = job.next;
+        job.linked = false;
+        due[dueCount++] = index;
+      } else {
+        prev = &job.next;
+      }
+    }
+  }
+  lastTick = nowTick;
+
+  // Highest priority first, then earliest due
+  for (int i = 1; i < dueCount; i++) {
+    int8_t index = due[i];
+    int j = i - 1;
+    while (j >= 0 && (jobs[due[j]].priority > jobs[index].priority ||
+                      (jobs[due[j]].priority == jobs[index].priority &&
+                       (long)(jobs[due[j]].dueMs - jobs[index].dueMs) > 0))) {
+      due[j + 1] = due[j];
+      j--;
+    }
+    due[j + 1] = index;
+  }
+  xSemaphoreGive(mutex);
+
+  for (int i = 0; i < dueCount; i++) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    Job& job = jobs[due[i]];
+    if (!job.active) {
+      xSemaphoreGive(mutex);
+      continue;
+    }
+    SchedulerCallback callback = job.callback;
+    uint16_t generation = job.generation;
+    unsigned long start = millis();
+    unsigned long latenessMs = start - job.dueMs;
+    job.rearmed = false;
+    xSemaphoreGive(mutex);
+
+    // Run unlocked so callbacks can add, cancel or reschedule jobs
+    callback();
+    unsigned long end = millis();
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (job.active && job.generation == generation) {
+      record(job, latenessMs, end - start);
+      if (job.rearmed) {
+        link(due[i]);
+      } else if (job.periodMs != 0) {
+        // Skip whole periods missed while blocked instead of running them back to back
+        job.dueMs += job.periodMs;
+        if ((long)(end - job.dueMs) >= 0) {
+          job.dueMs = end + job.periodMs;
+        }
+        link(due[i]);
+      } else {
+        job.active = false;
+        job.callback = nullptr;
+      }
+    }
+    xSemaphoreGive(mutex);
+  }
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  unsigned long sleepMs = nextDueIn(millis());
+  xSemaphoreGive(mutex);
+  return sleepMs;
+}
+
+unsigned long Scheduler::nextDueIn(unsigned long now) {
+  // Walk the wheel forward from the last tick walked, where overdue jobs are
+  // linked too. The first slot holding a job due in this turn holds the
+  // earliest one; jobs for later turns only count if no slot does.
+  bool found = false;
+  unsigned long earliest = 0;
+  for (uint32_t i = 0; i < SCHEDULER_WHEEL_SLOTS; i++) {
+    uint32_t tick = (uint32_t)lastTick + i;
+    bool dueThisTurn = false;
+    for (int8_t index = wheel[tick % SCHEDULER_WHEEL_SLOTS]; index >= 0; index = jobs[index].next) {
+      const Job& job = jobs[index];
+      if ((int32_t)((uint32_t)job.dueMs / SCHEDULER_TICK_MS - tick) <= 0) {
+        dueThisTurn = true;
+      }
+      if (!found || (long)(job.dueMs - earliest) < 0) {
+        earliest = job.dueMs;
+        found = true;
+      }
+    }
+    if (dueThisTurn) {
+      break;
+    }
+  }
+
+  if (!found) {
+    return SCHEDULER_MAX_SLEEP_MS;
+  }
+  long untilDue = (long)(earliest - now);
+  if (untilDue <= 0) {
+    return 0;
+  }
+  return (unsigned long)untilDue < SCHEDULER_MAX_SLEEP_MS ? untilDue : SCHEDULER_MAX_SLEEP_MS;
+}
+
+void Scheduler::wait(unsigned long waitMs) {
+  if (waitMs == 0) {
+    return;
+  }
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+}
+
+void Scheduler::appendCounters(std::map<String, String>& out) {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  for (int i = 0; i < SCHEDULER_MAX_JOBS; i++) {
+    const Job& job = jobs[i];
+    if (!job.active || job.runs == 0) {
+      continue;
+    }
+    String prefix = String("sched_") + job.name + "_";
+    out[prefix + "runs"] = String(job.runs);
+    out[prefix + "late_max_ms"] = String(job.latenessMaxMs);
+    out[prefix + "run_max_ms"] = String(job.runMaxMs);
+    if (job.deadlineMs != 0) {
+      out[prefix + "misses"] = String(job.misses);
+    }
+
+    // Counts per lateness bucket: <1, <2, <5, ... <500, >=500 ms
+    String histogram;
+    for (int b = 0; b < SCHEDULER_HIST_BUCKETS; b++) {
+      if (b > 0) histogram += "/";
+      histogram += String(job.lateness[b]);
+    }
+    out[prefix + "late_hist"] = histogram;
+  }
+  xSemaphoreGive(mutex);
+}
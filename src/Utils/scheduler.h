@@ -0,0 +1,93 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <functional>
+#include <map>
+
+typedef std::function<void()> SchedulerCallback;
+
+// Order among jobs that fall due together
+enum SchedulerPriority {
+  SCHED_PRIORITY_HIGH = 0,
+  SCHED_PRIORITY_NORMAL,
+  SCHED_PRIORITY_LOW
+};
+
+// Lateness histogram upper bounds in ms; the last bucket is open-ended
+#define SCHEDULER_HIST_BUCKETS 10
+
+// Cooperative scheduler for the loop task. Jobs hang off a hashed timer wheel
+// of SCHEDULER_WHEEL_SLOTS slots, SCHEDULER_TICK_MS apart; runDue() walks the
+// slots passed since the last call and runs what is due, highest priority
+// first, then the task sleeps until the next due time, found by walking the
+// wheel forward to the first slot with a job due in this turn. Jobs may be
+// added or changed from any task: the table is mutex-guarded and the owner
+// is woken.
+class Scheduler {
+private:
+  struct Job {
+    const char* name;
+    SchedulerCallback callback;
+    unsigned long periodMs;     // 0 for one-shot jobs
+    unsigned long dueMs;
+    unsigned long deadlineMs;   // Lateness past this counts as a miss; 0 for none
+    uint8_t priority;
+    bool active;
+    bool linked;
+    bool rearmed;               // Rescheduled from inside its own callback
+    int8_t next;                // Next job in the same wheel slot
+    uint8_t slot;
+    uint16_t generation;
+
+    uint32_t runs;
+    uint32_t misses;
+    uint32_t latenessMaxMs;
+    uint32_t runMaxMs;
+    uint16_t lateness[SCHEDULER_HIST_BUCKETS];
+  };
+
+  Job jobs[SCHEDULER_MAX_JOBS];
+  int8_t wheel[SCHEDULER_WHEEL_SLOTS];
+  unsigned long lastTick;
+  SemaphoreHandle_t mutex;
+  TaskHandle_t owner;
+
+  int add(const char* name, unsigned long delayMs, unsigned long periodMs, SchedulerCallback callback,
+          uint8_t priority, unsigned long deadlineMs);
+  Job* find(int id);
+  void link(int index);
+  void unlink(int index);
+  void record(Job& job, unsigned long latenessMs, unsigned long runMs);
+  unsigned long nextDueIn(unsigned long now);
+  void wake();
+
+public:
+  Scheduler();
+
+  // Call from the task that will run loop(), before adding jobs
+  void begin();
+
+  // Returns a job ID, or -1 if the table is full
+  int every(const char* name, unsigned long periodMs, SchedulerCallback callback,
+            uint8_t priority = SCHED_PRIORITY_NORMAL, unsigned long deadlineMs = 0);
+  int after(const char* name, unsigned long delayMs, SchedulerCallback callback,
+            uint8_t priority = SCHED_PRIORITY_NORMAL, unsigned long deadlineMs = 0);
+
+  // Move the next run to delayMs from now; periodic jobs keep their period after it
+  bool reschedule(int id, unsigned long delayMs);
+  void cancel(int id);
+
+  // Run every due job; returns ms until the next one, at most SCHEDULER_MAX_SLEEP_MS
+  unsigned long runDue();
+
+  // Sleep for up to waitMs, or until a job is added from another task
+  void wait(unsigned long waitMs);
+
+  void appendCounters(std::map<String, String>& out);
+};
+
+extern Scheduler scheduler;
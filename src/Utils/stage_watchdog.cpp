@@ -0,0 +1,191 @@
+#include "stage_watchdog.h"
+
+StageWatchdog stageWatchdog;
+
+static const uint32_t stageBudgetsMs[WATCHDOG_STAGE_COUNT] = {
+  WATCHDOG_SAMPLE_BUDGET_MS,
+  WATCHDOG_CONDITION_BUDGET_MS,
+  WATCHDOG_ENCODE_BUDGET_MS,
+  WATCHDOG_MODEM_STEP_BUDGET_MS,
+  WATCHDOG_MODEM_WAKE_BUDGET_MS,
+  WATCHDOG_UPLOAD_BUDGET_MS,
+  WATCHDOG_REGISTRATION_BUDGET_MS,
+};
+
+const char* watchdogStageName(WatchdogStage stage) {
+  switch (stage) {
+  case WATCHDOG_SAMPLE:
+    return "sample";
+  case WATCHDOG_CONDITION:
+    return "condition";
+  case WATCHDOG_ENCODE:
+    return "encode";
+  case WATCHDOG_MODEM_STEP:
+    return "modem_step";
+  case WATCHDOG_MODEM_WAKE:
+    return "modem_wake";
+  case WATCHDOG_UPLOAD:
+    return "upload";
+  case WATCHDOG_REGISTRATION:
+    return "registration";
+  default:
+    return "unknown";
+  }
+}
+
+StageWatchdog::StageWatchdog()
+  : lock(portMUX_INITIALIZER_UNLOCKED), monitorHandle(nullptr),
+    lastOverrunStage(WATCHDOG_STAGE_COUNT), lastOverrunMs(0) {
+  memset(stages, 0, sizeof(stages));
+  for (int i = 0; i < WATCHDOG_STAGE_COUNT; i++) {
+    stages[i].budgetMs = stageBudgetsMs[i];
+  }
+}
+
+bool StageWatchdog::begin() {
+  if (monitorHandle) {
+    return true;
+  }
+
+  // Above the loop and pipeline tasks so a stage spinning on the CPU cannot starve it
+  if (xTaskCreatePinnedToCore(monitorTask, "watchdog", WATCHDOG_STACK, this, 5, &monitorHandle, WATCHDOG_CORE) != pdPASS) {
+    Serial.println("✗ Watchdog: failed to start monitor task");
+    return false;
+  }
+  Serial.println("✓ Stage watchdog started");
+  return true;
+}
+
+void StageWatchdog::setRecovery(WatchdogStage stage, WatchdogRecovery recover) {
+  portENTER_CRITICAL(&lock);
+  stages[stage].recover = recover;
+  portEXIT_CRITICAL(&lock);
+}
+
+// Stage state is only touched inside the critical section, so the monitor
+// never sees a run half-started or half-ended
+void StageWatchdog::enter(WatchdogStage stage) {
+  portENTER_CRITICAL(&lock);
+  StageState& s = stages[stage];
+  s.startedMs = millis();
+  s.hangAfterMs = s.budgetMs * WATCHDOG_HANG_FACTOR;
+  s.recovered = false;
+  s.armed = true;
+  portEXIT_CRITICAL(&lock);
+}
+
+bool StageWatchdog::leave(WatchdogStage stage) {
+  portENTER_CRITICAL(&lock);
+  StageState& s = stages[stage];
+  uint32_t elapsed = millis() - s.startedMs;
+  bool wasArmed = s.armed;
+  bool recovered = s.recovered;
+  bool overran = wasArmed && elapsed > s.budgetMs;
+  s.armed = false;
+  if (wasArmed) {
+    s.runs++;
+    if (elapsed > s.maxMs) s.maxMs = elapsed;
+    if (overran) {
+      s.overruns++;
+      lastOverrunStage = stage;
+      lastOverrunMs = elapsed;
+    }
+    if (!recovered) {
+      s.recoveriesInRow = 0;
+    }
+  }
+  portEXIT_CRITICAL(&lock);
+
+  if (overran) {
+    Serial.printf("✗ Watchdog: %s took %lu ms (budget %lu ms)\n", watchdogStageName(stage),
+                  (unsigned long)elapsed, (unsigned long)s.budgetMs);
+  }
+  return recovered;
+}
+
+bool StageWatchdog::isArmed(WatchdogStage stage) const {
+  return stages[stage].armed;
+}
+
+void StageWatchdog::monitorTask(void* arg) {
+  static_cast<StageWatchdog*>(arg)->runMonitor();
+}
+
+void StageWatchdog::runMonitor() {
+  TickType_t wake = xTaskGetTickCount();
+
+  for (;;) {
+    vTaskDelayUntil(&wake, pdMS_TO_TICKS(WATCHDOG_CHECK_MS));
+
+    for (int i = 0; i < WATCHDOG_STAGE_COUNT; i++) {
+      WatchdogStage stage = (WatchdogStage)i;
+      StageState& s = stages[i];
+
+      // A run still stuck after a recovery gets another one every hang
+      // period, and counts towards the escalation below
+      portENTER_CRITICAL(&lock);
+      uint32_t elapsed = millis() - s.startedMs;
+      bool hung = s.armed && elapsed > s.hangAfterMs;
+      WatchdogRecovery recover = s.recover;
+      if (hung) {
+        s.hangAfterMs = elapsed + s.budgetMs * WATCHDOG_HANG_FACTOR;
+        s.recovered = true;
+        s.recoveries++;
+        s.recoveriesInRow++;
+        lastOverrunStage = stage;
+        lastOverrunMs = elapsed;
+      }
+      uint8_t inRow = s.recoveriesInRow;
+      portEXIT_CRITICAL(&lock);
+
+      if (!hung) {
+        continue;
+      }
+
+      Serial.printf("✗ Watchdog: %s stuck for %lu ms (budget %lu ms)\n", watchdogStageName(stage),
+                    (unsigned long)elapsed, (unsigned long)s.budgetMs);
+      if (inRow > WATCHDOG_MAX_RECOVERIES) {
+        Serial.printf("✗ Watchdog: %s did not recover after %u attempts, restarting\n", watchdogStageName(stage),
+                      WATCHDOG_MAX_RECOVERIES);
+        delay(100);
+        ESP.restart();
+      }
+
+      if (recover && recover()) {
+        // The task running the stage was replaced; its leave() never comes,
+        // so the run is closed out here
+        portENTER_CRITICAL(&lock);
+        s.armed = false;
+        s.runs++;
+        s.overruns++;
+        if (elapsed > s.maxMs) s.maxMs = elapsed;
+        portEXIT_CRITICAL(&lock);
+      }
+    }
+  }
+}
+
+void StageWatchdog::appendCounters(std::map<String, String>& out) {
+  StageState snapshot[WATCHDOG_STAGE_COUNT];
+  portENTER_CRITICAL(&lock);
+  memcpy(snapshot, stages, sizeof(snapshot));
+  WatchdogStage lastStage = lastOverrunStage;
+  uint32_t lastMs = lastOverrunMs;
+  portEXIT_CRITICAL(&lock);
+
+  for (int i = 0; i < WATCHDOG_STAGE_COUNT; i++) {
+    const StageState& s = snapshot[i];
+    if (s.runs == 0 && s.recoveries == 0) {
+      continue;
+    }
+    String prefix = String("wd_") + watchdogStageName((WatchdogStage)i) + "_";
+    out[prefix + "overruns"] = String(s.overruns);
+    out[prefix + "max_ms"] = String(s.maxMs);
+    if (s.recoveries != 0) {
+      out[prefix + "recoveries"] = String(s.recoveries);
+    }
+  }
+  if (lastStage != WATCHDOG_STAGE_COUNT) {
+    out["wd_last_overrun"] = String(watchdogStageName(lastStage)) + ":" + String(lastMs);
+  }
+}
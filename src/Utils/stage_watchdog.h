@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../configs.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <map>
+
+// Blocking sections watched against a time budget
+enum WatchdogStage {
+  WATCHDOG_SAMPLE = 0,      // Sensor reads on the sampler task (HX711, TOF, ultrasonic)
+  WATCHDOG_CONDITION,
+  WATCHDOG_ENCODE,
+  WATCHDOG_MODEM_STEP,      // One bring-up step: testAT, SIM, registration, data attach
+  WATCHDOG_MODEM_WAKE,
+  WATCHDOG_UPLOAD,          // HTTPS post including the response body
+  WATCHDOG_REGISTRATION,    // Setup-status check against the backend
+  WATCHDOG_STAGE_COUNT
+};
+
+// Called from the monitor task when a stage has run for WATCHDOG_HANG_FACTOR
+// budgets. Returns true if the run was abandoned (its task restarted), false
+// if the stage is expected to return and call leave() by itself.
+typedef bool (*WatchdogRecovery)();
+
+// Each stage is bracketed by enter()/leave() from the task that runs it. Runs
+// over budget are counted when they end; a monitor task catches runs that do
+// not end and recovers them through the stage's hook instead of rebooting.
+// Only after WATCHDOG_MAX_RECOVERIES recoveries in a row without a clean run
+// does it fall back to a restart.
+class StageWatchdog {
+private:
+  struct StageState {
+    uint32_t budgetMs;
+    WatchdogRecovery recover;
+    volatile bool armed;
+    volatile uint32_t startedMs;
+    uint32_t hangAfterMs;       // Run time at which the next recovery fires
+    bool recovered;             // Recovery fired during the current run
+    uint8_t recoveriesInRow;
+
+    uint32_t runs;
+    uint32_t overruns;
+    uint32_t recoveries;
+    uint32_t maxMs;
+  };
+
+  StageState stages[WATCHDOG_STAGE_COUNT];
+  portMUX_TYPE lock;
+  TaskHandle_t monitorHandle;
+  WatchdogStage lastOverrunStage;
+  uint32_t lastOverrunMs;
+
+  static void monitorTask(void* arg);
+  void runMonitor();
+
+public:
+  StageWatchdog();
+
+  // Start the monitor task
+  bool begin();
+
+  void setRecovery(WatchdogStage stage, WatchdogRecovery recover);
+
+  void enter(WatchdogStage stage);
+
+  // Ends the run; returns true if the stage was recovered while it ran
+  bool leave(WatchdogStage stage);
+
+  // Whether the stage is between enter() and leave()
+  bool isArmed(WatchdogStage stage) const;
+
+  void appendCounters(std::map<String, String>& out);
+};
+
+extern StageWatchdog stageWatchdog;
+
+const char* watchdogStageName(WatchdogStage stage);
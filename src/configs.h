@@ -1,14 +1,14 @@
-// EEPROM Configuration
+// Legacy EEPROM layout, only read to migrate old devices into the config store
 #define EEPROM_SIZE 512           // Total EEPROM size
 #define SETUP_FLAG_ADDR 0         // Address for setup completion flag (uses 2 bytes)
-#define DEVICE_DATA_ADDR 4        // Start address for other device data (if needed)
+#define DEVICE_ID_ADDR 100        // Address for the 36-byte device UUID
 #define SETUP_MAGIC_NUMBER 0xABCD // Magic number to verify setup completion
 
-// Reserve specific EEPROM sections to avoid conflicts
-#define EEPROM_SETUP_SECTION_START 0
-#define EEPROM_SETUP_SECTION_SIZE 4   // 4 bytes for setup data
-#define EEPROM_USER_SECTION_START (EEPROM_SETUP_SECTION_START + EEPROM_SETUP_SECTION_SIZE)
-#define EEPROM_USER_SECTION_SIZE (EEPROM_SIZE - EEPROM_USER_SECTION_START)
+// Persistent config store (NVS)
+#define CONFIG_NAMESPACE "sed"
+#define CONFIG_KEY "cfg"
+#define CONFIG_SCHEMA_VERSION 2
+#define CONFIG_WRITEBACK_DELAY_MS 5000 // Coalesce non-critical writes for this long
 
 // Sensor Node Configuration
 #define FORCE0_ANALOG_PIN 35
@@ -36,8 +36,143 @@
 #define SETUP_SSID "SmartEchoDrain"
 #define SETUP_PASSWORD "echodrain25"
 #define SETUP_TIMEOUT 300000  // 5 minutes setup timeout
+#define SETUP_TIMEOUT_RECHECK_MS 10000 // Timeout postponed while a job runs or the live view is open
+#define SETUP_MODEM_POLL_MS 20       // Modem bring-up step period while the portal is up
+#define SETUP_JOB_SLOTS 4            // Backend requests queued or awaiting pickup
+#define SETUP_JOB_RESULT_TTL_MS 60000 // Unclaimed results are dropped after this
 
-// EEPROM addresses for storing setup completion flag
-#define EEPROM_SIZE 512
-#define SETUP_FLAG_ADDR 0
-#define SETUP_MAGIC_NUMBER 0xABCD
\ No newline at end of file
+// Live sensor stream on the setup portal (server-sent events at /events)
+#define LIVE_STREAM_ENABLED 1
+#define LIVE_STREAM_INTERVAL_MS 200    // Sampling period while a client is watching
+#define LIVE_STREAM_RING_SIZE 64       // Samples replayed to a new or reconnecting client
+#define LIVE_STREAM_MAX_QUEUED 8       // Skip samples while clients average this many queued events
+#define LIVE_STREAM_EVENT_MAX 128      // Formatted event size limit
+
+// Adaptive sampling policy (intervals in milliseconds)
+#define POLICY_FAST_SAMPLE_MS 1000
+#define POLICY_FAST_REPORT_MS 15000
+#define POLICY_NORMAL_SAMPLE_MS 5000
+#define POLICY_NORMAL_REPORT_MS 30000
+#define POLICY_SLOW_SAMPLE_MS 15000
+#define POLICY_SLOW_REPORT_MS 120000
+#define POLICY_SURVIVAL_SAMPLE_MS 60000
+#define POLICY_SURVIVAL_REPORT_MS 600000
+#define POLICY_WINDOW_SIZE 16          // Samples kept for variance estimation
+#define POLICY_DOWNSHIFT_HOLD 5        // Calm evaluations required before slowing down
+#define POLICY_RICH_BATTERY_PCT 60.0   // Above this the budget allows fast sampling
+#define POLICY_LOW_BATTERY_PCT 25.0    // Below this only slow sampling is allowed
+#define POLICY_SOLAR_MIN_W 0.5         // Solar input treated as "charging"
+#define POLICY_WEAK_SIGNAL_CSQ 10      // CSQ below this doubles the report period
+
+// Deep-sleep duty-cycle mode (wake, sample, buffer in RTC memory, sleep)
+#define DUTY_CYCLE_ENABLED 0           // Set to 1 to replace the always-on loop
+#define DUTY_CYCLE_SLEEP_MS 60000      // Deep-sleep period between samples
+#define DUTY_CYCLE_UPLOAD_EVERY 10     // Power the modem and upload every K wakes
+#define DUTY_CYCLE_BUFFER_SIZE 32      // Samples retained in RTC memory
+#define DUTY_CYCLE_EVENT_TOF_MM 50.0   // TOF jump that forces an early upload
+#define DUTY_CYCLE_EVENT_TURBIDITY 100.0 // Turbidity jump (NTU) that forces an early upload
+
+// Modem bring-up (milliseconds)
+#define MODEM_APN "internet"
+#define MODEM_RESET_PULSE_MS 2600      // Reset pulse width required by the A7670
+#define MODEM_AT_TIMEOUT_MS 20000
+#define MODEM_SIM_TIMEOUT_MS 30000
+#define MODEM_REGISTRATION_TIMEOUT_MS 60000
+#define MODEM_POLL_INTERVAL_MS 500
+#define MODEM_HEALTH_CHECK_MS 10000    // Connection check period once connected
+#define MODEM_BACKOFF_BASE_MS 5000     // First retry delay, doubled per failed attempt
+#define MODEM_BACKOFF_MAX_MS 120000
+#define MODEM_BOOT_MAX_ATTEMPTS 3      // Bring-up attempts per round; boot then samples offline and
+                                       // starts a new round after MODEM_BACKOFF_MAX_MS
+
+// Modem low-power between uploads
+// 0 = always on, 1 = DTR sleep, 2 = DTR sleep + PSM, 3 = DTR sleep + eDRX.
+// Modes 1-3 drive MODEM_DTR_PIN (GPIO 25 on the T-A7670), which this board
+// wires to ULTRASONIC_TRIG_PIN; move the trigger before enabling them.
+#define MODEM_LOW_POWER_MODE 0
+#define MODEM_WAKE_TIMEOUT_MS 3000
+#define MODEM_PSM_TAU "00100001"       // T3412 periodic TAU: 1 hour
+#define MODEM_PSM_ACTIVE "00000101"    // T3324 active time: 10 seconds
+#define MODEM_EDRX_VALUE "0101"        // eDRX cycle: 81.92 seconds
+#define MODEM_ACTIVE_MA 110.0          // Typical A7670 current while awake/transmitting
+#define MODEM_SLEEP_MA 2.5             // Typical A7670 current in DTR sleep
+
+// Energy model (typical currents at the battery, mA)
+#define ENERGY_CPU_ACTIVE_MA 50.0      // ESP32 at 240 MHz doing work
+#define ENERGY_CPU_IDLE_MA 20.0        // ESP32 idling in delay()
+#define ENERGY_SENSOR_MA 35.0          // TOF + HX711 + analog front ends while sampling
+#define ENERGY_MODEM_TX_MA 300.0       // A7670 average while an HTTPS request is in flight
+
+// Dynamic CPU frequency scaling
+#define CPU_IDLE_MHZ 80                // Waiting on sensors and the modem
+#define CPU_BOOST_MHZ 240              // Serialization and other CPU-bound work
+#define CPU_LIGHT_SLEEP_MIN_MS 50      // Shorter idle periods just delay()
+
+// Sensor pipeline: sample -> condition -> encode tasks, upload from the loop task
+#define PIPELINE_SENSOR_CORE 1         // The loop task (modem, uploads) runs on core 0
+#define PIPELINE_SAMPLE_QUEUE 16       // Raw samples awaiting conditioning
+#define PIPELINE_REPORT_QUEUE 2        // Reports awaiting encoding
+#define PIPELINE_PAYLOAD_QUEUE 4       // Encoded payloads awaiting upload
+#define PIPELINE_SAMPLER_STACK 4096
+#define PIPELINE_CONDITION_STACK 6144  // LittleFS appends
+#define PIPELINE_ENCODER_STACK 8192    // ArduinoJson and String building
+
+// Cooperative scheduler for the loop task (timer wheel)
+#define SCHEDULER_MAX_JOBS 16
+#define SCHEDULER_WHEEL_SLOTS 32
+#define SCHEDULER_TICK_MS 8            // Power of two so slots stay aligned across the millis() wrap
+#define SCHEDULER_MAX_SLEEP_MS 1000    // Longest the loop task sleeps without a due job
+#define BOOT_POLL_MS 10                // Modem bring-up step period in normal operation
+
+// Stage latency watchdog (budgets in milliseconds). Runs over budget are
+// counted; a run still going after WATCHDOG_HANG_FACTOR budgets is recovered
+// by resetting the modem, or flagged so the sampler drops the read and resets
+// the sensors once it returns. A read that never returns ends in a restart.
+#define WATCHDOG_ENABLED 1             // 0 keeps the counters but never recovers
+#define WATCHDOG_CORE 0                // Opposite the sampler so a spinning read cannot starve it
+#define WATCHDOG_STACK 3072
+#define WATCHDOG_CHECK_MS 500
+#define WATCHDOG_HANG_FACTOR 4
+#define WATCHDOG_MAX_RECOVERIES 3      // Recoveries in a row before falling back to a restart
+#define WATCHDOG_SAMPLE_BUDGET_MS 1500 // 10 HX711 conversions at 10 SPS plus the other sensors
+#define WATCHDOG_CONDITION_BUDGET_MS 250
+#define WATCHDOG_ENCODE_BUDGET_MS 500
+#define WATCHDOG_MODEM_STEP_BUDGET_MS 10000  // Data attach is the slowest single step
+#define WATCHDOG_MODEM_WAKE_BUDGET_MS (MODEM_WAKE_TIMEOUT_MS + 2000)
+#define WATCHDOG_UPLOAD_BUDGET_MS 20000
+#define WATCHDOG_REGISTRATION_BUDGET_MS 20000
+#define HX711_CONVERSION_MS 100        // 10 SPS
+#define HX711_READY_TIMEOUT_MS 200     // Two conversion periods at 10 SPS
+#define HX711_SAMPLE_READINGS 10       // Conversions averaged per sample, fewer for short sample periods
+#define HX711_TARE_READINGS 10         // Conversions averaged for the tare offset
+
+// Per-request network timing. Phase histograms per endpoint are kept since
+// boot and attached to telemetry at most every NET_TIMING_REPORT_MS.
+#define NET_TIMING_ENABLED 1
+#define NET_TIMING_HIST_BUCKETS 10         // Bounds 50/100/200/500 ms, 1/2/5/10/20 s, open-ended
+#define NET_TIMING_REPORT_MS (15 * 60 * 1000UL)
+
+// Telemetry log on LittleFS
+#define TELEMETRY_LOG_ENABLED 1
+#define TELEMETRY_LOG_DIR "/tlog"
+#define TELEMETRY_SEGMENT_RECORDS 256  // 40-byte records -> ~10 KB per segment
+#define TELEMETRY_MAX_SEGMENTS 32      // Oldest segments are dropped beyond this
+#define TELEMETRY_WRITE_BATCH 8        // Records buffered in RAM per flash write
+#define TELEMETRY_RETENTION_MS 604800000UL  // 7 days of log time
+
+// PSGC address lookup cache (RAM LRU + LittleFS)
+#define ADDRESS_CACHE_DIR "/addr"
+#define ADDRESS_CACHE_VERSION 1        // Bump to invalidate every cached response
+#define ADDRESS_CACHE_TTL_S 2592000UL  // 30 days; stale entries are still used if the fetch fails
+#define ADDRESS_CACHE_RAM_ENTRIES 8
+#define ADDRESS_CACHE_RAM_MAX_BYTES 8192  // Larger responses are only cached on flash
+#define ADDRESS_CACHE_MAX_FILES 96
+
+// Offline PSGC address index (tools/pack_addresses.py, flashed to its own partition)
+#define ADDRESS_INDEX_PARTITION "addridx"
+#define ADDRESS_INDEX_SUBTYPE 0x40
+
+// Owner list cache for the setup page (LittleFS)
+#define PROFILE_CACHE_DIR "/profiles"
+#define PROFILE_PAGE_SIZE 50           // Profiles requested per page
+#define PROFILE_MAX_PAGES 40           // Upper bound on pages fetched per refresh
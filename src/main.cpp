@@ -2,13 +2,28 @@
 #include "Utils/utilities.h"
 #include "Utils/device_id.h"
 #include "Setup/device_setup.h"
+#include "Setup/boot_sequence.h"
+#include "Modem/modem_manager.h"
+#include "Modem/modem_power.h"
 #include "Database/device_db.h"
 #include "Database/address.h"
+#include "Power/sampling_policy.h"
+#include "Power/duty_cycle.h"
+#include "Power/energy_model.h"
+#include "Power/cpu_frequency.h"
+#include "Storage/config_store.h"
+#include "Storage/telemetry_log.h"
+#include "Setup/live_stream.h"
+#include "Pipeline/sensor_pipeline.h"
+#include "Utils/scheduler.h"
+#include "Utils/stage_watchdog.h"
+#include "Utils/net_timing.h"
+#include "Sensors/conversion.h"
 #include <HX711.h>
 #include <Adafruit_VL53L0X.h>
 #include <WiFi.h>
 #include <esp32-hal-adc.h>
-#include <EEPROM.h>
+#include <freertos/semphr.h>
 
 // #define DUMP_AT_COMMANDS
 
@@ -40,12 +55,42 @@ TinyGsm modem(SerialAT);
 #endif
 
 TinyGsmClientSecure client(modem);
+ModemManager modemManager(&modem);
+BootSequence bootSequence(&modemManager);
+ModemPowerManager modemPower(&modem);
 
 // Global objects
 DeviceSetup* deviceSetup = nullptr;
 DeviceDB* deviceDB = nullptr;
 AddressDB* addressDB = nullptr;
 String deviceId;
+SamplingPolicy samplingPolicy;
+DutyCycle dutyCycle;
+EnergyModel energyModel;
+bool modemReady = false;
+bool pendingInitialReport = false;
+bool registrationCheckPending = false;
+int bootJob = -1;
+
+// Link state and counters owned by the loop task (modem, power, boot, log);
+// the pipeline copies them into each report it encodes
+struct UplinkSnapshot {
+  float signalStrength = -999;
+  String modemState = "disconnected";
+  std::map<String, String> counters;
+};
+UplinkSnapshot uplink;
+SemaphoreHandle_t uplinkMutex = nullptr;
+
+// Policy outputs and flash log counters published by the conditioner, the only
+// task that feeds either; the other tasks read this copy instead
+struct PolicySnapshot {
+  unsigned long sampleIntervalMs = POLICY_NORMAL_SAMPLE_MS;
+  unsigned long reportIntervalMs = POLICY_NORMAL_REPORT_MS;
+  std::map<String, String> counters;
+};
+PolicySnapshot policy;
+SemaphoreHandle_t policyMutex = nullptr;
 
 // Sensor objects
 HX711 weightSensor;
@@ -53,13 +98,32 @@ Adafruit_VL53L0X tofSensor = Adafruit_VL53L0X();
 
 // Function declarations
 bool initializeModem();
-bool initializeSensors();
+void handleBoot();
+void restartModem();
+bool recoverModem();
+void resetSensors();
+bool handleRegistrationStatus(SetupStatus status);
+bool initializeSensors(bool tareScale = true);
 DeviceData collectSensorData();
+SensorSample readSensors(uint8_t weightReadings);
+uint8_t weightReadingsFor(unsigned long sampleIntervalMs);
+bool readWeight(uint8_t readings, float& units, int32_t& raw);
+bool tareWeight(uint8_t readings);
+DeviceData buildDeviceData(const SensorSample& sample);
+void conditionSample(const SensorSample& sample);
+void publishPolicy();
+unsigned long policySampleIntervalMs();
+unsigned long policyReportIntervalMs();
+String encodeReport(const PipelineReport& report);
+void uploadPayload(PipelinePayload& payload);
+void refreshUplink();
+void printSensorReadings(const DeviceData& data);
+void runDutyCycle();
+bool uploadBufferedSamples(const DeviceData& latest);
 float readForce(int pin);
 float readTurbidity();
 float readUltrasonic();
 float getBatteryVoltage();
-float getBatteryPercentage(float voltage);
 float getSolarVoltage();
 float getCPUTemperature();
 float getCPUFrequency();
@@ -70,18 +134,21 @@ unsigned long getUptime();
 
 void setup() {
   Serial.begin(115200);
-  delay(1000);
+  cpuFrequency.begin();
 
   Serial.println("=== Smart Echo Drain ESP32 Starting ===");
   Serial.printf("Device Version: %s\n", DEVICE_VERSION);
   Serial.printf("API Key: %s\n", ESP32_API_KEY);
   
-  // Initialize EEPROM early to preserve data
-  EEPROM.begin(EEPROM_SIZE);
+  // Load persistent config once; everything else reads the RAM cache
+  configStore.begin();
   
-  // Check and log current EEPROM state
-  uint16_t currentSetupFlag = (EEPROM.read(SETUP_FLAG_ADDR) << 8) | EEPROM.read(SETUP_FLAG_ADDR + 1);
-  Serial.printf("Current setup flag in EEPROM: 0x%04X\n", currentSetupFlag);
+  // Shared with the encoder task; made here, not in a static initializer
+  uplinkMutex = xSemaphoreCreateMutex();
+
+  // Everything periodic on this task runs from the scheduler in loop()
+  scheduler.begin();
+  scheduler.every("config", 1000, []() { configStore.loop(); }, SCHED_PRIORITY_LOW);
   
   // Initialize ADC for battery monitoring
   analogSetAttenuation(ADC_11db);
@@ -90,102 +157,313 @@ void setup() {
   analogSetWidth(12);
 #endif
 
-#ifdef BOARD_POWERON_PIN
-  pinMode(BOARD_POWERON_PIN, OUTPUT);
-  digitalWrite(BOARD_POWERON_PIN, HIGH);
-#endif
-  
   // Generate or get device ID
   deviceId = getOrGenerateDeviceId();
   Serial.printf("Device ID: %s\n", deviceId.c_str());
 
-  // Initialize sensors
-  if (!initializeSensors()) {
-    Serial.println("Warning: Some sensors failed to initialize");
-  }
-
- deviceSetup = new DeviceSetup(deviceId, &modem, &client);
+ deviceSetup = new DeviceSetup(deviceId, &modem, &client, &modemManager);
 
   // Check if device setup is already completed with additional verification
-  bool eepromSetupComplete = deviceSetup->isSetupCompleted();
-  Serial.printf("EEPROM setup status: %s\n", eepromSetupComplete ? "COMPLETED" : "NOT COMPLETED");
+  bool storedSetupComplete = deviceSetup->isSetupCompleted();
+  Serial.printf("Stored setup status: %s\n", storedSetupComplete ? "COMPLETED" : "NOT COMPLETED");
   
-  if (eepromSetupComplete) {
+  if (storedSetupComplete) {
     Serial.println("Device setup already completed. Initializing normal operation...");
 
-    // Initialize modem for normal operation
-    if (initializeModem()) {
-      // Initialize database connections
-      deviceDB = new DeviceDB(&modem, &client);
-      addressDB = new AddressDB(&modem, &client);
-      
-      // Check if device exists in database
-      if (deviceSetup->checkDeviceSetupStatus()) {
-        Serial.println("✓ Device verified in database");
-        Serial.printf("Device Name: %s\n", deviceSetup->getDeviceName().c_str());
-        Serial.printf("Location: %s\n", deviceSetup->getDeviceLocation().c_str());
-        
-        // Send initial device data
-        DeviceData initialData = collectSensorData();
-        int result = deviceDB->createDeviceData(initialData);
-        Serial.printf("Initial device data sent - Status: %d\n", result);
-      } else {
-        Serial.println("Device not found in database. Starting setup mode...");
-        deviceSetup->resetSetupFlag();
-        deviceSetup->startSetupMode();
-      }
-    } else {
-      Serial.println("Failed to initialize modem. Starting setup mode...");
-      deviceSetup->startSetupMode();
+#if DUTY_CYCLE_ENABLED
+    // Sample, buffer and go back to sleep; never returns
+    runDutyCycle();
+#endif
+
+#if TELEMETRY_LOG_ENABLED
+    telemetryLog.begin();
+    telemetryLog.compact();
+#endif
+
+#if WATCHDOG_ENABLED
+    // Hung modem exchanges end in a modem reset. A hung sensor read has no
+    // hook: the sampler drops it and resets the sensors once it returns.
+    stageWatchdog.setRecovery(WATCHDOG_MODEM_STEP, recoverModem);
+    stageWatchdog.setRecovery(WATCHDOG_MODEM_WAKE, recoverModem);
+    stageWatchdog.setRecovery(WATCHDOG_UPLOAD, recoverModem);
+    stageWatchdog.setRecovery(WATCHDOG_REGISTRATION, recoverModem);
+    stageWatchdog.begin();
+#endif
+
+    // Start the modem reset pulse first so sensor bring-up overlaps with it;
+    // registration and the setup-status check continue from the boot job
+    bootSequence.begin();
+    bootJob = scheduler.every("boot", BOOT_POLL_MS, handleBoot, SCHED_PRIORITY_HIGH);
+
+    unsigned long sensorStart = millis();
+    if (!initializeSensors()) {
+      Serial.println("Warning: Some sensors failed to initialize");
+    }
+    bootSequence.recordPhase(BOOT_SENSORS, millis() - sensorStart);
+
+    // Sampling runs on the sensor core from here on; loop() only uploads
+    policyMutex = xSemaphoreCreateMutex();
+    publishPolicy();
+    PipelineHooks hooks = {
+      []() { return readSensors(weightReadingsFor(policySampleIntervalMs())); },
+      conditionSample,
+      encodeReport,
+      policySampleIntervalMs,
+      policyReportIntervalMs,
+      resetSensors,
+    };
+    if (!sensorPipeline.begin(hooks)) {
+      Serial.println("✗ Sensor pipeline failed to start; no data will be reported");
     }
   } else {
+#ifdef BOARD_POWERON_PIN
+    pinMode(BOARD_POWERON_PIN, OUTPUT);
+    digitalWrite(BOARD_POWERON_PIN, HIGH);
+#endif
+
+    // Initialize sensors
+    if (!initializeSensors()) {
+      Serial.println("Warning: Some sensors failed to initialize");
+    }
+
+#if LIVE_STREAM_ENABLED
+    // Sample for the portal's live view only while someone is watching
+    scheduler.every("live", LIVE_STREAM_INTERVAL_MS, []() {
+      if (liveStream.hasClients()) {
+        liveStream.push(readSensors(1).record);
+      }
+    });
+#endif
+
     Serial.println("Device not configured. Starting setup mode...");
     deviceSetup->startSetupMode();
   }
 }
 
 void loop() {
-  if (deviceSetup && deviceSetup->isInSetupMode()) {
-    // Handle setup mode
-    deviceSetup->loop();
-  } else {
-    // Normal operation mode
-    static unsigned long lastDataSend = 0;
-    
-    // Send sensor data every 30 seconds (adjustable based on your needs)
-    if (millis() - lastDataSend > 30000) {
-      if (deviceDB) {
-        // Collect real sensor data
-        DeviceData sensorData = collectSensorData();
-        
-        // Send data to database
-        int result = deviceDB->createDeviceData(sensorData);
-        Serial.printf("Sensor data sent - Status: %d\n", result);
-        
-        // Print sensor readings for debugging
-        Serial.println("\n=== Sensor Readings ===");
-        Serial.printf("Battery: %.2fV (%.1f%%)\n", sensorData.batteryVoltage, sensorData.batteryPercentage);
-        Serial.printf("Solar: %.2fW\n", sensorData.solarWattage);
-        Serial.printf("TOF: %.2f mm\n", sensorData.tof);
-        Serial.printf("Force0: %.2f N\n", sensorData.force0);
-        Serial.printf("Force1: %.2f N\n", sensorData.force1);
-        Serial.printf("Weight: %.2f kg\n", sensorData.weight);
-        Serial.printf("Turbidity: %.2f NTU\n", sensorData.turbidity);
-        Serial.printf("Ultrasonic: %.2f cm\n", sensorData.ultrasonic);
-        Serial.printf("CPU Temp: %.1f°C\n", sensorData.cpuTemperature);
-        Serial.printf("RAM Usage: %.1f%%\n", sensorData.ramUsage);
-        Serial.printf("Signal: %.1f dBm\n", sensorData.signalStrength);
-        Serial.printf("Uptime: %lu ms\n", sensorData.uptimeMs);
-        Serial.println("========================\n");
-      }
-      lastDataSend = millis();
+  unsigned long idleMs = scheduler.runDue();
+
+  // Setup mode, the modem is still booting or the pipeline never started:
+  // nothing to upload yet
+  if (deviceSetup->isInSetupMode() || !deviceDB || !modemReady || !sensorPipeline.isRunning()) {
+    scheduler.wait(idleMs);
+    return;
+  }
+
+  // Normal operation: the pipeline samples, conditions and encodes on the
+  // sensor core; this task owns the modem and uploads what it produces,
+  // waking for the next scheduled job if no payload arrives first
+  if (pendingInitialReport) {
+    sensorPipeline.requestReport();
+    pendingInitialReport = false;
+  }
+
+  // Modem asleep and the pipeline between samples: light-sleep through the
+  // gap, since no payload can turn up before the next read anyway
+  unsigned long quietMs = min(idleMs, sensorPipeline.quietForMs());
+  if (modemPower.isAsleep() && quietMs >= CPU_LIGHT_SLEEP_MIN_MS) {
+    cpuFrequency.idle(quietMs, true);
+    return;
+  }
+
+  PipelinePayload payload;
+  if (sensorPipeline.receive(payload, pdMS_TO_TICKS(idleMs))) {
+    uploadPayload(payload);
+  }
+}
+
+void uploadPayload(PipelinePayload& payload) {
+  unsigned long workStart = millis();
+  
+  // Close the energy cycle that ended with this report; sensor and CPU time
+  // spent by the pipeline tasks comes from their stage counters
+  static unsigned long lastModemAwakeMs = 0;
+  static unsigned long lastModemSleepMs = 0;
+  static unsigned long uploadMs = 0;
+  static uint32_t lastSensorMs = 0;
+  static uint32_t lastPipelineCpuMs = 0;
+  static uint32_t lastSamples = 0;
+  const PipelineStageStats& sampled = sensorPipeline.getStats(PIPELINE_SAMPLE);
+  uint32_t pipelineCpuMs = sensorPipeline.getStats(PIPELINE_CONDITION).busyTotalMs +
+                           sensorPipeline.getStats(PIPELINE_ENCODE).busyTotalMs;
+  energyModel.addPhase(ENERGY_SENSORS, sampled.busyTotalMs - lastSensorMs);
+  energyModel.addPhase(ENERGY_CPU_ACTIVE, pipelineCpuMs - lastPipelineCpuMs);
+  energyModel.addSample(sampled.items - lastSamples);
+  lastSensorMs = sampled.busyTotalMs;
+  lastPipelineCpuMs = pipelineCpuMs;
+  lastSamples = sampled.items;
+  
+  unsigned long modemAwakeMs = modemPower.getAwakeMs() - lastModemAwakeMs;
+  energyModel.addPhase(ENERGY_MODEM_AWAKE, modemAwakeMs > uploadMs ? modemAwakeMs - uploadMs : 0);
+  energyModel.addPhase(ENERGY_MODEM_TX, uploadMs);
+  energyModel.addPhase(ENERGY_MODEM_SLEEP, modemPower.getSleepMs() - lastModemSleepMs);
+  energyModel.closeCycle(payload.record.batteryVoltage, payload.record.solarWattage);
+  lastModemAwakeMs = modemPower.getAwakeMs();
+  lastModemSleepMs = modemPower.getSleepMs();
+  
+  // Send data to database, keeping the modem asleep in between
+  stageWatchdog.enter(WATCHDOG_MODEM_WAKE);
+  modemPower.wake();
+  bool modemRecovered = stageWatchdog.leave(WATCHDOG_MODEM_WAKE);
+  modemPower.beginUpload();
+  unsigned long uploadStart = millis();
+  stageWatchdog.enter(WATCHDOG_UPLOAD);
+  int result = deviceDB->postDeviceData(payload.json, payload.length);
+  modemRecovered |= stageWatchdog.leave(WATCHDOG_UPLOAD);
+  uploadMs = millis() - uploadStart;
+  energyModel.addBytes(payload.length);
+  modemPower.endUpload(payload.record.batteryVoltage);
+  sensorPipeline.release(payload, uploadMs);
+  Serial.printf("Sensor data sent - Status: %d\n", result);
+  
+  if (modemRecovered) {
+    restartModem();
+    return;
+  }
+  
+  // Background revalidation of the cached registration
+  if (registrationCheckPending && result > 0) {
+    stageWatchdog.enter(WATCHDOG_REGISTRATION);
+    SetupStatus status = deviceSetup->checkDeviceSetupStatus();
+    if (stageWatchdog.leave(WATCHDOG_REGISTRATION)) {
+      restartModem();
+      return;
     }
-    
-    delay(1000); // Small delay to prevent overwhelming the system
+    if (!handleRegistrationStatus(status)) {
+      return;
+    }
+  }
+  
+  // Signal and counters for the next report, read while the modem is awake
+  refreshUplink();
+  modemPower.sleep();
+  
+  energyModel.addPhase(ENERGY_CPU_ACTIVE, millis() - workStart);
+}
+
+void refreshUplink() {
+  UplinkSnapshot next;
+  next.signalStrength = getSignalStrength();
+  if (modemPower.isAsleep()) {
+    next.modemState = "sleeping";
+  } else {
+    next.modemState = (modemReady && modem.isNetworkConnected()) ? "connected" : "disconnected";
   }
+  
+  energyModel.appendCounters(next.counters);
+  cpuFrequency.appendCounters(next.counters);
+  bootSequence.appendTimings(next.counters);
+  modemPower.appendCounters(next.counters);
+  scheduler.appendCounters(next.counters);
+  stageWatchdog.appendCounters(next.counters);
+  netTiming.appendCounters(next.counters);
+  
+  xSemaphoreTake(uplinkMutex, portMAX_DELAY);
+  uplink = next;
+  xSemaphoreGive(uplinkMutex);
 }
 
-bool initializeSensors() {
+// Conditioner stage: feed the sampling policy, the flash log and the live view
+void conditionSample(const SensorSample& sample) {
+  DeviceData data;
+  applySampleRecord(sample.record, data);
+  data.batteryPercentage = getBatteryPercentage(data.batteryVoltage);
+  data.batteryStatus = batteryStatusFor(data.batteryVoltage);
+  xSemaphoreTake(uplinkMutex, portMAX_DELAY);
+  data.signalStrength = uplink.signalStrength;
+  xSemaphoreGive(uplinkMutex);
+  
+#if TELEMETRY_LOG_ENABLED
+  telemetryLog.append(sample.record);
+#endif
+  samplingPolicy.addSample(data);
+  samplingPolicy.evaluate();
+  publishPolicy();
+#if LIVE_STREAM_ENABLED
+  liveStream.push(sample.record);
+#endif
+  bootSequence.markFirstSample();
+}
+
+void publishPolicy() {
+  PolicySnapshot next;
+  next.sampleIntervalMs = samplingPolicy.getSampleIntervalMs();
+  next.reportIntervalMs = samplingPolicy.getReportIntervalMs();
+  samplingPolicy.appendCounters(next.counters);
+#if TELEMETRY_LOG_ENABLED
+  // The log belongs to the conditioner once the pipeline runs, so its
+  // counters travel with the policy rather than the uplink snapshot
+  telemetryLog.appendCounters(next.counters);
+#endif
+
+  xSemaphoreTake(policyMutex, portMAX_DELAY);
+  policy = next;
+  xSemaphoreGive(policyMutex);
+}
+
+unsigned long policySampleIntervalMs() {
+  xSemaphoreTake(policyMutex, portMAX_DELAY);
+  unsigned long interval = policy.sampleIntervalMs;
+  xSemaphoreGive(policyMutex);
+  return interval;
+}
+
+unsigned long policyReportIntervalMs() {
+  xSemaphoreTake(policyMutex, portMAX_DELAY);
+  unsigned long interval = policy.reportIntervalMs;
+  xSemaphoreGive(policyMutex);
+  return interval;
+}
+
+// Encoder stage: full telemetry frame for the latest sample of the window
+String encodeReport(const PipelineReport& report) {
+  DeviceData data = buildDeviceData(report.sample);
+  data.deviceOtherData["window_samples"] = String(report.windowSamples);
+  sensorPipeline.appendCounters(data.deviceOtherData);
+  
+  xSemaphoreTake(policyMutex, portMAX_DELAY);
+  for (const auto& counter : policy.counters) {
+    data.deviceOtherData[counter.first] = counter.second;
+  }
+  xSemaphoreGive(policyMutex);
+  
+  xSemaphoreTake(uplinkMutex, portMAX_DELAY);
+  for (const auto& counter : uplink.counters) {
+    data.deviceOtherData[counter.first] = counter.second;
+  }
+  xSemaphoreGive(uplinkMutex);
+  
+  printSensorReadings(data);
+  
+  CpuBoostLock boost;
+  return createDeviceDataJSON(data);
+}
+
+void printSensorReadings(const DeviceData& data) {
+  Serial.println("\n=== Sensor Readings ===");
+  // Policy state as reported in this frame
+  auto counter = [&](const char* key) {
+    auto it = data.deviceOtherData.find(key);
+    return it != data.deviceOtherData.end() ? it->second.c_str() : "-";
+  };
+  Serial.printf("Policy: %s (sample %s ms, report %s ms)\n", counter("policy_mode"),
+                counter("policy_sample_ms"), counter("policy_report_ms"));
+  Serial.printf("Battery: %.2fV (%.1f%%)\n", data.batteryVoltage, data.batteryPercentage);
+  Serial.printf("Solar: %.2fW\n", data.solarWattage);
+  Serial.printf("TOF: %.2f mm\n", data.tof);
+  Serial.printf("Force0: %.2f N\n", data.force0);
+  Serial.printf("Force1: %.2f N\n", data.force1);
+  Serial.printf("Weight: %.2f kg\n", data.weight);
+  Serial.printf("Turbidity: %.2f NTU\n", data.turbidity);
+  Serial.printf("Ultrasonic: %.2f cm\n", data.ultrasonic);
+  Serial.printf("CPU Temp: %.1f°C\n", data.cpuTemperature);
+  Serial.printf("RAM Usage: %.1f%%\n", data.ramUsage);
+  Serial.printf("Signal: %.1f dBm\n", data.signalStrength);
+  Serial.printf("Uptime: %lu ms\n", data.uptimeMs);
+  Serial.println("========================\n");
+}
+
+bool initializeSensors(bool tareScale) {
   Serial.println("\n=== Initializing Sensors ===");
   bool success = true;
   
@@ -211,9 +489,11 @@ bool initializeSensors() {
   
   // Initialize weight sensor (HX711)
   weightSensor.begin(WEIGHT_DATA_PIN, WEIGHT_SCK_PIN);
+  weightSensor.set_scale(2280.f); // Calibration factor - adjust based on your setup
   if (weightSensor.is_ready()) {
-    weightSensor.set_scale(2280.f); // Calibration factor - adjust based on your setup
-    weightSensor.tare(); // Reset the scale to 0
+    if (tareScale) {
+      weightSensor.tare(); // Reset the scale to 0
+    }
     Serial.println("Weight sensor initialized successfully");
   } else {
     Serial.println("Failed to initialize weight sensor");
@@ -235,70 +515,142 @@ bool initializeSensors() {
   return success;
 }
 
+// Sampler hook after a read the watchdog flagged as hung. Runs on the sampler,
+// the only task on these sensors while the pipeline runs, so no transfer is
+// in flight when the I2C driver is reinstalled and the HX711 power-cycled.
+void resetSensors() {
+  weightSensor.power_down();
+  Wire.end();
+  Wire.begin(TOF_SDA_PIN, TOF_SCL_PIN);
+  if (tofSensor.begin()) {
+    tofSensor.setMeasurementTimingBudgetMicroSeconds(30000);
+    tofSensor.startRangeContinuous();
+  } else {
+    Serial.println("✗ TOF sensor did not come back after the I2C reset");
+  }
+  weightSensor.power_up();
+}
+
 DeviceData collectSensorData() {
+  return buildDeviceData(readSensors(HX711_SAMPLE_READINGS));
+}
+
+// HX711 conversions averaged per sample: up to HX711_SAMPLE_READINGS, but no
+// more than fit in half the sample period, so a fast policy period is not
+// overrun by the weight read alone
+uint8_t weightReadingsFor(unsigned long sampleIntervalMs) {
+  unsigned long fit = sampleIntervalMs / 2 / HX711_CONVERSION_MS;
+  if (fit < 1) {
+    return 1;
+  }
+  return fit < HX711_SAMPLE_READINGS ? fit : HX711_SAMPLE_READINGS;
+}
+
+// Read every sensor once. The TOF runs in continuous mode, so this takes its
+// last completed range instead of blocking on a new one.
+SensorSample readSensors(uint8_t weightReadings) {
+  static float lastTof = -1;
+  static uint8_t lastTofStatus = 4;
+  if (tofSensor.isRangeComplete()) {
+    uint16_t range = tofSensor.readRangeResult();
+    lastTofStatus = tofSensor.readRangeStatus();
+    lastTof = lastTofStatus != 4 ? range : -1;  // phase failures have incorrect data
+  }
+  
+  SensorSample sample;
+  sample.record.timestampMs = millis();
+  sample.record.tof = lastTof;
+  sample.tofStatus = lastTofStatus;
+  
+  sample.force0Raw = analogRead(FORCE0_ANALOG_PIN);
+  sample.force1Raw = analogRead(FORCE1_ANALOG_PIN);
+  sample.turbidityRaw = analogRead(TURBIDITY_ANALOG_PIN);
+  sample.record.force0 = readForce(FORCE0_ANALOG_PIN);
+  sample.record.force1 = readForce(FORCE1_ANALOG_PIN);
+  
+  sample.weightReady = weightSensor.is_ready() &&
+                       readWeight(weightReadings, sample.record.weight, sample.weightRaw);
+  if (!sample.weightReady) {
+    sample.record.weight = 0.0;
+    sample.weightRaw = 0;
+  }
+  
+  sample.record.turbidity = readTurbidity();
+  sample.record.ultrasonic = readUltrasonic();
+  sample.record.batteryVoltage = getBatteryVoltage();
+  sample.record.solarWattage = getSolarVoltage();
+  sample.queuedAtMs = 0;
+  return sample;
+}
+
+// Average of up to `readings` conversions. Unlike get_units(), which waits
+// forever for each one, every conversion gets HX711_READY_TIMEOUT_MS; a chip
+// that stops answering mid-burst yields the readings taken so far.
+bool readWeight(uint8_t readings, float& units, int32_t& raw) {
+  int64_t sum = 0;
+  uint8_t taken = 0;
+  while (taken < readings && weightSensor.wait_ready_timeout(HX711_READY_TIMEOUT_MS)) {
+    sum += weightSensor.read();
+    taken++;
+  }
+  if (taken == 0) {
+    return false;
+  }
+  
+  raw = sum / taken - weightSensor.get_offset();
+  units = raw / weightSensor.get_scale();
+  return true;
+}
+
+// Zero the scale from `readings` conversions under the same per-conversion
+// timeout as readWeight(). The offset is only replaced when all of them came in.
+bool tareWeight(uint8_t readings) {
+  int64_t sum = 0;
+  uint8_t taken = 0;
+  while (taken < readings && weightSensor.wait_ready_timeout(HX711_READY_TIMEOUT_MS)) {
+    sum += weightSensor.read();
+    taken++;
+  }
+  if (taken < readings) {
+    return false;
+  }
+
+  weightSensor.set_offset(sum / taken);
+  return true;
+}
+
+// Full telemetry frame around a sensor sample. Touches no hardware besides
+// the chip itself; modem state comes from the uplink snapshot.
+DeviceData buildDeviceData(const SensorSample& sample) {
   DeviceData data;
   
   // Basic device info
   data.deviceId = deviceId;
   data.isOnline = true;
-  data.createdAt = String(millis());
-  data.lastUpdatedAt = String(millis());
+  applySampleRecord(sample.record, data);
   
   // System monitoring
   data.cpuTemperature = getCPUTemperature();
   data.cpuFrequency = getCPUFrequency();
   data.ramUsage = getRAMUsage();
   data.storageUsage = getStorageUsage();
-  data.signalStrength = getSignalStrength();
   data.uptimeMs = getUptime();
   
   // Battery monitoring
-  data.batteryVoltage = getBatteryVoltage();
   data.batteryPercentage = getBatteryPercentage(data.batteryVoltage);
-  data.solarWattage = getSolarVoltage();
-  
-  // Set battery status based on voltage
-  if (data.batteryVoltage > 4.0) {
-    data.batteryStatus = "good";
-  } else if (data.batteryVoltage > 3.7) {
-    data.batteryStatus = "medium";
-  } else if (data.batteryVoltage > 3.3) {
-    data.batteryStatus = "low";
-  } else {
-    data.batteryStatus = "critical";
-  }
-  
-  // TOF sensor reading (Adafruit VL53L0X)
-  VL53L0X_RangingMeasurementData_t measure;
-  tofSensor.rangingTest(&measure, false); // pass in 'true' to get debug data printed
-  
-  if (measure.RangeStatus != 4) {  // phase failures have incorrect data
-    data.tof = measure.RangeMilliMeter;
-  } else {
-    data.tof = -1; // Sensor error/timeout
-  }
-  
-  // Other sensor readings
-  data.force0 = readForce(FORCE0_ANALOG_PIN);
-  data.force1 = readForce(FORCE1_ANALOG_PIN);
-  
-  if (weightSensor.is_ready()) {
-    data.weight = weightSensor.get_units(10); // Average of 10 readings
-  } else {
-    data.weight = 0.0;
-  }
-  
-  data.turbidity = readTurbidity();
-  data.ultrasonic = readUltrasonic();
+  data.batteryStatus = batteryStatusFor(data.batteryVoltage);
   
   // Device status information
-  data.deviceStatus["modem"] = modem.isNetworkConnected() ? "connected" : "disconnected";
+  xSemaphoreTake(uplinkMutex, portMAX_DELAY);
+  data.signalStrength = uplink.signalStrength;
+  data.deviceStatus["modem"] = uplink.modemState;
+  xSemaphoreGive(uplinkMutex);
   data.deviceStatus["sensors"] = "active";
   data.deviceStatus["power"] = data.batteryVoltage > 3.3 ? "normal" : "low";
   
   // Module status information
-  data.moduleStatus["tof"] = (measure.RangeStatus != 4) ? "online" : "error";
-  data.moduleStatus["weight"] = weightSensor.is_ready() ? "online" : "offline";
+  data.moduleStatus["tof"] = (sample.tofStatus != 4) ? "online" : "error";
+  data.moduleStatus["weight"] = sample.weightReady ? "online" : "offline";
   data.moduleStatus["force"] = "online";
   data.moduleStatus["turbidity"] = "online";
   data.moduleStatus["ultrasonic"] = "online";
@@ -309,31 +661,21 @@ DeviceData collectSensorData() {
   data.deviceOtherData["sdk_version"] = ESP.getSdkVersion();
   
   // Additional module data
-  data.moduleOtherData["force0_raw"] = String(analogRead(FORCE0_ANALOG_PIN));
-  data.moduleOtherData["force1_raw"] = String(analogRead(FORCE1_ANALOG_PIN));
-  data.moduleOtherData["turbidity_raw"] = String(analogRead(TURBIDITY_ANALOG_PIN));
-  data.moduleOtherData["weight_raw"] = String(weightSensor.get_value());
-  data.moduleOtherData["tof_status"] = String(measure.RangeStatus);
+  data.moduleOtherData["force0_raw"] = String(sample.force0Raw);
+  data.moduleOtherData["force1_raw"] = String(sample.force1Raw);
+  data.moduleOtherData["turbidity_raw"] = String(sample.turbidityRaw);
+  data.moduleOtherData["weight_raw"] = String(sample.weightRaw);
+  data.moduleOtherData["tof_status"] = String(sample.tofStatus);
   
   return data;
 }
 
 float readForce(int pin) {
-  int rawValue = analogRead(pin);
-  // Convert to force in Newtons (adjust calibration based on your sensor)
-  // Assuming FSR sensor with voltage divider
-  float voltage = (rawValue / 4095.0) * 3.3;
-  float resistance = 10000.0 * (3.3 - voltage) / voltage; // 10k pull-down resistor
-  float force = 1.0 / (resistance / 1000.0); // Convert to approximate force
-  return force;
+  return forceFromAdc(analogRead(pin));
 }
 
 float readTurbidity() {
-  int rawValue = analogRead(TURBIDITY_ANALOG_PIN);
-  float voltage = (rawValue / 4095.0) * 3.3;
-  // Convert voltage to NTU (adjust calibration based on your sensor)
-  float turbidity = (voltage - 2.5) * 3000.0 / 2.0; // Example conversion
-  return max(0.0f, turbidity);
+  return turbidityFromAdc(analogRead(TURBIDITY_ANALOG_PIN));
 }
 
 float readUltrasonic() {
@@ -348,8 +690,7 @@ float readUltrasonic() {
     return -1; // Timeout or error
   }
   
-  float distance = duration * 0.034 / 2; // Convert to cm
-  return distance;
+  return distanceFromEcho(duration);
 }
 
 float getBatteryVoltage() {
@@ -362,16 +703,6 @@ float getBatteryVoltage() {
 #endif
 }
 
-float getBatteryPercentage(float voltage) {
-  // Li-ion battery voltage to percentage conversion
-  if (voltage >= 4.2) return 100.0;
-  if (voltage >= 4.0) return 75.0 + ((voltage - 4.0) / 0.2) * 25.0;
-  if (voltage >= 3.8) return 50.0 + ((voltage - 3.8) / 0.2) * 25.0;
-  if (voltage >= 3.6) return 25.0 + ((voltage - 3.6) / 0.2) * 25.0;
-  if (voltage >= 3.3) return 0.0 + ((voltage - 3.3) / 0.3) * 25.0;
-  return 0.0;
-}
-
 float getSolarVoltage() {
 #ifdef BOARD_SOLAR_ADC_PIN
   uint32_t solar_voltage = analogReadMilliVolts(BOARD_SOLAR_ADC_PIN);
@@ -409,8 +740,15 @@ float getStorageUsage() {
 }
 
 float getSignalStrength() {
-  if (modem.isNetworkConnected()) {
-    return modem.getSignalQuality();
+  static float lastSignal = -999;
+
+  // Skip AT round trips while the modem is off, booting or asleep
+  if (modemPower.isAsleep()) {
+    return lastSignal;
+  }
+  if (modemReady && modem.isNetworkConnected()) {
+    lastSignal = modem.getSignalQuality();
+    return lastSignal;
   }
   return -999; // No signal
 }
@@ -420,68 +758,196 @@ unsigned long getUptime() {
 }
 
 bool initializeModem() {
-  Serial.println("\n=== Initializing Modem ===");
-  
-  // Initialize Serial for modem
-  SerialAT.begin(115200, SERIAL_8N1, MODEM_RX_PIN, MODEM_TX_PIN);
+  bootSequence.begin();
+  modemReady = bootSequence.runUntilReady();
+  return modemReady;
+}
 
-#ifdef BOARD_POWERON_PIN
-  pinMode(BOARD_POWERON_PIN, OUTPUT);
-  digitalWrite(BOARD_POWERON_PIN, HIGH);
-  Serial.println("Modem power enabled");
-#endif
+void handleBoot() {
+  stageWatchdog.enter(WATCHDOG_MODEM_STEP);
+  BootPhase phase = bootSequence.step();
+  if (stageWatchdog.leave(WATCHDOG_MODEM_STEP)) {
+    // The watchdog reset the modem under a stuck step; start the bring-up over
+    bootSequence.begin();
+    return;
+  }
 
-#ifdef MODEM_RESET_PIN
-  pinMode(MODEM_RESET_PIN, OUTPUT);
-  digitalWrite(MODEM_RESET_PIN, !MODEM_RESET_LEVEL);
-  delay(100);
-  digitalWrite(MODEM_RESET_PIN, MODEM_RESET_LEVEL);
-  delay(2600);
-  digitalWrite(MODEM_RESET_PIN, !MODEM_RESET_LEVEL);
-  Serial.println("Modem reset completed");
-#endif
+  if (phase == BOOT_FAILED) {
+    // Setup is already stored; a missing network is no reason to ask for it again
+    Serial.println("Failed to initialize modem. Sampling offline, retrying later...");
+    scheduler.cancel(bootJob);
+    bootJob = -1;
+    scheduler.after("boot_retry", MODEM_BACKOFF_MAX_MS, []() {
+      bootSequence.begin();
+      bootJob = scheduler.every("boot", BOOT_POLL_MS, handleBoot, SCHED_PRIORITY_HIGH);
+    });
+    return;
+  }
+  if (phase != BOOT_READY) {
+    return;
+  }
 
-  // Power key sequence
-  pinMode(BOARD_PWRKEY_PIN, OUTPUT);
-  digitalWrite(BOARD_PWRKEY_PIN, LOW);
-  delay(100);
-  digitalWrite(BOARD_PWRKEY_PIN, HIGH);
-  delay(100);
-  digitalWrite(BOARD_PWRKEY_PIN, LOW);
-  
-  Serial.println("Starting modem initialization...");
+  scheduler.cancel(bootJob);
+  bootJob = -1;
+  modemReady = true;
+  modemPower.configure();
 
-  // Test modem communication
-  if (!modem.testAT(10000)) {
-    Serial.println("Failed to connect to modem");
-    return false;
+  // Back up after a watchdog reset: registration is already settled
+  if (deviceDB) {
+    refreshUplink();
+    Serial.println("✓ Modem recovered");
+    return;
   }
-  Serial.println("Modem connection established");
 
-  // Check SIM card
-  SimStatus sim = modem.getSimStatus();
-  if (sim != SIM_READY) {
-    Serial.println("SIM card not ready");
-    return false;
+  // Initialize database connections
+  deviceDB = new DeviceDB(&modem, &client);
+  addressDB = new AddressDB(&modem, &client);
+
+  // Registration cached from an earlier check: report right away and
+  // revalidate in the background after the first upload
+  if (deviceSetup->loadCachedRegistration()) {
+    bootSequence.complete();
+    refreshUplink();
+    Serial.println("✓ Using cached device registration");
+    Serial.printf("Device Name: %s\n", deviceSetup->getDeviceName().c_str());
+    Serial.printf("Location: %s\n", deviceSetup->getDeviceLocation().c_str());
+    registrationCheckPending = true;
+    pendingInitialReport = true;
+    return;
   }
-  Serial.println("SIM card ready");
 
-  // Wait for network registration
-  if (!modem.waitForNetwork(60000)) {
-    Serial.println("Failed to connect to network");
-    return false;
+  // No cache yet: check if device exists in database
+  unsigned long checkStart = millis();
+  stageWatchdog.enter(WATCHDOG_REGISTRATION);
+  SetupStatus status = deviceSetup->checkDeviceSetupStatus();
+  bool modemRecovered = stageWatchdog.leave(WATCHDOG_REGISTRATION);
+  bootSequence.recordPhase(BOOT_SETUP_CHECK, millis() - checkStart);
+  bootSequence.complete();
+  if (modemRecovered) {
+    // Report once the modem is back; the check is retried after that upload
+    registrationCheckPending = true;
+    pendingInitialReport = true;
+    restartModem();
+    return;
   }
-  Serial.println("Connected to cellular network");
 
-  // Connect to GPRS
-  if (!modem.gprsConnect("internet")) { // Use your APN here
-    Serial.println("Failed to connect to GPRS");
+  // Snapshot for the first report, with every boot phase recorded
+  refreshUplink();
+
+  if (handleRegistrationStatus(status)) {
+    // Send initial device data on the next loop pass
+    pendingInitialReport = true;
+  }
+}
+
+// Bring the modem up again after the watchdog reset it under a stuck exchange.
+// Uploads pause until handleBoot() sees it ready; the pipeline keeps sampling.
+void restartModem() {
+  Serial.println("Restarting modem after watchdog reset...");
+  modemReady = false;
+  scheduler.cancel(bootJob);
+  bootSequence.begin();
+  bootJob = scheduler.every("boot", BOOT_POLL_MS, handleBoot, SCHED_PRIORITY_HIGH);
+}
+
+// Watchdog hooks, run on the monitor task. The loop task owns the modem, so
+// the hook only holds it in reset; the stuck call then fails out on its own.
+bool recoverModem() {
+  modemManager.holdReset();
+  return false;
+}
+
+// Returns false if the device fell back into setup mode
+bool handleRegistrationStatus(SetupStatus status) {
+  switch (status) {
+  case SETUP_STATUS_REGISTERED:
+    Serial.println("✓ Device verified in database");
+    registrationCheckPending = false;
+    return true;
+  case SETUP_STATUS_NOT_FOUND:
+    Serial.println("Device not found in database. Starting setup mode...");
+    registrationCheckPending = false;
+    deviceSetup->resetSetupFlag();
+    deviceSetup->startSetupMode();
     return false;
+  default:
+    Serial.println("Setup status unavailable, will retry after the next upload");
+    registrationCheckPending = true;
+    return true;
   }
-  Serial.println("GPRS connected");
+}
 
-  String ipAddress = modem.getLocalIP();
-  Serial.printf("Modem IP: %s\n", ipAddress.c_str());
-  
-  return true;
+void runDutyCycle() {
+  dutyCycle.begin();
+
+  // Restore the tare offset instead of re-taring the scale on every wake. It
+  // is only kept once a tare has completed; until then every wake retries.
+  if (!initializeSensors(false)) {
+    Serial.println("Warning: Some sensors failed to initialize");
+  }
+  if (dutyCycle.hasWeightOffset()) {
+    weightSensor.set_offset(dutyCycle.getWeightOffset());
+  } else if (tareWeight(HX711_TARE_READINGS)) {
+    dutyCycle.setWeightOffset(weightSensor.get_offset());
+  } else {
+    Serial.println("Duty cycle: HX711 not ready, tare retried next wake");
+  }
+
+  DeviceData data = collectSensorData();
+  SampleRecord record = createSampleRecord(data, dutyCycle.elapsedMs());
+  dutyCycle.markFirstSample();
+  dutyCycle.append(record);
+  Serial.printf("Duty cycle: sample buffered after %lu ms\n", dutyCycle.getTimeToFirstSampleMs());
+
+  DutyCycleUpload reason = dutyCycle.uploadReason(record);
+  if (reason != DC_UPLOAD_NONE) {
+#if TELEMETRY_LOG_ENABLED
+    // Persist the RTC batch in one write instead of touching flash every wake
+    if (telemetryLog.begin()) {
+      for (size_t i = dutyCycle.persistedCount(); i < dutyCycle.count(); i++) {
+        telemetryLog.append(dutyCycle.at(i));
+      }
+      if (telemetryLog.flush()) {
+        dutyCycle.markPersisted();
+      }
+    }
+#endif
+    if (initializeModem()) {
+      deviceDB = new DeviceDB(&modem, &client);
+      dutyCycle.markUploaded(reason, uploadBufferedSamples(data));
+    } else {
+      dutyCycle.markUploaded(reason, false);
+    }
+    modemManager.powerOff();
+    modemReady = false;
+  }
+
+  dutyCycle.sleep();
+}
+
+// Oldest first, one frame per POST as /api/device-data takes them; stop at
+// the first failure so nothing is lost and the rest go up next wake
+bool uploadBufferedSamples(const DeviceData& latest) {
+  size_t total = dutyCycle.count();
+  size_t sent = 0;
+
+  while (sent < total) {
+    DeviceData data = latest;
+    applySampleRecord(dutyCycle.at(sent), data);
+    if (sent == total - 1) {
+      dutyCycle.appendCounters(data.deviceOtherData);
+    }
+
+    int result = deviceDB->createDeviceData(data);
+    if (result != 200 && result != 201) {
+      Serial.printf("Duty cycle: upload stopped at sample %u/%u - Status: %d\n", (unsigned)(sent + 1),
+                    (unsigned)total, result);
+      break;
+    }
+    sent++;
+  }
+
+  dutyCycle.dropFront(sent);
+  Serial.printf("Duty cycle: uploaded %u/%u buffered samples\n", (unsigned)sent, (unsigned)total);
+  return sent == total;
 }
\ No newline at end of file
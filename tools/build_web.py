@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Compress the portal web pages into a PROGMEM header.
+
+Each page in ASSETS is minified, gzipped and written to src/Setup/web_assets.h
+as a byte array together with its length and an ETag, so the firmware can
+serve it from flash with Content-Encoding: gzip. The output is deterministic,
+so the header only changes when the page does.
+
+Minifying only trims each line and joins the lines without a separator, which
+keeps it safe for the inline CSS and JS. In the sources that means: end JS
+statements with ';' or a brace, keep text and attribute values on one line,
+and put comments on lines of their own (//, /* */ or <!-- -->).
+
+Runs as a PlatformIO pre-build script (extra_scripts = pre:tools/build_web.py)
+or by hand:
+    tools/build_web.py
+    tools/build_web.py --check    # fail if the header is out of date
+"""
+
+import argparse
+import gzip
+import os
+import sys
+import re
+import zlib
+
+ASSETS = [
+    # (source, symbol prefix)
+    ("web/setup.html", "SETUP_PAGE"),
+    ("web/live.html", "LIVE_PAGE"),
+]
+OUTPUT = "src/Setup/web_assets.h"
+
+COMMENT_LINE = re.compile(r"^(//.*|/\*.*\*/|<!--.*-->)$")
+
+
+def minify(text):
+    lines = (line.strip() for line in text.splitlines())
+    return "".join(line for line in lines if line and not COMMENT_LINE.match(line))
+
+
+def render(root):
+    lines = [
+        "// Generated by tools/build_web.py from web/ -- do not edit.",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+    for source, symbol in ASSETS:
+        with open(os.path.join(root, source), encoding="utf-8") as f:
+            source_text = f.read()
+        raw = minify(source_text).encode("utf-8")
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = "%08x" % (zlib.crc32(raw) & 0xFFFFFFFF)
+        lines.append("// %s: %d bytes, %d minified, %d gzipped" %
+                     (source, len(source_text.encode("utf-8")), len(raw), len(packed)))
+        lines.append('#define %s_ETAG "\\"%s\\""' % (symbol, etag))
+        lines.append("const size_t %s_GZ_LEN = %d;" % (symbol, len(packed)))
+        lines.append("const uint8_t %s_GZ[] PROGMEM = {" % symbol)
+        for i in range(0, len(packed), 16):
+            lines.append("  " + ", ".join("0x%02x" % b for b in packed[i:i + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+    return "\n".join(lines)
+
+
+def generate(root, check=False):
+    text = render(root)
+    path = os.path.join(root, OUTPUT)
+    current = None
+    if os.path.exists(path):
+        with open(path) as f:
+            current = f.read()
+    if current == text:
+        return True
+    if check:
+        print("%s is out of date; run tools/build_web.py" % OUTPUT)
+        return False
+    with open(path, "w") as f:
+        f.write(text)
+    print("Generated %s" % OUTPUT)
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true", help="verify instead of writing")
+    args = parser.parse_args()
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    return 0 if generate(root, args.check) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
+else:
+    try:
+        Import("env")  # noqa: F821 -- provided by PlatformIO/SCons
+        generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+    except NameError:
+        pass
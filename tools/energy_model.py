@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Replay firmware ENERGY log lines and compare strategies by energy.
+
+The firmware prints one line per telemetry cycle (see src/Power/energy_model.cpp):
+
+    ENERGY,<cycle>,<cycle_ms>,<cpu_ms>,<sensor_ms>,<modem_awake_ms>,<modem_tx_ms>,
+           <modem_sleep_ms>,<samples>,<bytes>,<voltage>,<solar_w>
+
+Currents are read from src/configs.h so host and firmware use the same model.
+
+Usage:
+    tools/energy_model.py serial.log
+    tools/energy_model.py serial.log --bytes-scale 0.4 --reports-scale 0.5
+"""
+
+import argparse
+import os
+import re
+import sys
+
+CONFIGS = os.path.join(os.path.dirname(__file__), "..", "src", "configs.h")
+CURRENT_KEYS = [
+    "ENERGY_CPU_ACTIVE_MA",
+    "ENERGY_CPU_IDLE_MA",
+    "ENERGY_SENSOR_MA",
+    "MODEM_ACTIVE_MA",
+    "ENERGY_MODEM_TX_MA",
+    "MODEM_SLEEP_MA",
+]
+FIELDS = ["cycle", "cycle_ms", "cpu_ms", "sensor_ms", "modem_awake_ms", "modem_tx_ms",
+          "modem_sleep_ms", "samples", "bytes", "voltage", "solar_w"]
+
+
+def load_currents(path):
+    currents = {}
+    pattern = re.compile(r"#define\s+(\w+)\s+([0-9.]+)")
+    with open(path) as f:
+        for line in f:
+            m = pattern.match(line.strip())
+            if m and m.group(1) in CURRENT_KEYS:
+                currents[m.group(1)] = float(m.group(2))
+    missing = [k for k in CURRENT_KEYS if k not in currents]
+    if missing:
+        sys.exit("missing current constants in configs.h: " + ", ".join(missing))
+    return currents
+
+
+def load_cycles(path):
+    cycles = []
+    with open(path, errors="replace") as f:
+        for line in f:
+            idx = line.find("ENERGY,")
+            if idx < 0:
+                continue
+            parts = line[idx:].strip().split(",")[1:]
+            if len(parts) != len(FIELDS):
+                continue
+            cycles.append({k: float(v) for k, v in zip(FIELDS, parts)})
+    return cycles
+
+
+def cycle_energy_mj(c, currents, bytes_scale=1.0, reports_scale=1.0):
+    """Energy of one cycle under a strategy.
+
+    bytes_scale:   payload size relative to the log (e.g. 0.4 for a compact encoding);
+                   TX time is assumed proportional to bytes sent.
+    reports_scale: uploads per cycle relative to the log (0.5 = report half as often);
+                   TX time and bytes scale with it, the saved time is spent asleep.
+    """
+    tx_ms = c["modem_tx_ms"] * bytes_scale * reports_scale
+    saved_ms = c["modem_tx_ms"] - tx_ms
+    cpu_ms = max(c["cpu_ms"] - saved_ms, 0)
+    idle_ms = max(c["cycle_ms"] - cpu_ms, 0)
+    sleep_ms = c["modem_sleep_ms"] + saved_ms
+
+    charge = (cpu_ms * currents["ENERGY_CPU_ACTIVE_MA"]
+              + idle_ms * currents["ENERGY_CPU_IDLE_MA"]
+              + c["sensor_ms"] * currents["ENERGY_SENSOR_MA"]
+              + c["modem_awake_ms"] * currents["MODEM_ACTIVE_MA"]
+              + tx_ms * currents["ENERGY_MODEM_TX_MA"]
+              + sleep_ms * currents["MODEM_SLEEP_MA"])
+    return c["voltage"] * charge / 1000.0, c["bytes"] * bytes_scale * reports_scale
+
+
+def summarize(cycles, currents, bytes_scale, reports_scale):
+    total_mj = 0.0
+    total_bytes = 0.0
+    total_samples = 0.0
+    total_ms = 0.0
+    for c in cycles:
+        mj, sent = cycle_energy_mj(c, currents, bytes_scale, reports_scale)
+        total_mj += mj
+        total_bytes += sent
+        total_samples += c["samples"]
+        total_ms += c["cycle_ms"]
+    return {
+        "cycles": len(cycles),
+        "total_mj": total_mj,
+        "mj_per_sample": total_mj / total_samples if total_samples else 0.0,
+        "mj_per_byte": total_mj / total_bytes if total_bytes else 0.0,
+        "avg_mw": total_mj / total_ms * 1000.0 if total_ms else 0.0,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("log", help="serial log containing ENERGY lines")
+    parser.add_argument("--bytes-scale", type=float, default=1.0)
+    parser.add_argument("--reports-scale", type=float, default=1.0)
+    parser.add_argument("--configs", default=CONFIGS)
+    args = parser.parse_args()
+
+    currents = load_currents(args.configs)
+    cycles = load_cycles(args.log)
+    if not cycles:
+        sys.exit("no ENERGY lines found in " + args.log)
+
+    rows = [("logged", summarize(cycles, currents, 1.0, 1.0))]
+    if args.bytes_scale != 1.0 or args.reports_scale != 1.0:
+        rows.append(("strategy", summarize(cycles, currents, args.bytes_scale, args.reports_scale)))
+
+    print("%-10s %7s %12s %14s %12s %9s" % ("run", "cycles", "total_mJ", "mJ/sample", "mJ/byte", "avg_mW"))
+    for name, r in rows:
+        print("%-10s %7d %12.1f %14.2f %12.4f %9.1f" % (
+            name, r["cycles"], r["total_mj"], r["mj_per_sample"], r["mj_per_byte"], r["avg_mw"]))
+
+
+if __name__ == "__main__":
+    main()
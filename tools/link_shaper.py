@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""TCP proxy that shapes traffic like a cellular link.
+
+Each direction is its own link with a bandwidth queue, a one-way delay of
+half the RTT plus jitter, and loss. Loss on a TCP stream shows up as a
+retransmission stall, so a lost segment is delivered one RTO late and holds
+back everything queued behind it. Segments never reorder. New connections
+pay extra round trips for radio promotion and the TLS handshake the host
+build does not do.
+
+Profiles (RTT ms, jitter ms, down/up kbit/s, loss %, setup RTTs):
+
+    lan     no shaping
+    lte     60, 15, 10000/5000, 0.1, 2
+    lte-m   180, 60, 375/300, 0.5, 3
+    nb-iot  1200, 400, 30/60, 1, 3
+    edge    350, 100, 200/100, 1, 3
+    gprs    700, 250, 50/20, 2, 4
+
+Any value can be overridden, e.g. --profile lte-m --loss 2. With --seed the
+delays and losses repeat from run to run.
+
+Usage:
+    tools/link_shaper.py --listen 8081 --upstream 127.0.0.1:8080 --profile gprs
+"""
+
+import argparse
+import asyncio
+import random
+import signal
+import sys
+import time
+
+PROFILES = {
+    #          rtt_ms  jitter_ms  down_kbps  up_kbps  loss_pct  setup_rtts
+    "lan":    (0,      0,         0,         0,       0.0,      0),
+    "lte":    (60,     15,        10000,     5000,    0.1,      2),
+    "lte-m":  (180,    60,        375,       300,     0.5,      3),
+    "nb-iot": (1200,   400,       30,        60,      1.0,      3),
+    "edge":   (350,    100,       200,       100,     1.0,      3),
+    "gprs":   (700,    250,       50,        20,      2.0,      4),
+}
+SEGMENT = 1400      # Bytes per shaped segment, about one cellular MTU of payload
+MIN_RTO_MS = 200    # Linux minimum retransmission timeout
+
+
+class Link:
+    """One direction of the emulated link, shared by all connections."""
+
+    def __init__(self, name, rtt_ms, jitter_ms, kbps, loss_pct, rng):
+        self.name = name
+        self.delay = rtt_ms / 2000.0
+        self.jitter = jitter_ms / 2000.0
+        self.kbps = kbps
+        self.loss = loss_pct / 100.0
+        self.rto = max(MIN_RTO_MS, 2 * rtt_ms) / 1000.0
+        self.rng = rng
+        self.busy_until = 0.0
+        self.segments = 0
+        self.lost = 0
+        self.bytes = 0
+
+    def schedule(self, size, after):
+        """Time at which a segment of size bytes arrives, given the previous arrival."""
+        now = time.monotonic()
+        start = max(now, self.busy_until)
+        if self.kbps:
+            start += size * 8 / (self.kbps * 1000.0)
+        self.busy_until = start
+        arrival = start + self.delay
+        if self.jitter:
+            arrival += abs(self.rng.gauss(0, self.jitter))
+        if self.loss and self.rng.random() < self.loss:
+            arrival += self.rto
+            self.lost += 1
+        self.segments += 1
+        self.bytes += size
+        return max(arrival, after)
+
+
+class Shaper:
+    def __init__(self, args):
+        rtt, jitter, down, up, loss, setup = PROFILES[args.profile]
+        pick = lambda value, default: default if value is None else value
+        rtt = pick(args.rtt, rtt)
+        jitter = pick(args.jitter, jitter)
+        loss = pick(args.loss, loss)
+        self.setup_delay = pick(args.setup_rtts, setup) * rtt / 1000.0
+        self.rng = random.Random(args.seed)
+        self.up = Link("up", rtt, jitter, pick(args.up, up), loss, self.rng)
+        self.down = Link("down", rtt, jitter, pick(args.down, down), loss, self.rng)
+        self.upstream = args.upstream
+        self.connections = 0
+        self.verbose = args.verbose
+
+    async def pump(self, reader, writer, link):
+        queue = asyncio.Queue()
+
+        async def deliver():
+            while True:
+                arrival, data = await queue.get()
+                if data is None:
+                    break
+                wait = arrival - time.monotonic()
+                if wait > 0:
+                    await asyncio.sleep(wait)
+                writer.write(data)
+                await writer.drain()
+
+        sender = asyncio.ensure_future(deliver())
+        last = 0.0
+        try:
+            while True:
+                data = await reader.read(SEGMENT)
+                if not data:
+                    break
+                last = link.schedule(len(data), last)
+                queue.put_nowait((last, data))
+        except ConnectionError:
+            pass
+        queue.put_nowait((last, None))
+        try:
+            await sender
+        except ConnectionError:
+            pass
+        # Half-close so the other side sees the end of stream once data is delivered
+        try:
+            if writer.can_write_eof():
+                writer.write_eof()
+        except (ConnectionError, OSError):
+            pass
+
+    async def handle(self, client_reader, client_writer):
+        self.connections += 1
+        conn = self.connections
+        opened = time.monotonic()
+        host, port = self.upstream.rsplit(":", 1)
+        try:
+            server_reader, server_writer = await asyncio.open_connection(host, int(port))
+        except OSError as e:
+            print("#%d upstream %s: %s" % (conn, self.upstream, e), file=sys.stderr)
+            client_writer.close()
+            return
+        if self.setup_delay:
+            await asyncio.sleep(self.setup_delay)
+        up_bytes, down_bytes = self.up.bytes, self.down.bytes
+        await asyncio.gather(self.pump(client_reader, server_writer, self.up),
+                             self.pump(server_reader, client_writer, self.down))
+        for writer in (client_writer, server_writer):
+            writer.close()
+        if self.verbose:
+            print("#%d closed after %.0f ms, ~%d B up, ~%d B down" % (
+                conn, (time.monotonic() - opened) * 1000, self.up.bytes - up_bytes,
+                self.down.bytes - down_bytes), file=sys.stderr)
+
+    def summary(self):
+        print("%d connections" % self.connections)
+        for link in (self.up, self.down):
+            print("%-4s %10d B %8d segments %6d lost" % (link.name, link.bytes, link.segments, link.lost))
+
+
+async def serve(args):
+    shaper = Shaper(args)
+    server = await asyncio.start_server(shaper.handle, args.host, args.listen)
+    print("Shaping %s:%d -> %s as %s" % (args.host, args.listen, args.upstream, args.profile), flush=True)
+    stop = asyncio.Event()
+    loop = asyncio.get_running_loop()
+    for sig in (signal.SIGINT, signal.SIGTERM):
+        loop.add_signal_handler(sig, stop.set)
+    async with server:
+        await stop.wait()
+    shaper.summary()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--listen", type=int, default=8081)
+    parser.add_argument("--upstream", default="127.0.0.1:8080", help="host:port of tools/test_server.py")
+    parser.add_argument("--profile", choices=sorted(PROFILES), default="lte-m")
+    parser.add_argument("--rtt", type=float, help="round-trip time in ms")
+    parser.add_argument("--jitter", type=float, help="round-trip jitter (std dev) in ms")
+    parser.add_argument("--down", type=float, help="downlink kbit/s, 0 for unlimited")
+    parser.add_argument("--up", type=float, help="uplink kbit/s, 0 for unlimited")
+    parser.add_argument("--loss", type=float, help="segment loss in percent")
+    parser.add_argument("--setup-rtts", type=float, help="extra round trips before a new connection carries data")
+    parser.add_argument("--seed", type=int, help="seed for repeatable jitter and loss")
+    parser.add_argument("-v", "--verbose", action="store_true", help="log each connection")
+    asyncio.run(serve(parser.parse_args()))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""Pack the PSGC address hierarchy into the firmware's binary address index.
+
+Input is the usual PSGC table dump as four CSV files with a header row:
+
+    refregion.csv    regCode, regDesc
+    refprovince.csv  provCode, provDesc, ...
+    refcitymun.csv   citymunCode, citymunDesc, ...
+    refbrgy.csv      brgyCode, brgyDesc, ...
+
+Codes are hierarchical (a barangay code starts with its city/municipality
+code, and so on), so each level is stored as one table sorted by code and the
+children of a parent are found by a range search. The layout mirrors
+src/Database/address_index.h:
+
+    header   magic "PSGI", format version, image size, CRC-32 of the body,
+             per level {offset, count, code digits}, string table {offset, size}
+    levels   8-byte entries {u32 code, u32 (desc offset << 8 | desc length)}
+    strings  deduplicated UTF-8 descriptions, not NUL-terminated
+
+Usage:
+    tools/pack_addresses.py pack psgc/ -o address_index.bin
+    tools/pack_addresses.py verify address_index.bin
+    tools/pack_addresses.py lookup address_index.bin 0128
+
+Flash the image to the "addridx" partition (see partitions.csv):
+    esptool.py write_flash 0x300000 address_index.bin
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = 0x49475350  # "PSGI"
+FORMAT_VERSION = 1
+LEVELS = [
+    # (csv file, code column, description column, name)
+    ("refregion.csv", "regCode", "regDesc", "regions"),
+    ("refprovince.csv", "provCode", "provDesc", "provinces"),
+    ("refcitymun.csv", "citymunCode", "citymunDesc", "cities"),
+    ("refbrgy.csv", "brgyCode", "brgyDesc", "barangays"),
+]
+HEADER = struct.Struct("<IHHII" + "IIB3x" * len(LEVELS) + "II")
+ENTRY = struct.Struct("<II")
+MAX_IMAGE_SIZE = 0xF0000  # Size of the addridx partition
+
+
+def load_level(directory, filename, code_key, desc_key):
+    rows = {}
+    digits = None
+    with open(os.path.join(directory, filename), newline="", encoding="utf-8-sig") as f:
+        for row in csv.DictReader(f):
+            code = row[code_key].strip()
+            desc = " ".join(row[desc_key].split())
+            if not code.isdigit():
+                raise ValueError("%s: bad code %r" % (filename, code))
+            if digits is None:
+                digits = len(code)
+            elif len(code) != digits:
+                raise ValueError("%s: code %s is not %d digits" % (filename, code, digits))
+            rows[int(code)] = desc
+    return digits, sorted(rows.items())
+
+
+def pack(directory, output):
+    levels = [load_level(directory, f, c, d) for f, c, d, _ in LEVELS]
+
+    strings = bytearray()
+    string_offsets = {}
+    tables = []
+    for digits, rows in levels:
+        table = bytearray()
+        for code, desc in rows:
+            raw = desc.encode("utf-8")[:255]
+            if raw not in string_offsets:
+                string_offsets[raw] = len(strings)
+                strings += raw
+            table += ENTRY.pack(code, (string_offsets[raw] << 8) | len(raw))
+        tables.append(table)
+
+    offset = HEADER.size
+    level_fields = []
+    for (digits, rows), table in zip(levels, tables):
+        level_fields += [offset, len(rows), digits]
+        offset += len(table)
+    strings_offset = offset
+    body = b"".join(tables) + bytes(strings)
+    image_size = HEADER.size + len(body)
+
+    header = HEADER.pack(MAGIC, FORMAT_VERSION, len(LEVELS), image_size, zlib.crc32(body) & 0xFFFFFFFF,
+                         *level_fields, strings_offset, len(strings))
+    image = header + body
+    with open(output, "wb") as f:
+        f.write(image)
+
+    for (digits, rows), (_, _, _, name) in zip(levels, LEVELS):
+        print("%-10s %6d entries, %d-digit codes" % (name, len(rows), digits))
+    print("strings    %6d bytes (%d unique)" % (len(strings), len(string_offsets)))
+    print("image      %6d bytes -> %s" % (len(image), output))
+    return verify(output)
+
+
+def read_image(path):
+    with open(path, "rb") as f:
+        image = f.read()
+    if len(image) < HEADER.size:
+        raise ValueError("image too small")
+    fields = HEADER.unpack_from(image)
+    magic, version, level_count, image_size, crc = fields[:5]
+    if magic != MAGIC:
+        raise ValueError("bad magic 0x%08x" % magic)
+    if version != FORMAT_VERSION or level_count != len(LEVELS):
+        raise ValueError("unsupported format %d with %d levels" % (version, level_count))
+    if image_size != len(image):
+        raise ValueError("size mismatch: header %d, file %d" % (image_size, len(image)))
+    if zlib.crc32(image[HEADER.size:]) & 0xFFFFFFFF != crc:
+        raise ValueError("CRC mismatch")
+    levels = [fields[5 + 3 * i:8 + 3 * i] for i in range(len(LEVELS))]
+    strings_offset, strings_size = fields[-2:]
+    return image, levels, strings_offset, strings_size
+
+
+def entries(image, level, strings_offset):
+    offset, count, digits = level
+    for i in range(count):
+        code, desc = ENTRY.unpack_from(image, offset + i * ENTRY.size)
+        start = strings_offset + (desc >> 8)
+        yield code, image[start:start + (desc & 0xFF)].decode("utf-8")
+
+
+def verify(path):
+    try:
+        image, levels, strings_offset, strings_size = read_image(path)
+        if strings_offset + strings_size != len(image):
+            raise ValueError("string table does not end the image")
+        if len(image) > MAX_IMAGE_SIZE:
+            raise ValueError("image is %d bytes, partition holds %d" % (len(image), MAX_IMAGE_SIZE))
+
+        parents = None
+        parent_digits = 0
+        for level, (_, _, _, name) in zip(levels, LEVELS):
+            offset, count, digits = level
+            if offset + count * ENTRY.size > strings_offset:
+                raise ValueError("%s table overlaps the string table" % name)
+            codes = []
+            for code, desc in entries(image, level, strings_offset):
+                if codes and code <= codes[-1]:
+                    raise ValueError("%s not sorted at %0*d" % (name, digits, code))
+                if code >= 10 ** digits or not desc:
+                    raise ValueError("%s: bad entry %d" % (name, code))
+                if parents is not None and code // 10 ** (digits - parent_digits) not in parents:
+                    raise ValueError("%s %0*d has no parent" % (name, digits, code))
+                codes.append(code)
+            parents = set(codes)
+            parent_digits = digits
+    except (ValueError, UnicodeDecodeError) as e:
+        print("%s: INVALID: %s" % (path, e))
+        return False
+    print("%s: OK" % path)
+    return True
+
+
+def lookup(path, parent):
+    image, levels, strings_offset, _ = read_image(path)
+    # The parent code's digit count selects the child level
+    depth = 0
+    for i, (_, _, digits) in enumerate(levels):
+        if parent and len(parent) == digits:
+            depth = i + 1
+    if depth >= len(levels):
+        return
+    lo = hi = None
+    if parent:
+        scale = 10 ** (levels[depth][2] - len(parent))
+        lo, hi = int(parent) * scale, (int(parent) + 1) * scale
+    for code, desc in entries(image, levels[depth], strings_offset):
+        if lo is None or lo <= code < hi:
+            print("%0*d  %s" % (levels[depth][2], code, desc))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = parser.add_subparsers(dest="command", required=True)
+    p = sub.add_parser("pack", help="build an image from PSGC CSV files")
+    p.add_argument("directory")
+    p.add_argument("-o", "--output", default="address_index.bin")
+    v = sub.add_parser("verify", help="check an image's header, CRC, ordering and hierarchy")
+    v.add_argument("image")
+    l = sub.add_parser("lookup", help="list the children of a code (no code: regions)")
+    l.add_argument("image")
+    l.add_argument("parent", nargs="?", default="")
+    args = parser.parse_args()
+
+    if args.command == "pack":
+        return 0 if pack(args.directory, args.output) else 1
+    if args.command == "verify":
+        return 0 if verify(args.image) else 1
+    lookup(args.image, args.parent)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
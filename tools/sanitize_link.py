@@ -0,0 +1,10 @@
+"""Link with the sanitizer the native_tsan env compiles with.
+
+PlatformIO passes build_flags to the compiler only; the ThreadSanitizer
+runtime also has to be on the link line. Runs as a pre-build script
+(extra_scripts = pre:tools/sanitize_link.py).
+"""
+
+Import("env")  # noqa: F821 - provided by SCons
+
+env.Append(LINKFLAGS=["-fsanitize=thread"])  # noqa: F821
@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+"""Local stand-in for the SmartEcoDrain API, for native host builds.
+
+Plain HTTP/1.1 with keep-alive on the endpoints the firmware calls:
+
+    POST   /api/auth/login                 {"session": {"access_token": ...}}
+    POST   /api/devices                    201, stores the device
+    GET    /api/devices?uuid= | ?ownerUuid=
+    PUT    /api/devices?uuid=
+    DELETE /api/devices?uuid=
+    GET    /api/devices/setup-status?deviceId=
+    POST   /api/device-data                201
+    GET    /api/device-data?deviceId=[&latest=true]
+    POST   /api/heartbeat
+    GET    /api/address[?reg_code=&prov_code=&citymun_code=]
+    GET    /api/profiles/public/all[?page=&limit=]   ETag / If-None-Match
+
+GET /stats returns request counts, bytes and server time per endpoint, and
+POST /stats/reset clears them. State lives in memory only.
+
+Addresses come from the PSGC CSV dump that tools/pack_addresses.py reads
+(--psgc DIR), or from a small synthetic hierarchy. Point the host build at
+it directly or through tools/link_shaper.py:
+
+    tools/test_server.py --port 8080 --profiles 120
+    tools/link_shaper.py --listen 8081 --upstream 127.0.0.1:8080 --profile lte-m
+    HOST_NET_ENDPOINT=127.0.0.1:8081 .pio/build/native_link/program
+"""
+
+import argparse
+import csv
+import hashlib
+import json
+import os
+import sys
+import threading
+import time
+import uuid
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlsplit
+
+PSGC_LEVELS = [
+    # (csv file, code column, description column, response key, code field, desc field)
+    ("refregion.csv", "regCode", "regDesc", "regions", "reg_code", "reg_desc"),
+    ("refprovince.csv", "provCode", "provDesc", "provinces", "prov_code", "prov_desc"),
+    ("refcitymun.csv", "citymunCode", "citymunDesc", "cities", "citymun_code", "citymun_desc"),
+    ("refbrgy.csv", "brgyCode", "brgyDesc", "barangays", "brgy_code", "brgy_desc"),
+]
+CODE_DIGITS = [2, 4, 6, 9]
+
+
+def load_psgc(directory):
+    levels = []
+    for filename, code_key, desc_key, _, _, _ in PSGC_LEVELS:
+        with open(os.path.join(directory, filename), newline="", encoding="utf-8-sig") as f:
+            rows = [(r[code_key].strip(), " ".join(r[desc_key].split())) for r in csv.DictReader(f)]
+        levels.append(sorted(rows))
+    return levels
+
+
+def synthetic_psgc(regions=17, fanout=4):
+    """Codes follow the PSGC prefix rule so children are found the same way."""
+    levels = [[], [], [], []]
+    for r in range(1, regions + 1):
+        reg = "%02d" % r
+        levels[0].append((reg + "0000000", "Region %d" % r))
+        for p in range(1, fanout + 1):
+            prov = reg + "%02d" % p
+            levels[1].append((prov + "00000", "Province %d-%d" % (r, p)))
+            for c in range(1, fanout + 1):
+                city = prov + "%02d" % c
+                levels[2].append((city + "000", "City %d-%d-%d" % (r, p, c)))
+                for b in range(1, fanout * 3 + 1):
+                    levels[3].append((city + "%03d" % b, "Barangay %d" % b))
+    return levels
+
+
+def synthetic_profiles(count):
+    profiles = []
+    for i in range(count):
+        profiles.append({
+            "uuid": str(uuid.UUID(int=0x5ED0000000000000 + i)),
+            "email": "user%d@smartecodrain.ph" % i,
+            "full_name": "Juan Dela Cruz %d" % i,
+            "avatar_url": "https://cdn.smartecodrain.ph/avatars/%d.png" % i,
+            "created_at": "2025-06-14T08:21:45.123Z",
+            "updated_at": "2025-09-02T17:03:11.456Z",
+        })
+    return profiles
+
+
+class Api:
+    def __init__(self, psgc, profiles, server_ms):
+        self.lock = threading.Lock()
+        self.psgc = psgc
+        self.profiles = profiles
+        self.profiles_etag = '"%s"' % hashlib.sha1(json.dumps(profiles).encode()).hexdigest()[:16]
+        self.server_ms = server_ms
+        self.devices = {}
+        self.device_data = {}
+        self.heartbeats = {}
+        self.stats = {}
+
+    def record(self, endpoint, status, bytes_in, bytes_out, elapsed_ms):
+        with self.lock:
+            entry = self.stats.setdefault(endpoint, {
+                "requests": 0, "errors": 0, "bytes_in": 0, "bytes_out": 0, "server_ms": 0.0})
+            entry["requests"] += 1
+            entry["errors"] += status >= 400
+            entry["bytes_in"] += bytes_in
+            entry["bytes_out"] += bytes_out
+            entry["server_ms"] += elapsed_ms
+
+    def address(self, query):
+        reg = query.get("reg_code", "")
+        prov = query.get("prov_code", "")
+        city = query.get("citymun_code", "")
+        data = {}
+        # Same shape as AddressDB::getIndexedDropdownData(): only requested levels are filled
+        for depth, (_, _, _, key, code_field, desc_field) in enumerate(PSGC_LEVELS):
+            parent = ["", reg, prov, city][depth]
+            wanted = depth == 0 and not (reg or prov or city) or depth > 0 and parent
+            rows = []
+            if wanted:
+                prefix = parent[:CODE_DIGITS[depth - 1]] if depth else ""
+                rows = [{code_field: code, desc_field: desc}
+                        for code, desc in self.psgc[depth] if code.startswith(prefix)]
+            data[key] = rows
+        return {"success": True, "data": data}
+
+
+class CountingFile:
+    """Byte counter around the handler's socket files."""
+
+    def __init__(self, raw):
+        self.raw = raw
+        self.count = 0
+
+    def read(self, *args):
+        data = self.raw.read(*args)
+        self.count += len(data)
+        return data
+
+    def readline(self, *args):
+        data = self.raw.readline(*args)
+        self.count += len(data)
+        return data
+
+    def write(self, data):
+        self.count += len(data)
+        return self.raw.write(data)
+
+    def __getattr__(self, name):
+        return getattr(self.raw, name)
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    server_version = "SmartEcoDrainTest/1.0"
+    disable_nagle_algorithm = True
+    api = None
+    quiet = False
+
+    def setup(self):
+        super().setup()
+        self.rfile = CountingFile(self.rfile)
+        self.wfile = CountingFile(self.wfile)
+        self.counted_in = 0
+        self.counted_out = 0
+
+    def log_message(self, fmt, *args):
+        if not self.quiet:
+            sys.stderr.write("%s %s\n" % (self.address_string(), fmt % args))
+
+    def do_GET(self):
+        self.dispatch("GET")
+
+    def do_POST(self):
+        self.dispatch("POST")
+
+    def do_PUT(self):
+        self.dispatch("PUT")
+
+    def do_DELETE(self):
+        self.dispatch("DELETE")
+
+    def dispatch(self, method):
+        start = time.monotonic()
+        parts = urlsplit(self.path)
+        query = {k: v[0] for k, v in parse_qs(parts.query).items()}
+        length = int(self.headers.get("Content-Length") or 0)
+        raw = self.rfile.read(length) if length else b""
+        try:
+            body = json.loads(raw) if raw else {}
+        except ValueError:
+            body = None
+
+        route = "%s %s" % (method, parts.path)
+        if self.api.server_ms:
+            time.sleep(self.api.server_ms / 1000.0)
+        status, payload, headers = self.route(method, parts.path, query, body)
+        self.reply(status, payload, headers)
+        bytes_in = self.rfile.count - self.counted_in
+        bytes_out = self.wfile.count - self.counted_out
+        self.counted_in = self.rfile.count
+        self.counted_out = self.wfile.count
+        self.api.record(route, status, bytes_in, bytes_out, (time.monotonic() - start) * 1000.0)
+
+    def route(self, method, path, query, body):
+        api = self.api
+        if body is None:
+            return 400, {"success": False, "error": "invalid JSON"}, {}
+
+        if path == "/stats" and method == "GET":
+            with api.lock:
+                return 200, {"endpoints": api.stats}, {}
+        if path == "/stats/reset" and method == "POST":
+            with api.lock:
+                api.stats.clear()
+            return 200, {"success": True}, {}
+
+        if path == "/api/auth/login" and method == "POST":
+            if not body.get("email") or not body.get("password"):
+                return 401, {"success": False, "error": "missing credentials"}, {}
+            token = hashlib.sha1(body["email"].encode()).hexdigest()
+            return 200, {"success": True, "session": {"access_token": token}}, {}
+
+        if path == "/api/devices":
+            with api.lock:
+                if method == "POST":
+                    device_id = body.get("uuid") or str(uuid.uuid4())
+                    api.devices[device_id] = body
+                    return 201, dict(body, uuid=device_id), {}
+                if method == "GET" and "ownerUuid" in query:
+                    owned = [d for d in api.devices.values() if d.get("owner_uuid") == query["ownerUuid"]]
+                    return 200, owned, {}
+                device = api.devices.get(query.get("uuid", ""))
+                if device is None:
+                    return 404, {"success": False, "error": "device not found"}, {}
+                if method == "GET":
+                    return 200, [device], {}
+                if method == "PUT":
+                    device.update(body)
+                    return 200, device, {}
+                if method == "DELETE":
+                    del api.devices[query["uuid"]]
+                    return 200, {"success": True}, {}
+
+        if path == "/api/devices/setup-status" and method == "GET":
+            with api.lock:
+                device = api.devices.get(query.get("deviceId", ""))
+            if device is None:
+                return 404, {"setup_completed": False}, {}
+            location = device.get("location")
+            if isinstance(location, dict):
+                location = location.get("full_address", "")
+            return 200, {"setup_completed": True, "device_name": device.get("name", ""),
+                         "location": location or "", "owner_uuid": device.get("owner_uuid", "")}, {}
+
+        if path == "/api/device-data":
+            with api.lock:
+                if method == "POST":
+                    frames = api.device_data.setdefault(body.get("device_id", ""), [])
+                    frames.append(body)
+                    return 201, {"success": True, "id": len(frames)}, {}
+                frames = api.device_data.get(query.get("deviceId", ""), [])
+                if method == "GET":
+                    return 200, frames[-1:] if query.get("latest") == "true" else frames, {}
+                if method == "PUT":
+                    if not frames:
+                        return 404, {"success": False}, {}
+                    frames[-1].update(body)
+                    return 200, frames[-1], {}
+
+        if path == "/api/heartbeat" and method == "POST":
+            with api.lock:
+                api.heartbeats[body.get("uuid", "")] = time.time()
+            return 200, {"success": True}, {}
+
+        if path == "/api/address" and method == "GET":
+            return 200, api.address(query), {}
+
+        if path == "/api/profiles/public/all" and method == "GET":
+            if self.headers.get("If-None-Match") == api.profiles_etag:
+                return 304, None, {"ETag": api.profiles_etag}
+            if "page" in query:
+                page = max(1, int(query["page"]))
+                limit = max(1, int(query.get("limit", 50)))
+                chunk = api.profiles[(page - 1) * limit:page * limit]
+                more = page * limit < len(api.profiles)
+                return 200, {"success": True, "profiles": chunk, "has_more": more}, {"ETag": api.profiles_etag}
+            return 200, {"success": True, "profiles": api.profiles}, {"ETag": api.profiles_etag}
+
+        return 404, {"success": False, "error": "no route for %s %s" % (method, path)}, {}
+
+    def reply(self, status, payload, headers):
+        data = b"" if payload is None else json.dumps(payload, separators=(",", ":")).encode()
+        self.send_response(status)
+        if payload is not None:
+            self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(data)))
+        for key, value in headers.items():
+            self.send_header(key, value)
+        self.end_headers()
+        self.wfile.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--psgc", help="directory with the PSGC CSV files (default: synthetic)")
+    parser.add_argument("--profiles", type=int, default=120, help="public profiles to serve")
+    parser.add_argument("--server-ms", type=float, default=0, help="processing delay added to every request")
+    parser.add_argument("--quiet", action="store_true", help="do not log requests")
+    args = parser.parse_args()
+
+    psgc = load_psgc(args.psgc) if args.psgc else synthetic_psgc()
+    Handler.api = Api(psgc, synthetic_profiles(args.profiles), args.server_ms)
+    Handler.quiet = args.quiet
+
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    server.daemon_threads = True
+    print("Test API on http://%s:%d (%d regions, %d profiles)" % (
+        args.host, args.port, len(psgc[0]), args.profiles), flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()